@@ -699,6 +699,111 @@ int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, si
 int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_descr *descr,
 				   size_t descr_len, void *val);
 
+#if defined(CONFIG_JSON_LIBRARY_STREAM) || defined(__DOXYGEN__)
+
+/** @cond INTERNAL_HIDDEN */
+
+struct json_stream_frame {
+	/* Fields of an object, element of an array */
+	const struct json_obj_descr *descr;
+	void *val;
+	/* Next element of an array */
+	char *field;
+	/* Number of elements of an array, NULL for objects */
+	size_t *count;
+	size_t elem_size;
+	/* Number of fields of an object, maximum elements of an array */
+	size_t len;
+	int64_t decoded;
+};
+
+/** @endcond */
+
+/**
+ * @brief State of a streaming parser
+ *
+ * Set up with json_stream_obj_init() or json_stream_arr_init(). The fields
+ * are private.
+ */
+struct json_stream {
+	/** @cond INTERNAL_HIDDEN */
+	struct json_stream_frame frames[CONFIG_JSON_LIBRARY_STREAM_DEPTH];
+	struct json_obj_descr root;
+	/* Where the next value goes, descr is NULL if it is skipped */
+	const struct json_obj_descr *descr;
+	void *field;
+	void *val;
+	/* Fields whose name matches the key read so far */
+	uint64_t keys;
+	int64_t result;
+	size_t len;
+	size_t skip;
+	uint8_t depth;
+	uint8_t state;
+	uint8_t lex;
+	uint8_t hex;
+	bool backslash;
+	char word[sizeof("-1.797693134862316e+308")];
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a streaming parser for an object
+ *
+ * Prepares @a stream to decode a JSON object into @a val, like
+ * json_obj_parse(), from data passed to json_stream_parse() in chunks.
+ *
+ * The document is never held in memory, so the descriptors must not
+ * contain fields pointing into it: JSON_TOK_STRING, JSON_TOK_OPAQUE,
+ * JSON_TOK_FLOAT and JSON_TOK_OBJ_ARRAY fail to decode. Strings are
+ * decoded into JSON_TOK_STRING_BUF fields instead.
+ *
+ * @param stream Parser state
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array, less than 63
+ * @param val Pointer to the struct to hold the decoded values
+ */
+void json_stream_obj_init(struct json_stream *stream, const struct json_obj_descr *descr,
+			  size_t descr_len, void *val);
+
+/**
+ * @brief Initialize a streaming parser for an array
+ *
+ * Prepares @a stream to decode a JSON array into @a val, like
+ * json_arr_parse(), from data passed to json_stream_parse() in chunks. The
+ * restrictions of json_stream_obj_init() apply.
+ *
+ * @param stream Parser state
+ * @param descr Pointer to the array descriptor
+ * @param val Pointer to the struct to hold the decoded values
+ */
+void json_stream_arr_init(struct json_stream *stream, const struct json_obj_descr *descr,
+			  void *val);
+
+/**
+ * @brief Parse the next chunk of a JSON document
+ *
+ * Decodes @a len bytes of the document into the struct given at
+ * initialization. Values split between chunks are completed by the next
+ * call, and fields are written as soon as their value is complete.
+ * Data after the end of the document is ignored.
+ *
+ * @param stream Parser state
+ * @param data Next chunk of the document
+ * @param len Length of the chunk
+ *
+ * @retval -EAGAIN if the document is not complete yet
+ * @retval -ENOMEM if objects and arrays are nested deeper than
+ * CONFIG_JSON_LIBRARY_STREAM_DEPTH
+ * @return another negative value on errors, as for json_obj_parse() and
+ * json_arr_parse(), after which the parser stays in error. Once the
+ * document is complete, the bitmap of decoded fields of an object, or 0
+ * for an array.
+ */
+int64_t json_stream_parse(struct json_stream *stream, const char *data, size_t len);
+
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
@@ -82,6 +82,7 @@ extern "C" {
 #define DISK_STATUS_WR_PROTECT		0x04
 
 struct disk_operations;
+struct disk_cache;
 
 /**
  * @brief Disk info
@@ -97,6 +98,10 @@ struct disk_info {
 	const struct device *dev;
 	/** Internally used disk reference count */
 	uint16_t refcnt;
+#if defined(CONFIG_DISK_CACHE) || defined(__DOXYGEN__)
+	/** Internally used sector cache, NULL if the disk is not cached */
+	struct disk_cache *cache;
+#endif
 };
 
 /**
@@ -62,6 +62,16 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_NVS_LOOKUP_INDEX
+	/** Lookup index: ID held by each slot, 0xFFFF if the slot is free */
+	uint16_t lookup_index_id[CONFIG_NVS_LOOKUP_INDEX_SIZE];
+	/** Lookup index: address of the most recent ATE of each ID */
+	uint32_t lookup_index_addr[CONFIG_NVS_LOOKUP_INDEX_SIZE];
+	/** Number of lookup index slots in use */
+	uint32_t lookup_index_count;
+	/** Flag indicating if every ID stored in flash is in the lookup index */
+	bool lookup_index_complete;
+#endif
 };
 
 /**
@@ -3714,6 +3714,125 @@ int k_work_queue_unplug(struct k_work_q *queue);
  */
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout);
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+
+struct k_work_pool;
+
+/** @brief Start a work queue pool.
+ *
+ * Starts one work queue per CPU, each running a thread pinned to its CPU
+ * when @kconfig{CONFIG_SCHED_CPU_MASK} is enabled.  Work submitted to the
+ * pool goes to the queue of the submitting CPU, and a queue that runs out
+ * of work takes the oldest pending item from another queue of the pool.
+ * Cancelling, flushing and the busy state of work items behave as for
+ * items submitted to a single work queue.
+ *
+ * This can be invoked only once for a pool.
+ *
+ * @param pool pointer to the pool structure.  It must be zero-initialized
+ * or initialized with k_work_pool_init().
+ *
+ * @param stacks pointer to the first of the thread stacks, defined with
+ * K_THREAD_STACK_ARRAY_DEFINE() with at least @kconfig{CONFIG_MP_MAX_NUM_CPUS}
+ * elements of @p stack_size.
+ *
+ * @param stack_size the size of each stack, as passed to
+ * K_THREAD_STACK_ARRAY_DEFINE().
+ *
+ * @param prio initial thread priority
+ *
+ * @param cfg optional additional configuration parameters, applied to every
+ * queue of the pool.  Pass @c NULL if not required.
+ */
+void k_work_pool_start(struct k_work_pool *pool, k_thread_stack_t *stacks, size_t stack_size,
+		       int prio, const struct k_work_queue_config *cfg);
+
+/** @brief Initialize a work queue pool structure.
+ *
+ * @param pool pointer to the pool structure.
+ */
+void k_work_pool_init(struct k_work_pool *pool);
+
+/** @brief Submit a work item to a work queue pool.
+ *
+ * The item goes to the queue of the calling CPU.  As with
+ * k_work_submit_to_queue(), an item that is already queued is left alone,
+ * and an item that is running is queued to the queue running it.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool.
+ *
+ * @param work pointer to the work item.
+ *
+ * @return as for k_work_submit_to_queue().
+ */
+int k_work_pool_submit(struct k_work_pool *pool, struct k_work *work);
+
+/** @brief Schedule a delayable work item on a work queue pool.
+ *
+ * As k_work_schedule_for_queue(), with the queue of the calling CPU.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @return as for k_work_schedule_for_queue().
+ */
+int k_work_pool_schedule(struct k_work_pool *pool, struct k_work_delayable *dwork,
+			 k_timeout_t delay);
+
+/** @brief Reschedule a delayable work item on a work queue pool.
+ *
+ * As k_work_reschedule_for_queue(), with the queue of the calling CPU.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @return as for k_work_reschedule_for_queue().
+ */
+int k_work_pool_reschedule(struct k_work_pool *pool, struct k_work_delayable *dwork,
+			   k_timeout_t delay);
+
+/** @brief Wait until all queues of a work queue pool have drained.
+ *
+ * As k_work_queue_drain() for every queue of the pool.  Returns once all
+ * queues were found idle at the same time, so that work items moved
+ * between queues while draining have completed as well.
+ *
+ * @param pool pointer to the pool.
+ *
+ * @param plug if true the queues will continue to block new submissions
+ * after all items have drained.
+ *
+ * @retval 1 if call had to wait for the drain to complete
+ * @retval 0 if call did not have to wait
+ * @retval negative if wait was interrupted or failed
+ */
+int k_work_pool_drain(struct k_work_pool *pool, bool plug);
+
+/** @brief Release the queues of a work queue pool to accept new submissions.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool.
+ *
+ * @retval 0 if successfully unplugged
+ * @retval -EALREADY if the queues were not plugged.
+ */
+int k_work_pool_unplug(struct k_work_pool *pool);
+
+#endif /* defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__) */
+
 /** @brief Initialize a delayable work structure.
  *
  * This must be invoked before scheduling a delayable work structure for the
@@ -4262,8 +4381,30 @@ struct k_work_q {
 	struct k_work *work;
 	k_timeout_t work_timeout;
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* The pool the queue belongs to, if any. */
+	struct k_work_pool *pool;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 };
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+
+/** @brief A pool of work queues, one per CPU.
+ *
+ * The contents of this structure are private.  Use k_work_pool_start()
+ * to start the pool.
+ */
+struct k_work_pool {
+	/* One queue per CPU. */
+	struct k_work_q queues[CONFIG_MP_MAX_NUM_CPUS];
+
+	/* Number of started queues. */
+	unsigned int num_queues;
+};
+
+#endif /* defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__) */
+
 /* Provide the implementation for inline functions declared above */
 
 static inline bool k_work_is_pending(const struct k_work *work)
@@ -5421,13 +5562,28 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+struct k_mem_slab_cpu_cache {
+	struct k_spinlock lock;
+	uint32_t count;
+	void *blocks[CONFIG_MEM_SLAB_PER_CPU_CACHE_SIZE];
+};
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
 	char *buffer;
 	char *free_list;
+	/* num_used also counts blocks held in the per-CPU caches */
 	struct k_mem_slab_info info;
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	struct k_mem_slab_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* Set while threads may be waiting: frees bypass the caches */
+	atomic_t cache_bypass;
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
@@ -5581,7 +5737,17 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	uint32_t cached = 0;
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cached += slab->cpu_cache[i].count;
+	}
+
+	return slab->info.num_used - cached;
+#else
 	return slab->info.num_used;
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
 }
 
 /**
@@ -5616,7 +5782,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -6271,6 +6437,84 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/**
+ * @brief Persistent poll set
+ *
+ * A poll set keeps its events registered with the polled objects between
+ * waits. Objects that become available move their event onto the ready list
+ * of the set, so waiting on a set costs time proportional to the number of
+ * ready events rather than to the number of registered ones.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set Poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event must have been initialized with k_poll_event_init() and must not
+ * be part of any k_poll() call or other set. If the polled object is already
+ * available the event goes straight to the ready list, otherwise it is
+ * registered with the object until the object becomes available.
+ *
+ * An event is delivered once: after k_poll_set_get() returned it, it has to
+ * be added again (after resetting its state) to keep watching the object.
+ *
+ * @param set Poll set.
+ * @param event Event to add.
+ */
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * Removes the event from the polled object or from the ready list of the
+ * set, whichever it is on. Removing an event that was already returned by
+ * k_poll_set_get() is allowed and has no effect.
+ *
+ * @param set Poll set.
+ * @param event Event to remove.
+ */
+void k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for a poll set to have a ready event.
+ *
+ * This routine does not consume any event, use k_poll_set_get() to fetch
+ * them. It must not be called from an ISR unless @a timeout is K_NO_WAIT.
+ *
+ * @param set Poll set.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 At least one event is ready.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, k_timeout_t timeout);
+
+/**
+ * @brief Fetch the next ready event of a poll set.
+ *
+ * @param set Poll set.
+ *
+ * @return Ready event, with its state field set, or NULL if none is ready.
+ */
+struct k_poll_event *k_poll_set_get(struct k_poll_set *set);
+
 /** @} */
 
 /**
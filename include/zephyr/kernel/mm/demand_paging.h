@@ -59,6 +59,19 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+#if defined(CONFIG_DEMAND_PAGING_FAULT_AROUND) || defined(__DOXYGEN__)
+	struct {
+		/** Number of page faults detected as sequential */
+		unsigned long			hits;
+
+		/** Number of page faults not detected as sequential */
+		unsigned long			misses;
+
+		/** Number of pages paged in ahead of their access */
+		unsigned long			pages;
+	} readahead;
+#endif /* CONFIG_DEMAND_PAGING_FAULT_AROUND */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -412,6 +425,32 @@ void k_mem_paging_backing_store_page_out(uintptr_t location);
  */
 void k_mem_paging_backing_store_page_in(uintptr_t location);
 
+/**
+ * Copy several data pages from the backing store into page frames
+ *
+ * Invoked instead of k_mem_paging_backing_store_page_in() when a page fault
+ * pages in more than one data page, see CONFIG_DEMAND_PAGING_FAULT_AROUND.
+ * Each data page locations[i] must be copied into the page frame at physical
+ * address phys[i], by mapping K_MEM_SCRATCH_PAGE to it with
+ * arch_mem_scratch() and copying into K_MEM_SCRATCH_PAGE.
+ *
+ * The default implementation does exactly this with
+ * k_mem_paging_backing_store_page_in(), page by page. Backing stores for
+ * which a transfer has a high fixed cost may override it, for instance to
+ * read adjacent locations at once.
+ *
+ * Calls to this, k_mem_paging_backing_store_page_in() and
+ * k_mem_paging_backing_store_page_out() will always be serialized, but
+ * interrupts may be enabled. k_mem_paging_backing_store_page_finalize() is
+ * invoked for each page afterwards.
+ *
+ * @param locations Location tokens of the data pages
+ * @param phys Physical addresses of the destination page frames
+ * @param count Number of data pages
+ */
+void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations,
+					      const uintptr_t *phys, size_t count);
+
 /**
  * Update internal accounting after a page-in
  *
@@ -121,6 +121,11 @@ struct _thread_base {
 
 #endif /* CONFIG_SMP */
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* CPU index of the run queue the thread is queued in */
+	uint8_t runq_cpu;
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 #ifdef CONFIG_SCHED_CPU_MASK
 	/* "May run on" bits for each CPU */
 #if CONFIG_MP_MAX_NUM_CPUS <= 8
@@ -84,6 +84,17 @@ struct llext_symtable {
 
 	/** Array of symbols */
 	struct llext_symbol *syms;
+
+#if defined(CONFIG_LLEXT_SYMBOL_INDEX) || defined(__DOXYGEN__)
+	/**
+	 * Hash index of the symbols, NULL if not indexed. Each slot holds
+	 * the position of a symbol in @ref syms plus one, or zero if free.
+	 */
+	uint16_t *index;
+
+	/** Number of slots in @ref index, a power of two */
+	size_t index_size;
+#endif
 };
 
 
@@ -57,6 +57,9 @@ extern "C" {
 #define HTTP_SERVER_CAPTURE_HEADER_COUNT       0
 #endif
 
+/* Quoted entity tag of a cached file: CRC-32 and size in hex */
+#define HTTP_SERVER_ETAG_LEN sizeof("\"01234567-01234567\"")
+
 #define HTTP2_PREFACE "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"
 
 /** @endcond */
@@ -490,6 +493,11 @@ struct http_client_ctx {
 	IF_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION, (uint8_t supported_compression));
 /** @endcond */
 
+/** @cond INTERNAL_HIDDEN */
+	/** Entity tags of the If-None-Match request header. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_FS_CACHE, (char if_none_match[2 * HTTP_SERVER_ETAG_LEN]));
+/** @endcond */
+
 	/** Flag indicating that HTTP2 preface was sent. */
 	bool preface_sent : 1;
 
@@ -511,6 +519,9 @@ struct http_client_ctx {
 	/** Flag indicating accept encoding is being processed. */
 	IF_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION, (bool accept_encoding_next: 1));
 
+	/** Flag indicating If-None-Match is being processed. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_FS_CACHE, (bool if_none_match_next: 1));
+
 	/** The next frame on the stream is expectd to be a continuation frame. */
 	bool expect_continuation : 1;
 };
@@ -544,6 +555,14 @@ int http_server_start(void);
  */
 int http_server_stop(void);
 
+/** @brief Drop all cached static filesystem resources.
+ *
+ * Must be called after files served by a @ref HTTP_RESOURCE_TYPE_STATIC_FS
+ * resource are modified, when CONFIG_HTTP_SERVER_FS_CACHE is enabled. Files
+ * that are being sent at the time are dropped once the transfer is done.
+ */
+void http_server_fs_cache_invalidate(void);
+
 #ifdef __cplusplus
 }
 #endif
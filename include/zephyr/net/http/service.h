@@ -67,6 +67,10 @@ struct http_resource_desc {
 
 struct http_service_runtime_data {
 	int num_clients;
+#if defined(CONFIG_HTTP_SERVER_RESOURCE_TRIE)
+	/* Root node of the resource path trie, 0 if not built */
+	uint16_t route_root;
+#endif
 };
 
 struct http_service_desc {
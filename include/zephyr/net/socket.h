@@ -553,6 +553,48 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+struct net_buf;
+
+/**
+ * @brief Receive data from a connected stream socket without copying it
+ *
+ * @details
+ * Dequeue all the data currently received on the socket and hand over
+ * the network buffers holding it to the caller, instead of copying it to
+ * a user supplied buffer. The data is returned as a fragment chain, which
+ * must be given back with zsock_recv_zc_release() once the caller is done
+ * with it. The TCP receive window is only opened again on release, so
+ * holding the buffers throttles the peer and also keeps them away from
+ * the network RX buffer pool.
+ *
+ * Only supported for native TCP sockets, and only from supervisor mode.
+ * Available when @kconfig{CONFIG_NET_SOCKETS_RECV_ZERO_COPY} is enabled.
+ *
+ * @param sock Socket descriptor.
+ * @param frags Where to store the fragment chain holding the data. Set to
+ *              NULL when nothing is returned.
+ * @param flags ZSOCK_MSG_DONTWAIT to not block, other flags are not
+ *              supported.
+ *
+ * @return Number of bytes received, 0 at end of stream, or -1 with errno
+ *         set on error.
+ */
+ssize_t zsock_recv_zc(int sock, struct net_buf **frags, int flags);
+
+/**
+ * @brief Release data received with zsock_recv_zc()
+ *
+ * @details
+ * Free the fragment chain returned by zsock_recv_zc() and open the TCP
+ * receive window by the amount of data it held.
+ *
+ * @param sock Socket descriptor the data was received from.
+ * @param frags Fragment chain returned by zsock_recv_zc(), may be NULL.
+ *
+ * @return 0 on success, or -1 with errno set on error.
+ */
+int zsock_recv_zc_release(int sock, struct net_buf *frags);
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
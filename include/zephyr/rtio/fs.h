@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_RTIO_FS_H_
+#define ZEPHYR_INCLUDE_RTIO_FS_H_
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief RTIO file system operations
+ * @defgroup rtio_fs RTIO file system operations
+ * @ingroup rtio
+ * @{
+ *
+ * A file iodev performs RTIO_OP_RX (read) and RTIO_OP_TX (write) operations
+ * on an open file at its current position.  The operations are offloaded to
+ * the RTIO work queues, so that the submitting thread does not block on the
+ * file system.  Reads may take their buffer from the mempool of the RTIO
+ * context, in which case at most one block is read per completion.
+ *
+ * Operations on the same file run one at a time, but only operations that
+ * are chained (@ref RTIO_SQE_CHAINED) run in submission order.
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+struct rtio_fs {
+	struct fs_file_t *file;
+	struct k_mutex lock;
+};
+
+extern const struct rtio_iodev_api rtio_fs_iodev_api;
+
+/** @endcond */
+
+/**
+ * @brief Define a file iodev
+ *
+ * @param name Symbolic name of the iodev
+ */
+#define RTIO_FS_IODEV_DEFINE(name)                                                                 \
+	static struct rtio_fs _rtio_fs_##name;                                                     \
+	RTIO_IODEV_DEFINE(name, &rtio_fs_iodev_api, &_rtio_fs_##name)
+
+/**
+ * @brief Attach an open file to a file iodev
+ *
+ * Operations must only be submitted to the iodev while a file is attached,
+ * and the file must not be closed before they completed.
+ *
+ * @param iodev The file iodev
+ * @param file The open file
+ */
+void rtio_fs_attach(const struct rtio_iodev *iodev, struct fs_file_t *file);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_RTIO_FS_H_ */
@@ -583,6 +583,9 @@ struct rtio_iodev {
 /** An operation to suspend bus while awaiting signal */
 #define RTIO_OP_AWAIT (RTIO_OP_I3C_CCC+1)
 
+/** An operation that accepts a connection, the result is the new socket */
+#define RTIO_OP_ACCEPT (RTIO_OP_AWAIT+1)
+
 /**
  * @brief Prepare a nop (no op) submission
  */
@@ -757,6 +760,25 @@ static inline void rtio_sqe_prep_await(struct rtio_sqe *sqe,
 	sqe->userdata = userdata;
 }
 
+/**
+ * @brief Prepare an accept op submission
+ *
+ * Accepts a connection on a listening socket iodev, the result of the
+ * completion is the file descriptor of the connected socket.  Combine with
+ * @ref RTIO_SQE_MULTISHOT to keep accepting connections.
+ */
+static inline void rtio_sqe_prep_accept(struct rtio_sqe *sqe,
+					const struct rtio_iodev *iodev,
+					int8_t prio,
+					void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_ACCEPT;
+	sqe->prio = prio;
+	sqe->iodev = iodev;
+	sqe->userdata = userdata;
+}
+
 static inline void rtio_sqe_prep_delay(struct rtio_sqe *sqe,
 				       k_timeout_t timeout,
 				       void *userdata)
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_RTIO_SOCKET_H_
+#define ZEPHYR_INCLUDE_RTIO_SOCKET_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/mpsc_lockfree.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief RTIO socket operations
+ * @defgroup rtio_socket RTIO socket operations
+ * @ingroup rtio
+ * @{
+ *
+ * A socket iodev performs the RTIO_OP_RX (receive), RTIO_OP_TX (send) and
+ * RTIO_OP_ACCEPT operations on a socket without blocking the submitting
+ * thread.  A single reactor thread waits for the readiness of all sockets
+ * with pending operations and completes the operations as data arrives.
+ *
+ * Receive operations may take their buffer from the mempool of the RTIO
+ * context (rtio_sqe_prep_read_with_pool()), one block per completion, and
+ * may be multishot (rtio_sqe_prep_read_multishot()) to keep receiving.  A
+ * receive that completes with 0 signals the end of the stream; a multishot
+ * receive then stays pending until the socket is detached.  A multishot
+ * receive that runs out of mempool blocks waits for the consumer to
+ * release some, and one that fails completes with the error once and is
+ * not submitted again.
+ *
+ * Receives and accepts of a socket complete in submission order, as do its
+ * sends.  A send completes once all of its data was sent.
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+struct rtio_sock {
+	/* Receives and accepts submitted to the reactor */
+	struct mpsc rx_q;
+	/* Sends submitted to the reactor */
+	struct mpsc tx_q;
+	/* Node in the reactor's list of sockets with news */
+	struct mpsc_node node;
+	atomic_t queued;
+	int fd;
+
+	/* Owned by the reactor thread */
+	struct rtio_iodev_sqe *rx;
+	struct rtio_iodev_sqe *tx;
+	uint32_t tx_offset;
+	uint32_t events;
+	/* Node in the reactor's list of sockets out of mempool blocks */
+	sys_snode_t starved_node;
+	bool starved;
+	bool eof;
+	bool detach;
+	struct k_sem detached;
+};
+
+extern const struct rtio_iodev_api rtio_sock_iodev_api;
+
+/** @endcond */
+
+/**
+ * @brief Define a socket iodev
+ *
+ * @param name Symbolic name of the iodev
+ */
+#define RTIO_SOCK_IODEV_DEFINE(name)                                                               \
+	static struct rtio_sock _rtio_sock_##name;                                                 \
+	RTIO_IODEV_DEFINE(name, &rtio_sock_iodev_api, &_rtio_sock_##name)
+
+/**
+ * @brief Initialize a socket iodev at runtime
+ *
+ * Allows keeping socket iodevs in arrays, for instance one per connection.
+ * Not usable from user mode, which requires iodevs defined with
+ * RTIO_SOCK_IODEV_DEFINE().
+ *
+ * @param iodev The iodev
+ * @param sock Socket state of the iodev
+ */
+static inline void rtio_sock_iodev_init(struct rtio_iodev *iodev, struct rtio_sock *sock)
+{
+	iodev->api = &rtio_sock_iodev_api;
+	iodev->data = sock;
+}
+
+/**
+ * @brief Attach a socket to a socket iodev
+ *
+ * Switches the socket to non-blocking mode.  Operations must only be
+ * submitted to the iodev while a socket is attached.
+ *
+ * @param iodev The socket iodev
+ * @param fd The socket
+ *
+ * @retval 0 on success
+ * @retval -errno on failure to make the socket non-blocking
+ */
+int rtio_sock_attach(const struct rtio_iodev *iodev, int fd);
+
+/**
+ * @brief Detach the socket of a socket iodev
+ *
+ * Completes all pending operations of the iodev with -ECANCELED, except
+ * multishot ones which are released without completion.  The socket is not
+ * closed.  Must not be called from a completion callback.
+ *
+ * @param iodev The socket iodev
+ */
+void rtio_sock_detach(const struct rtio_iodev *iodev);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_RTIO_SOCKET_H_ */
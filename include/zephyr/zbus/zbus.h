@@ -656,6 +656,57 @@ int zbus_chan_finish(const struct zbus_channel *chan);
  */
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_LOANED_MSG) || defined(__DOXYGEN__)
+
+struct net_buf;
+
+/**
+ * @brief Loan a message buffer for publishing to a channel.
+ *
+ * This routine takes a buffer of the channel's message size from the loaned message pool. The
+ * publisher writes the message directly into @p loan->data and hands the buffer over with
+ * zbus_chan_pub_loan(). All message subscribers then share the same buffer, instead of getting
+ * a copy each. An unused loan must be returned with net_buf_unref().
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] loan The loaned buffer, holding zbus_chan_msg_size() bytes.
+ * @param[in] timeout Waiting period for a free buffer,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Buffer loaned.
+ * @retval -ENOMEM There is no free buffer in the loaned message pool.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_loan(const struct zbus_channel *chan, struct net_buf **loan, k_timeout_t timeout);
+
+/**
+ * @brief Publish a loaned message to a channel
+ *
+ * This routine publishes a message written into a buffer from zbus_chan_loan(). The channel's
+ * message is updated as with zbus_chan_pub(), and message subscribers get a read-only
+ * reference to the loaned buffer. The buffer is released once the last subscriber drops it.
+ * The caller gives up the loan, whether the publication succeeds or not.
+ *
+ * @param chan The channel's reference.
+ * @param loan The loaned buffer holding the message.
+ * @param timeout Waiting period to publish the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel published.
+ * @retval -ENOMSG The message is invalid based on the validator function or some of the
+ * observers could not receive the notification.
+ * @retval -ENOMEM There is no free buffer header in the loaned message pool.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, the notification could not be sent to one or more
+ * observer, or the function context is invalid (inside an ISR). The function only returns this
+ * value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_pub_loan(const struct zbus_channel *chan, struct net_buf *loan, k_timeout_t timeout);
+
+#endif /* CONFIG_ZBUS_LOANED_MSG */
+
 #if defined(CONFIG_ZBUS_CHANNEL_NAME) || defined(__DOXYGEN__)
 
 /**
@@ -1126,6 +1177,32 @@ int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **c
 int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel **chan, void *msg,
 		      k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_LOANED_MSG) || defined(__DOXYGEN__)
+
+/**
+ * @brief Wait for a channel message without copying it.
+ *
+ * This routine makes the subscriber wait for the new message in case of channel publication,
+ * like zbus_sub_wait_msg(), but hands out the buffer holding the message instead of a copy.
+ * For messages published with zbus_chan_pub_loan() the buffer data is shared with the other
+ * subscribers and must not be modified. The buffer must be released with net_buf_unref().
+ *
+ * @param[in] sub The subscriber's reference.
+ * @param[out] chan The notification channel's reference.
+ * @param[out] msg The buffer holding the published message in its data.
+ * @param[in] timeout Waiting period for a notification arrival,
+ *                or one of the special values, K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -ENOMSG Could not retrieve the net_buf from the subscriber FIFO.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_sub_wait_loaned_msg(const struct zbus_observer *sub, const struct zbus_channel **chan,
+			     struct net_buf **msg, k_timeout_t timeout);
+
+#endif /* CONFIG_ZBUS_LOANED_MSG */
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 /**
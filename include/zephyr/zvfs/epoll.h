@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdint.h>
+
+#include <zephyr/sys/fdtable.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZVFS_EPOLLIN  ZVFS_POLLIN
+#define ZVFS_EPOLLPRI ZVFS_POLLPRI
+#define ZVFS_EPOLLOUT ZVFS_POLLOUT
+#define ZVFS_EPOLLERR ZVFS_POLLERR
+#define ZVFS_EPOLLHUP ZVFS_POLLHUP
+
+#define ZVFS_EPOLL_CTL_ADD 1
+#define ZVFS_EPOLL_CTL_DEL 2
+#define ZVFS_EPOLL_CTL_MOD 3
+
+typedef union zvfs_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+} zvfs_epoll_data_t;
+
+struct zvfs_epoll_event {
+	uint32_t events;
+	zvfs_epoll_data_t data;
+};
+
+/**
+ * @brief Create a ZVFS epoll instance
+ *
+ * An epoll instance keeps a persistent set of file descriptors of interest.
+ * Unlike @ref zvfs_poll, the descriptors stay registered with their kernel
+ * objects between waits and readiness is queued as it happens, so
+ * @ref zvfs_epoll_wait only visits the descriptors that are ready.
+ *
+ * Only descriptors supporting ZFD_IOCTL_POLL_PREPARE and
+ * ZFD_IOCTL_POLL_UPDATE can be added, offloaded sockets are rejected.
+ *
+ * @param flags Must be 0
+ *
+ * @return New ZVFS epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create(int flags);
+
+/**
+ * @brief Add, modify or remove a descriptor of an epoll instance
+ *
+ * A descriptor must be removed with ZVFS_EPOLL_CTL_DEL before it is closed.
+ *
+ * @param epfd Epoll file descriptor
+ * @param op One of ZVFS_EPOLL_CTL_ADD, ZVFS_EPOLL_CTL_MOD or ZVFS_EPOLL_CTL_DEL
+ * @param fd Target file descriptor
+ * @param event Events of interest and user data, ignored for ZVFS_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event);
+
+/**
+ * @brief Wait for descriptors of an epoll instance to become ready
+ *
+ * Readiness is level-triggered: a descriptor that is still ready is reported
+ * again by the next call.
+ *
+ * @param epfd Epoll file descriptor
+ * @param events Output array of ready descriptors
+ * @param maxevents Size of @a events
+ * @param timeout Timeout in milliseconds, negative to wait forever
+ *
+ * @return Number of entries stored in @a events, 0 on timeout, -1 on error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
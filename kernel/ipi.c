@@ -25,6 +25,21 @@ void flag_ipi(uint32_t ipi_mask)
 /* Create a bitmask of CPUs that need an IPI. Note: sched_spinlock is held. */
 atomic_val_t ipi_mask_create(struct k_thread *thread)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* A thread that can run right away is placed on the run queue of
+	 * the CPU picked to run it, so that CPU is the only one that needs
+	 * poking.  When no CPU could take it, whichever reschedules first
+	 * will steal it without an IPI.
+	 */
+	uint32_t cpu = thread->base.runq_cpu;
+
+	if ((cpu == _current_cpu->id) || (_kernel.cpus[cpu].runq_placed != thread)) {
+		return 0;
+	}
+
+	return (atomic_val_t)BIT(cpu);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 	if (!IS_ENABLED(CONFIG_IPI_OPTIMIZE)) {
 		return (CONFIG_MP_MAX_NUM_CPUS > 1) ? IPI_ALL_CPUS_MASK : 0;
 	}
@@ -33,6 +33,7 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
 	memcpy(stats, &slab->info, sizeof(slab->info));
+	((struct k_mem_slab_info *)stats)->num_used = k_mem_slab_num_used_get(slab);
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -48,9 +49,9 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
+	ptr->allocated_bytes = k_mem_slab_num_used_get(slab) *
+			       slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -72,7 +73,7 @@ static int k_mem_slab_stats_reset(struct k_obj_core *obj_core)
 	key = k_spin_lock(&slab->lock);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
 	k_spin_unlock(&slab->lock, key);
@@ -183,6 +184,11 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	(void)memset(slab->cpu_cache, 0, sizeof(slab->cpu_cache));
+	atomic_clear(&slab->cache_bypass);
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	rc = create_free_list(slab);
 	if (rc < 0) {
 		goto out;
@@ -218,28 +224,200 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+/* Take a block off the shared free list, slab lock held */
+static void *free_list_pop(struct k_mem_slab *slab)
+{
+	void *mem = slab->free_list;
+
+	slab->free_list = *(char **)(slab->free_list);
+	slab->info.num_used++;
+	__ASSERT((slab->free_list == NULL &&
+		  slab->info.num_used == slab->info.num_blocks) ||
+		 slab_ptr_is_good(slab, slab->free_list),
+		 "slab corruption detected");
+
+	return mem;
+}
+
+/*
+ * Return a block to the shared free list, slab lock held.  If a thread
+ * is waiting for a block it is handed the block directly instead, and
+ * true is returned to tell the caller a reschedule is needed.
+ */
+static bool free_list_push(struct k_mem_slab *slab, void *mem)
+{
+	if (unlikely(slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
+		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+		if (unlikely(pending_thread != NULL)) {
+			z_thread_return_value_set_with_data(pending_thread, 0, mem);
+			z_ready_thread(pending_thread);
+			return true;
+		}
+	}
+	*(char **) mem = slab->free_list;
+	slab->free_list = (char *) mem;
+	slab->info.num_used--;
+
+	return false;
+}
+
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+#define CACHE_BATCH (CONFIG_MEM_SLAB_PER_CPU_CACHE_SIZE / 2)
+
+/*
+ * Lock ordering: a CPU cache lock may be taken while holding the slab
+ * lock, never the other way around.  Blocks sitting in a cache count as
+ * used in slab->info.num_used, k_mem_slab_num_used_get() subtracts them.
+ */
+
+/* Move every cached block back to the shared free list, slab lock held */
+static void cache_reclaim_all(struct k_mem_slab *slab)
+{
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		while (cache->count > 0U) {
+			void *mem = cache->blocks[--cache->count];
+
+			*(char **) mem = slab->free_list;
+			slab->free_list = (char *) mem;
+			slab->info.num_used--;
+		}
+
+		k_spin_unlock(&cache->lock, key);
+	}
+}
+
+/* Move a batch of free blocks into the current CPU cache, slab lock held */
+static void cache_refill(struct k_mem_slab *slab)
+{
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[_current_cpu->id];
+	k_spinlock_key_t key;
+
+	if (atomic_get(&slab->cache_bypass) != 0) {
+		return;
+	}
+
+	key = k_spin_lock(&cache->lock);
+	while ((cache->count < CACHE_BATCH) && (slab->free_list != NULL)) {
+		cache->blocks[cache->count++] = free_list_pop(slab);
+	}
+	k_spin_unlock(&cache->lock, key);
+}
+
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[arch_curr_cpu()->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	bool found = false;
+
+	if (likely(cache->count > 0U)) {
+		*mem = cache->blocks[--cache->count];
+		found = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return found;
+}
+
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[arch_curr_cpu()->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	void *batch[CACHE_BATCH];
+	bool resched = false;
+	uint32_t n = 0U;
+
+	/*
+	 * A thread about to pend sets cache_bypass before reclaiming the
+	 * caches, so checking it under the cache lock guarantees the block
+	 * is either reclaimed or handed over by the slow path.
+	 */
+	if (atomic_get(&slab->cache_bypass) != 0) {
+		k_spin_unlock(&cache->lock, key);
+		arch_irq_unlock(irq_key);
+		return false;
+	}
+
+	if (unlikely(cache->count == CONFIG_MEM_SLAB_PER_CPU_CACHE_SIZE)) {
+		while (n < CACHE_BATCH) {
+			batch[n++] = cache->blocks[--cache->count];
+		}
+	}
+	cache->blocks[cache->count++] = mem;
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+
+	if (n > 0U) {
+		key = k_spin_lock(&slab->lock);
+		while (n > 0U) {
+			resched = free_list_push(slab, batch[--n]) || resched;
+		}
+		if (resched) {
+			z_reschedule(&slab->lock, key);
+		} else {
+			k_spin_unlock(&slab->lock, key);
+		}
+	}
+
+	return true;
+}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
 	int result;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (likely(cache_alloc(slab, mem))) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
+	key = k_spin_lock(&slab->lock);
+
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (slab->free_list == NULL) {
+		/* Other CPUs may still hold free blocks in their caches */
+		bool may_wait = !K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+				IS_ENABLED(CONFIG_MULTITHREADING);
+
+		if (may_wait) {
+			atomic_set(&slab->cache_bypass, 1);
+		}
+		cache_reclaim_all(slab);
+		if ((slab->free_list != NULL) &&
+		    z_waitq_head(&slab->wait_q) == NULL) {
+			atomic_clear(&slab->cache_bypass);
+		}
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
-		*mem = slab->free_list;
-		slab->free_list = *(char **)(slab->free_list);
-		slab->info.num_used++;
-		__ASSERT((slab->free_list == NULL &&
-			  slab->info.num_used == slab->info.num_blocks) ||
-			 slab_ptr_is_good(slab, slab->free_list),
-			 "slab corruption detected");
+		*mem = free_list_pop(slab);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->info.max_used = MAX(slab->info.num_used,
+		slab->info.max_used = MAX(k_mem_slab_num_used_get(slab),
 					  slab->info.max_used);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+		cache_refill(slab);
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
 		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
@@ -275,24 +453,29 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		return;
 	}
 
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (likely(cache_free(slab, mem))) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
-	if (unlikely(slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
-		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+	if (free_list_push(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
-		if (unlikely(pending_thread != NULL)) {
-			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		z_reschedule(&slab->lock, key);
+		return;
+	}
 
-			z_thread_return_value_set_with_data(pending_thread, 0, mem);
-			z_ready_thread(pending_thread);
-			z_reschedule(&slab->lock, key);
-			return;
-		}
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (z_waitq_head(&slab->wait_q) == NULL) {
+		atomic_clear(&slab->cache_bypass);
 	}
-	*(char **) mem = slab->free_list;
-	slab->free_list = (char *) mem;
-	slab->info.num_used--;
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
@@ -307,8 +490,9 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) *
+				 slab->info.block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) *
 			    slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
@@ -331,7 +515,7 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 
 	k_spin_unlock(&slab->lock, key);
 
@@ -1244,6 +1244,50 @@ static inline void do_backing_store_page_in(uintptr_t location)
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 }
 
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+__weak void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations,
+						     const uintptr_t *phys, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		arch_mem_scratch(phys[i]);
+		k_mem_paging_backing_store_page_in(locations[i]);
+	}
+}
+
+static inline void do_backing_store_page_in_batch(const uintptr_t *locations,
+						  const uintptr_t *phys, size_t count)
+{
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+	uint32_t time_diff;
+
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	timing_t time_start, time_end;
+
+	time_start = timing_counter_get();
+#else
+	uint32_t time_start;
+
+	time_start = k_cycle_get_32();
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
+	k_mem_paging_backing_store_page_in_batch(locations, phys, count);
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	time_end = timing_counter_get();
+	time_diff = (uint32_t)timing_cycles_get(&time_start, &time_end);
+#else
+	time_diff = k_cycle_get_32() - time_start;
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+
+	/* A batch is accounted for as a single page-in */
+	z_paging_histogram_inc(&z_paging_histogram_backing_store_page_in,
+			       time_diff);
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+}
+#endif /* CONFIG_DEMAND_PAGING_FAULT_AROUND */
+
 static inline void do_backing_store_page_out(uintptr_t location)
 {
 #ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
@@ -1610,16 +1654,205 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
-static bool do_page_fault(void *addr, bool pin)
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+#define PAGE_FAULT_BATCH CONFIG_DEMAND_PAGING_FAULT_AROUND_PAGES
+#else
+#define PAGE_FAULT_BATCH 1
+#endif /* CONFIG_DEMAND_PAGING_FAULT_AROUND */
+
+/* Data pages paged in by a page fault, the faulting one first */
+struct page_fault_batch {
+	void *addr[PAGE_FAULT_BATCH];
+	struct k_mem_page_frame *pf[PAGE_FAULT_BATCH];
+	uintptr_t phys[PAGE_FAULT_BATCH];
+	uintptr_t page_in_location[PAGE_FAULT_BATCH];
+	uintptr_t page_out_location[PAGE_FAULT_BATCH];
+	bool dirty[PAGE_FAULT_BATCH];
+	size_t count;
+};
+
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+/* First page after the pages paged in by the previous page fault */
+static uint8_t *fault_around_next;
+
+static inline void paging_stats_readahead_inc(struct k_thread *faulting_thread,
+					      bool sequential, size_t pages)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	if (sequential) {
+		paging_stats.readahead.hits++;
+	} else {
+		paging_stats.readahead.misses++;
+	}
+	paging_stats.readahead.pages += pages;
+
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	if (sequential) {
+		faulting_thread->paging_stats.readahead.hits++;
+	} else {
+		faulting_thread->paging_stats.readahead.misses++;
+	}
+	faulting_thread->paging_stats.readahead.pages += pages;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#else
+	ARG_UNUSED(faulting_thread);
+	ARG_UNUSED(sequential);
+	ARG_UNUSED(pages);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+/* Only data pages retrieved from the backing store are worth batching */
+static inline bool fault_around_location(uintptr_t location)
+{
+#ifdef CONFIG_DEMAND_MAPPING
+	return location != ARCH_UNPAGED_ANON_ZERO &&
+	       location != ARCH_UNPAGED_ANON_UNINIT;
+#else
+	ARG_UNUSED(location);
+
+	return true;
+#endif /* CONFIG_DEMAND_MAPPING */
+}
+
+/*
+ * If the faulting page is at most a window past the pages paged in by the
+ * previous page fault, add the paged out pages following it to the batch.
+ * Returns whether the page fault was detected as sequential.
+ */
+static bool fault_around_collect(struct page_fault_batch *batch)
+{
+	uint8_t *addr = batch->addr[0];
+	uint8_t *next;
+	uintptr_t location;
+
+	if ((uintptr_t)addr < (uintptr_t)fault_around_next ||
+	    (uintptr_t)addr - (uintptr_t)fault_around_next >=
+	    PAGE_FAULT_BATCH * CONFIG_MMU_PAGE_SIZE) {
+		return false;
+	}
+
+	if (!fault_around_location(batch->page_in_location[0])) {
+		return true;
+	}
+
+	while (batch->count < PAGE_FAULT_BATCH) {
+		next = addr + batch->count * CONFIG_MMU_PAGE_SIZE;
+
+		/* Stop at the scratch page, the end of the mapping and resident pages */
+		if (next >= (uint8_t *)K_MEM_SCRATCH_PAGE ||
+		    arch_page_location_get(next, &location) != ARCH_PAGE_LOCATION_PAGED_OUT ||
+		    !fault_around_location(location)) {
+			break;
+		}
+
+		batch->addr[batch->count] = next;
+		batch->page_in_location[batch->count] = location;
+		batch->count++;
+	}
+
+	return true;
+}
+#endif /* CONFIG_DEMAND_PAGING_FAULT_AROUND */
+
+/*
+ * Get and prepare page frames for the data pages of the batch. Pages after
+ * the faulting one are dropped from the batch if there is no page frame or
+ * backing store location left for them, as the backing store keeps a
+ * location for page faults only.
+ */
+static void page_fault_frames_get_locked(struct page_fault_batch *batch,
+					 struct k_thread *faulting_thread)
 {
+	struct k_mem_page_frame *pf;
+	bool page_fault;
+	bool evicted;
+	bool dirty;
+	int ret;
+
+	for (size_t i = 0; i < batch->count; i++) {
+		page_fault = i == 0;
+		dirty = false;
+
+		pf = free_page_frame_list_get();
+		evicted = pf == NULL;
+		if (evicted) {
+			/* Need to evict a page frame */
+			pf = do_eviction_select(&dirty);
+			__ASSERT(pf != NULL || !page_fault, "failed to get a page frame");
+			if (pf == NULL) {
+				batch->count = i;
+				break;
+			}
+
+			LOG_DBG("evicting %p at 0x%lx",
+				k_mem_page_frame_to_virt(pf),
+				k_mem_page_frame_to_phys(pf));
+		}
+
+		ret = page_frame_prepare_locked(pf, &dirty, page_fault,
+						&batch->page_out_location[i]);
+		__ASSERT(ret == 0 || !page_fault, "failed to prepare page frame");
+		if (ret != 0) {
+			/* Only evicted page frames can fail, and they are left as is */
+			batch->count = i;
+			break;
+		}
+
+		if (evicted) {
+			paging_stats_eviction_inc(faulting_thread, dirty);
+		}
+
+#ifndef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		if (batch->count > 1) {
+			/* Keep the page frame from being selected again */
+			k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_BUSY);
+		}
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+		batch->pf[i] = pf;
+		batch->phys[i] = k_mem_page_frame_to_phys(pf);
+		batch->dirty[i] = dirty;
+	}
+}
+
+static void page_fault_transfer(struct page_fault_batch *batch)
+{
+	if (batch->count == 1) {
+		/* The scratch page is already mapped to the page frame */
+		if (batch->dirty[0]) {
+			do_backing_store_page_out(batch->page_out_location[0]);
+		}
+		do_backing_store_page_in(batch->page_in_location[0]);
+		return;
+	}
+
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+	for (size_t i = 0; i < batch->count; i++) {
+		if (batch->dirty[i]) {
+			arch_mem_scratch(batch->phys[i]);
+			do_backing_store_page_out(batch->page_out_location[i]);
+		}
+	}
+
+	do_backing_store_page_in_batch(batch->page_in_location, batch->phys,
+				       batch->count);
+#endif /* CONFIG_DEMAND_PAGING_FAULT_AROUND */
+}
+
+static bool do_page_fault(void *addr, bool pin, bool fault_around)
+{
+	struct page_fault_batch batch;
 	struct k_mem_page_frame *pf;
 	k_spinlock_key_t key;
-	uintptr_t page_in_location, page_out_location;
+	uintptr_t page_in_location;
 	enum arch_page_location status;
 	bool result;
-	bool dirty = false;
 	struct k_thread *faulting_thread;
-	int ret;
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+	bool sequential;
+#endif /* CONFIG_DEMAND_PAGING_FAULT_AROUND */
 
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
 		 addr);
@@ -1710,19 +1943,26 @@ static bool do_page_fault(void *addr, bool pin)
 
 	paging_stats_faults_inc(faulting_thread, key.key);
 
-	pf = free_page_frame_list_get();
-	if (pf == NULL) {
-		/* Need to evict a page frame */
-		pf = do_eviction_select(&dirty);
-		__ASSERT(pf != NULL, "failed to get a page frame");
-		LOG_DBG("evicting %p at 0x%lx",
-			k_mem_page_frame_to_virt(pf),
-			k_mem_page_frame_to_phys(pf));
+	/* The faulting address may point anywhere in the page, while the pages
+	 * collected around it and the next expected fault are page aligned
+	 */
+	batch.addr[0] = UINT_TO_POINTER(ROUND_DOWN(POINTER_TO_UINT(addr), CONFIG_MMU_PAGE_SIZE));
+	batch.page_in_location[0] = page_in_location;
+	batch.count = 1;
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+	sequential = fault_around && fault_around_collect(&batch);
+#else
+	ARG_UNUSED(fault_around);
+#endif /* CONFIG_DEMAND_PAGING_FAULT_AROUND */
+
+	page_fault_frames_get_locked(&batch, faulting_thread);
 
-		paging_stats_eviction_inc(faulting_thread, dirty);
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+	if (fault_around) {
+		fault_around_next = (uint8_t *)batch.addr[0] + batch.count * CONFIG_MMU_PAGE_SIZE;
+		paging_stats_readahead_inc(faulting_thread, sequential, batch.count - 1);
 	}
-	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
-	__ASSERT(ret == 0, "failed to prepare page frame");
+#endif /* CONFIG_DEMAND_PAGING_FAULT_AROUND */
 
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	k_spin_unlock(&z_mm_lock, key);
@@ -1731,25 +1971,26 @@ static bool do_page_fault(void *addr, bool pin)
 	 * locked.
 	 */
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
-	if (dirty) {
-		do_backing_store_page_out(page_out_location);
-	}
-	do_backing_store_page_in(page_in_location);
-
+	page_fault_transfer(&batch);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	key = k_spin_lock(&z_mm_lock);
-	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
-	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_MAPPED);
-	frame_mapped_set(pf, addr);
-	if (pin) {
-		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_PINNED);
-	}
 
-	arch_mem_page_in(addr, k_mem_page_frame_to_phys(pf));
-	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
-	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
-		k_mem_paging_eviction_add(pf);
+	for (size_t i = 0; i < batch.count; i++) {
+		pf = batch.pf[i];
+
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_MAPPED);
+		frame_mapped_set(pf, batch.addr[i]);
+		if (pin) {
+			k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_PINNED);
+		}
+
+		arch_mem_page_in(batch.addr[i], batch.phys[i]);
+		k_mem_paging_backing_store_page_finalize(pf, batch.page_in_location[i]);
+		if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
+			k_mem_paging_eviction_add(pf);
+		}
 	}
 out:
 	k_spin_unlock(&z_mm_lock, key);
@@ -1768,7 +2009,7 @@ static void do_page_in(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, false);
+	ret = do_page_fault(addr, false, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1785,7 +2026,7 @@ static void do_mem_pin(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, true);
+	ret = do_page_fault(addr, true, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1800,7 +2041,7 @@ void k_mem_pin(void *addr, size_t size)
 
 bool k_mem_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	return do_page_fault(addr, false, true);
 }
 
 static void do_mem_unpin(void *addr)
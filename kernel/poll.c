@@ -35,10 +35,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -48,6 +49,7 @@ void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 	__ASSERT(type < (BIT(_POLL_NUM_TYPES)), "invalid type\n");
 	__ASSERT(obj != NULL, "must provide an object\n");
 
+	sys_dnode_init(&event->_node);
 	event->poller = NULL;
 	/* event->tag is left uninitialized: the user will set it if needed */
 	event->type = type;
@@ -112,22 +114,33 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no thread of their own and rank behind every thread */
+static inline bool poller_outranks(struct z_poller *a, struct z_poller *b)
+{
+	if (a->mode == MODE_SET) {
+		return false;
+	}
+
+	if (b->mode == MODE_SET) {
+		return true;
+	}
+
+	return z_sched_prio_cmp(poller_thread(a), poller_thread(b)) > 0;
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
 	struct k_poll_event *pending;
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	if ((pending == NULL) || poller_outranks(pending->poller, poller)) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (poller_outranks(poller, pending->poller)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -445,12 +458,17 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
 			retcode = signal_triggered_work(event, state);
+		} else if (poller->mode == MODE_SET) {
+			retcode = signal_poll_set(event, state);
 		} else {
 			/* Poller is not poll or triggered mode. No action needed.*/
 			;
 		}
 
-		poller->is_polling = false;
+		if (poller->mode != MODE_SET) {
+			/* A poll set keeps watching its other events */
+			poller->is_polling = false;
+		}
 
 		if (retcode < 0) {
 			return retcode;
@@ -812,3 +830,111 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+/* must be called with interrupts locked */
+static void poll_set_queue(struct k_poll_set *set, struct k_poll_event *event)
+{
+	struct k_thread *thread;
+
+	sys_dlist_append(&set->ready, &event->_node);
+
+	thread = z_unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+}
+
+/* must be called with interrupts locked */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	ARG_UNUSED(state);
+
+	/* The object already unlinked the event from its poll_events list,
+	 * so the node is free to move to the ready list of the set.
+	 */
+	poll_set_queue(CONTAINER_OF(event->poller, struct k_poll_set, poller), event);
+
+	return 0;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = true;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+}
+
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t state;
+
+	__ASSERT(!sys_dnode_is_linked(&event->_node), "event already in use\n");
+
+	if (is_condition_met(event, &state)) {
+		set_event_ready(event, state);
+		poll_set_queue(set, event);
+		z_reschedule(&lock, key);
+		return;
+	}
+
+	register_event(event, &set->poller);
+	k_spin_unlock(&lock, key);
+}
+
+void k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	ARG_UNUSED(set);
+
+	/* Unlinks the event from either the polled object or the ready list */
+	clear_event_registration(event);
+
+	k_spin_unlock(&lock, key);
+}
+
+int k_poll_set_wait(struct k_poll_set *set, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int ret;
+
+	key = k_spin_lock(&lock);
+
+	while (sys_dlist_is_empty(&set->ready)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		__ASSERT(!arch_is_in_isr(), "");
+
+		ret = z_pend_curr(&lock, key, &set->wait_q, timeout);
+		if (ret != 0) {
+			return ret;
+		}
+
+		/* Another waiter may have drained the list in the meantime */
+		key = k_spin_lock(&lock);
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+struct k_poll_event *k_poll_set_get(struct k_poll_set *set)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_poll_event *event;
+
+	event = (struct k_poll_event *)sys_dlist_get(&set->ready);
+
+	k_spin_unlock(&lock, key);
+
+	return event;
+}
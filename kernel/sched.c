@@ -59,6 +59,8 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -67,25 +69,209 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_PER_CPU_RUNQ */
+}
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= 32, "run queue mask is 32 bits wide");
+
+/* CPUs whose run queue holds at least one thread. Like the run queues
+ * themselves, it is protected by _sched_spinlock.
+ */
+static uint32_t runq_busy_mask;
+
+static ALWAYS_INLINE bool thread_runs_on_cpu(struct k_thread *thread, unsigned int cpu)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return (thread->base.cpu_mask & BIT(cpu)) != 0;
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(cpu);
+	return true;
+#endif /* CONFIG_SCHED_CPU_MASK */
+}
+
+static ALWAYS_INLINE bool runq_is_empty(void *runq)
+{
+#if defined(CONFIG_SCHED_SIMPLE)
+	return sys_dlist_is_empty(runq);
+#elif defined(CONFIG_SCHED_SCALABLE)
+	return z_priq_rb_best(runq) == NULL;
+#else
+	return z_priq_mq_best(runq) == NULL;
+#endif /* CONFIG_SCHED_SIMPLE */
+}
+
+/* The thread the CPU is about to run: the thread placed on its queue
+ * to run there right away, until the CPU reschedules or the thread
+ * leaves the queue, otherwise its current thread.
+ */
+static ALWAYS_INLINE struct k_thread *cpu_next_thread(unsigned int cpu)
+{
+	struct k_thread *cpu_thread = _kernel.cpus[cpu].current;
+	struct k_thread *placed = _kernel.cpus[cpu].runq_placed;
+
+	if ((placed != NULL) &&
+	    ((cpu_thread == NULL) || z_is_idle_thread_object(cpu_thread) ||
+	     (z_sched_prio_cmp(placed, cpu_thread) > 0))) {
+		return placed;
+	}
+
+	return cpu_thread;
 }
 
+/* True if the thread would get to run right away on the CPU, i.e.
+ * the CPU is idle or the thread it is about to run would be
+ * preempted.
+ */
+static ALWAYS_INLINE bool cpu_can_take(unsigned int cpu, struct k_thread *thread)
+{
+	struct k_thread *cpu_thread = cpu_next_thread(cpu);
+
+	if ((cpu_thread == NULL) || !thread_runs_on_cpu(thread, cpu)) {
+		return false;
+	}
+
+	return z_is_idle_thread_object(cpu_thread) || thread_is_metairq(thread) ||
+	       (thread_is_preemptible(cpu_thread) &&
+		(z_sched_prio_cmp(thread, cpu_thread) > 0));
+}
+
+/* Pick the CPU whose run queue a newly ready thread goes to.  The
+ * CPU it last ran on is preferred while it can take the thread
+ * immediately (its caches are likely still warm), then an idle CPU,
+ * then any CPU running something the thread would preempt.  The
+ * thread is recorded as placed on that CPU, and CPUs with a placed
+ * thread are only picked when no other one can take it, so threads
+ * readied before a CPU reschedules spread over the CPUs.  If no CPU
+ * can run it now it stays with its last CPU, from where it will be
+ * stolen by the first CPU to reschedule.
+ */
+static ALWAYS_INLINE uint8_t runq_select_cpu(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int last = thread->base.cpu;
+	int cpu = -1;
+
+	if ((last < num_cpus) && (_kernel.cpus[last].runq_placed == NULL) &&
+	    cpu_can_take(last, thread)) {
+		cpu = last;
+	}
+
+	for (unsigned int i = 0; (cpu < 0) && (i < num_cpus); i++) {
+		if (cpu_can_take(i, thread) && z_is_idle_thread_object(cpu_next_thread(i))) {
+			cpu = i;
+		}
+	}
+
+	for (unsigned int i = 0; (cpu < 0) && (i < num_cpus); i++) {
+		if ((_kernel.cpus[i].runq_placed == NULL) && cpu_can_take(i, thread)) {
+			cpu = i;
+		}
+	}
+
+	for (unsigned int i = 0; (cpu < 0) && (i < num_cpus); i++) {
+		if (cpu_can_take(i, thread)) {
+			cpu = i;
+		}
+	}
+
+	if (cpu >= 0) {
+		_kernel.cpus[cpu].runq_placed = thread;
+		return cpu;
+	}
+
+	if ((last < num_cpus) && thread_runs_on_cpu(thread, last)) {
+		return last;
+	}
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (thread_runs_on_cpu(thread, i)) {
+			return i;
+		}
+	}
+
+	return 0;
+}
+
+/* The best thread this CPU may run, taken from any CPU's run queue.
+ * The local queue wins ties so that threads only migrate when
+ * another CPU holds strictly more important work.  Only queues
+ * holding threads are looked at, which usually are few.
+ */
+static ALWAYS_INLINE struct k_thread *runq_best_steal(void)
+{
+	unsigned int id = _current_cpu->id;
+	uint32_t mask = runq_busy_mask & ~BIT(id);
+	struct k_thread *best = NULL;
+
+	if ((runq_busy_mask & BIT(id)) != 0U) {
+		best = _priq_run_best(&_kernel.cpus[id].ready_q.runq);
+	}
+
+	while (mask != 0U) {
+		unsigned int i = u32_count_trailing_zeros(mask);
+		struct k_thread *thread = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+
+		mask &= ~BIT(i);
+
+		if ((thread != NULL) &&
+		    ((best == NULL) || (z_sched_prio_cmp(thread, best) > 0))) {
+			best = thread;
+		}
+	}
+
+	return best;
+}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	thread->base.runq_cpu = runq_select_cpu(thread);
+	runq_busy_mask |= BIT(thread->base.runq_cpu);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 	_priq_run_add(thread_runq(thread), thread);
 }
 
+/* Puts back a thread that was just switched out on the current CPU */
+static ALWAYS_INLINE void runq_requeue(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
+
+	thread->base.runq_cpu = _current_cpu->id;
+	runq_busy_mask |= BIT(thread->base.runq_cpu);
+	_priq_run_add(thread_runq(thread), thread);
+#else
+	runq_add(thread);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+}
+
 static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
 	_priq_run_remove(thread_runq(thread), thread);
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	struct _cpu *cpu = &_kernel.cpus[thread->base.runq_cpu];
+
+	if (cpu->runq_placed == thread) {
+		cpu->runq_placed = NULL;
+	}
+
+	if (runq_is_empty(thread_runq(thread))) {
+		runq_busy_mask &= ~BIT(thread->base.runq_cpu);
+	}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_yield(void)
@@ -95,7 +281,11 @@ static ALWAYS_INLINE void runq_yield(void)
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	return runq_best_steal();
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 /* _current is never in the run queue until context switch on
@@ -116,6 +306,10 @@ static ALWAYS_INLINE void queue_thread(struct k_thread *thread)
 	if (thread == _current) {
 		/* add current to end of queue means "yield" */
 		_current_cpu->swap_ok = true;
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+		/* Goes back on this CPU's queue, see z_requeue_current() */
+		thread->base.runq_cpu = _current_cpu->id;
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 	}
 #endif /* CONFIG_SMP */
 }
@@ -137,7 +331,7 @@ static ALWAYS_INLINE void dequeue_thread(struct k_thread *thread)
 void z_requeue_current(struct k_thread *thread)
 {
 	if (z_is_thread_queued(thread)) {
-		runq_add(thread);
+		runq_requeue(thread);
 	}
 	signal_pending_ipi();
 }
@@ -219,6 +413,11 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 	bool queued = z_is_thread_queued(_current);
 	bool active = !z_is_thread_prevented_from_running(_current);
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* Whatever was placed here is weighed against the others now */
+	_current_cpu->runq_placed = NULL;
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 	if (thread == NULL) {
 		thread = _current_cpu->idle_thread;
 	}
@@ -905,7 +1104,7 @@ void *z_get_next_switch_handle(void *interrupted)
 					flag_ipi(ipi_mask_create(old_thread));
 				}
 #endif
-				runq_add(old_thread);
+				runq_requeue(old_thread);
 			}
 		}
 		old_thread->switch_handle = interrupted;
@@ -947,13 +1146,13 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -11,10 +11,13 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* CONFIG_TIMEOUT_WHEEL */
 
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
@@ -40,6 +43,206 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+/*
+ * Hierarchical timing wheel.  Level n has WHEEL_SLOTS slots, each
+ * spanning WHEEL_SLOTS^n ticks.  A timeout lives on the lowest level
+ * whose slot range contains both the current tick and its expiry, so
+ * level 0 slots only ever hold timeouts due on one exact tick.  As
+ * time moves into a new slot of a higher level, the timeouts in that
+ * slot are cascaded down.  Timeouts too far out for the top level are
+ * kept in an overflow list sorted by expiry.
+ *
+ * In this mode the dticks field of a queued timeout holds its
+ * absolute expiry tick rather than a delta to its predecessor.
+ */
+#define WHEEL_BITS   6
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+
+/* Slot lists are (re)initialized when their pending bit gets set */
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint64_t wheel_pending[WHEEL_LEVELS];
+static sys_dlist_t overflow_list = SYS_DLIST_STATIC_INIT(&overflow_list);
+
+/* Earliest queued timeout, recomputed lazily once invalidated */
+static struct _timeout *wheel_first;
+static bool wheel_first_valid = true;
+
+static unsigned int wheel_level(uint64_t expiry)
+{
+	uint64_t diff = expiry ^ curr_tick;
+	unsigned int level;
+
+	if (diff == 0) {
+		return 0;
+	}
+
+	level = (63U - u64_count_leading_zeros(diff)) / WHEEL_BITS;
+
+	return MIN(level, WHEEL_LEVELS);
+}
+
+static unsigned int wheel_slot(uint64_t expiry, unsigned int level)
+{
+	return (expiry >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+}
+
+static void wheel_insert(struct _timeout *to)
+{
+	uint64_t expiry = to->dticks;
+	unsigned int level = wheel_level(expiry);
+
+	if (level == WHEEL_LEVELS) {
+		struct _timeout *t;
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&overflow_list, t, node) {
+			if ((uint64_t)t->dticks > expiry) {
+				sys_dlist_insert(&t->node, &to->node);
+				return;
+			}
+		}
+		sys_dlist_append(&overflow_list, &to->node);
+		return;
+	}
+
+	unsigned int slot = wheel_slot(expiry, level);
+
+	if ((wheel_pending[level] & BIT64(slot)) == 0U) {
+		sys_dlist_init(&wheel[level][slot]);
+		wheel_pending[level] |= BIT64(slot);
+	}
+
+	sys_dlist_append(&wheel[level][slot], &to->node);
+}
+
+static struct _timeout *wheel_scan_first(void)
+{
+	for (unsigned int level = 0; level < WHEEL_LEVELS; level++) {
+		if (wheel_pending[level] == 0U) {
+			continue;
+		}
+
+		/* No queued timeout is in the past, so the lowest pending
+		 * slot of the lowest non-empty level holds the earliest.
+		 * All timeouts of a level 0 slot are due on the same tick,
+		 * but above level 0 the whole slot has to be searched, which
+		 * is linear in the number of timeouts it holds.
+		 */
+		unsigned int slot = u64_count_trailing_zeros(wheel_pending[level]);
+		struct _timeout *best = NULL;
+		struct _timeout *t;
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&wheel[level][slot], t, node) {
+			if ((best == NULL) || (t->dticks < best->dticks)) {
+				best = t;
+			}
+			if (level == 0U) {
+				break;
+			}
+		}
+
+		return best;
+	}
+
+	sys_dnode_t *n = sys_dlist_peek_head(&overflow_list);
+
+	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
+}
+
+static struct _timeout *first(void)
+{
+	if (!wheel_first_valid) {
+		wheel_first = wheel_scan_first();
+		wheel_first_valid = true;
+	}
+
+	return wheel_first;
+}
+
+static k_ticks_t first_dticks(struct _timeout *t)
+{
+	return t->dticks - curr_tick;
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	unsigned int level = wheel_level(t->dticks);
+
+	sys_dlist_remove(&t->node);
+
+	if (level < WHEEL_LEVELS) {
+		unsigned int slot = wheel_slot(t->dticks, level);
+
+		if (sys_dlist_is_empty(&wheel[level][slot])) {
+			wheel_pending[level] &= ~BIT64(slot);
+		}
+	}
+
+	if (t == wheel_first) {
+		wheel_first_valid = false;
+	}
+}
+
+static void add_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	to->dticks = curr_tick + dticks;
+	wheel_insert(to);
+
+	if (wheel_first_valid &&
+	    ((wheel_first == NULL) || (to->dticks < wheel_first->dticks))) {
+		wheel_first = to;
+	}
+}
+
+/* Moves curr_tick forward, which must not pass the earliest expiry */
+static void advance(k_ticks_t dt)
+{
+	uint64_t old_tick = curr_tick;
+	uint64_t crossed;
+	sys_dnode_t *n;
+
+	curr_tick += dt;
+	crossed = old_tick ^ curr_tick;
+
+	/* Only the slot now current on each level can hold timeouts
+	 * that belong further down: anything in the slots skipped over
+	 * would have expired before the earliest timeout.
+	 */
+	if ((crossed >> (WHEEL_BITS * WHEEL_LEVELS)) != 0U) {
+		while ((n = sys_dlist_peek_head(&overflow_list)) != NULL) {
+			struct _timeout *t = CONTAINER_OF(n, struct _timeout, node);
+
+			if (wheel_level(t->dticks) == WHEEL_LEVELS) {
+				break;
+			}
+			sys_dlist_remove(n);
+			wheel_insert(t);
+		}
+	}
+
+	for (unsigned int level = WHEEL_LEVELS - 1U; level > 0U; level--) {
+		unsigned int slot = wheel_slot(curr_tick, level);
+
+		if (((crossed >> (WHEEL_BITS * level)) == 0U) ||
+		    ((wheel_pending[level] & BIT64(slot)) == 0U)) {
+			continue;
+		}
+
+		wheel_pending[level] &= ~BIT64(slot);
+		while ((n = sys_dlist_get(&wheel[level][slot])) != NULL) {
+			wheel_insert(CONTAINER_OF(n, struct _timeout, node));
+		}
+	}
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return timeout->dticks - curr_tick;
+}
+
+#else
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -54,6 +257,11 @@ static struct _timeout *next(struct _timeout *t)
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
+static k_ticks_t first_dticks(struct _timeout *t)
+{
+	return t->dticks;
+}
+
 static void remove_timeout(struct _timeout *t)
 {
 	if (next(t) != NULL) {
@@ -63,6 +271,51 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+static void add_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	struct _timeout *t;
+
+	to->dticks = dticks;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			return;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	sys_dlist_append(&timeout_list, &to->node);
+}
+
+static void advance(k_ticks_t dt)
+{
+	struct _timeout *t = first();
+
+	if (t != NULL) {
+		t->dticks -= dt;
+	}
+
+	curr_tick += dt;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -90,10 +343,10 @@ static int32_t next_timeout(int32_t ticks_elapsed)
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((int64_t)(first_dticks(to) - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, first_dticks(to) - ticks_elapsed);
 	}
 
 	return ret;
@@ -115,34 +368,22 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+		k_ticks_t dticks;
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
 
 		if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
 			ticks_elapsed = elapsed();
 			has_elapsed = true;
-			to->dticks = timeout.ticks + 1 + ticks_elapsed;
-			ticks = curr_tick + to->dticks;
+			dticks = timeout.ticks + 1 + ticks_elapsed;
+			ticks = curr_tick + dticks;
 		} else {
-			k_ticks_t dticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
-
-			to->dticks = MAX(1, dticks);
+			dticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
+			dticks = MAX(1, dticks);
 			ticks = timeout.ticks;
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		add_timeout(to, dticks);
 
 		if (to == first() && announce_remaining == 0) {
 			if (!has_elapsed) {
@@ -178,21 +419,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -251,12 +477,11 @@ void sys_clock_announce(int32_t ticks)
 	struct _timeout *t;
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && (first_dticks(t) <= announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		int dt = first_dticks(t);
 
-		curr_tick += dt;
-		t->dticks = 0;
+		advance(dt);
 		remove_timeout(t);
 
 		k_spin_unlock(&timeout_lock, key);
@@ -265,11 +490,7 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
-	}
-
-	curr_tick += announce_remaining;
+	advance(announce_remaining);
 	announce_remaining = 0;
 
 	sys_clock_set_timeout(next_timeout(0), false);
@@ -353,7 +574,33 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_WHEEL
+	/* Wheel positions derive from absolute ticks: requeue everything
+	 * so queued timeouts keep their remaining time.
+	 */
+	K_SPINLOCK(&timeout_lock) {
+		sys_dlist_t pending;
+		struct _timeout *t;
+		sys_dnode_t *n;
+
+		sys_dlist_init(&pending);
+
+		while ((t = first()) != NULL) {
+			remove_timeout(t);
+			t->dticks -= curr_tick;
+			sys_dlist_append(&pending, &t->node);
+		}
+
+		curr_tick = tick;
+
+		while ((n = sys_dlist_get(&pending)) != NULL) {
+			t = CONTAINER_OF(n, struct _timeout, node);
+			add_timeout(t, t->dticks);
+		}
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_WHEEL */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -238,6 +238,93 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
 	return rv;
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+/* Wake an idle queue of the pool of a busy queue, so that it can take the
+ * work just submitted to the busy queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the busy queue.
+ */
+static void notify_pool_locked(struct k_work_q *queue)
+{
+	struct k_work_pool *pool = queue->pool;
+
+	for (unsigned int i = 0; i < pool->num_queues; i++) {
+		if ((&pool->queues[i] != queue) && notify_queue_locked(&pool->queues[i])) {
+			break;
+		}
+	}
+}
+
+/* Take the oldest work item from another queue of the pool.
+ *
+ * Flushers queued behind the item belong to it and are moved along, so
+ * that they complete only after the item.  Flushers at the head of a
+ * pending list belong to the item running on that queue and stay.  An
+ * item resubmitted while running stays too, as it must not run again
+ * until its handler on that queue has returned, and so do the flushers
+ * behind it.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue that ran out of work.
+ *
+ * @return the node of the work item, now owned by @p queue, or NULL if
+ * there is no work to take.
+ */
+static sys_snode_t *pool_steal_locked(struct k_work_q *queue)
+{
+	struct k_work_pool *pool = queue->pool;
+	unsigned int start = (queue - pool->queues) + 1U;
+
+	for (unsigned int i = 0; i < pool->num_queues; i++) {
+		struct k_work_q *victim = &pool->queues[(start + i) % pool->num_queues];
+		sys_snode_t *prev = NULL;
+		sys_snode_t *node;
+		sys_snode_t *next;
+		struct k_work *work;
+
+		if (victim == queue) {
+			continue;
+		}
+
+		for (node = sys_slist_peek_head(&victim->pending); node != NULL;
+		     node = sys_slist_peek_next(node)) {
+			work = CONTAINER_OF(node, struct k_work, node);
+			if (!flag_test(&work->flags, K_WORK_FLUSHING_BIT) &&
+			    !flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+				break;
+			}
+			prev = node;
+		}
+
+		if (node == NULL) {
+			continue;
+		}
+
+		work = CONTAINER_OF(node, struct k_work, node);
+		sys_slist_remove(&victim->pending, prev, node);
+		work->queue = queue;
+
+		next = (prev != NULL) ? sys_slist_peek_next(prev)
+				      : sys_slist_peek_head(&victim->pending);
+		while ((next != NULL) &&
+		       flag_test(&CONTAINER_OF(next, struct k_work, node)->flags,
+				 K_WORK_FLUSHING_BIT)) {
+			sys_slist_remove(&victim->pending, prev, next);
+			sys_slist_append(&queue->pending, next);
+			next = (prev != NULL) ? sys_slist_peek_next(prev)
+					      : sys_slist_peek_head(&victim->pending);
+		}
+
+		return node;
+	}
+
+	return NULL;
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 /* Submit an work item to a queue if queue state allows new work.
  *
  * Submission is rejected if no queue is provided, or if the queue is
@@ -285,7 +372,13 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else {
 		sys_slist_append(&queue->pending, &work->node);
 		ret = 1;
+#if defined(CONFIG_WORKQUEUE_POOL)
+		if (!notify_queue_locked(queue) && (queue->pool != NULL)) {
+			notify_pool_locked(queue);
+		}
+#else
 		(void)notify_queue_locked(queue);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 	}
 
 	return ret;
@@ -668,6 +761,12 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 
 		/* Check for and prepare any new work. */
 		node = sys_slist_get(&queue->pending);
+#if defined(CONFIG_WORKQUEUE_POOL)
+		if ((node == NULL) && (queue->pool != NULL) &&
+		    !flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
+			node = pool_steal_locked(queue);
+		}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
@@ -809,20 +908,19 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	work_queue_main(queue, NULL, NULL);
 }
 
-void k_work_queue_start(struct k_work_q *queue,
-			k_thread_stack_t *stack,
-			size_t stack_size,
-			int prio,
-			const struct k_work_queue_config *cfg)
+/* Start a work queue thread, optionally pinned to a CPU.
+ *
+ * @param cpu the CPU to pin the thread to, or -1 to not pin it.
+ */
+static void work_queue_start(struct k_work_q *queue,
+			     k_thread_stack_t *stack,
+			     size_t stack_size,
+			     int prio,
+			     const struct k_work_queue_config *cfg,
+			     int cpu)
 {
-	__ASSERT_NO_MSG(queue);
-	__ASSERT_NO_MSG(stack);
-	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
-
 	uint32_t flags = K_WORK_QUEUE_STARTED;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
-
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
@@ -849,6 +947,14 @@ void k_work_queue_start(struct k_work_q *queue,
 		queue->thread.base.user_options |= K_ESSENTIAL;
 	}
 
+#if defined(CONFIG_SCHED_CPU_MASK)
+	if (cpu >= 0) {
+		(void)k_thread_cpu_pin(&queue->thread, cpu);
+	}
+#else
+	ARG_UNUSED(cpu);
+#endif /* defined(CONFIG_SCHED_CPU_MASK) */
+
 #if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
 	if ((cfg != NULL) && (cfg->work_timeout_ms)) {
 		queue->work_timeout = K_MSEC(cfg->work_timeout_ms);
@@ -859,6 +965,21 @@ void k_work_queue_start(struct k_work_q *queue,
 
 	k_thread_start(&queue->thread);
 	queue->thread_id = &queue->thread;
+}
+
+void k_work_queue_start(struct k_work_q *queue,
+			k_thread_stack_t *stack,
+			size_t stack_size,
+			int prio,
+			const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(stack);
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	work_queue_start(queue, stack, stack_size, prio, cfg, -1);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
@@ -950,6 +1071,148 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	return 0;
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+
+/* Queue of the calling CPU.
+ *
+ * Invoked with work lock held.
+ */
+static struct k_work_q *pool_queue_locked(struct k_work_pool *pool)
+{
+	if (pool->num_queues == 0U) {
+		return NULL;
+	}
+
+	return &pool->queues[_current_cpu->id % pool->num_queues];
+}
+
+void k_work_pool_init(struct k_work_pool *pool)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	*pool = (struct k_work_pool) {
+		.num_queues = 0,
+	};
+}
+
+void k_work_pool_start(struct k_work_pool *pool, k_thread_stack_t *stacks, size_t stack_size,
+		       int prio, const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(stacks != NULL);
+	__ASSERT_NO_MSG(pool->num_queues == 0U);
+
+	size_t stride = K_THREAD_STACK_LEN(stack_size);
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_work_q *queue = &pool->queues[i];
+
+		queue->pool = pool;
+		work_queue_start(queue, &stacks[stride * i], stack_size, prio, cfg,
+				 (num_cpus > 1U) ? (int)i : -1);
+
+		/* The queue takes part in stealing once it is counted */
+		K_SPINLOCK(&lock) {
+			pool->num_queues = i + 1U;
+		}
+	}
+}
+
+int k_work_pool_submit(struct k_work_pool *pool, struct k_work *work)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(work != NULL);
+	__ASSERT_NO_MSG(work->handler != NULL);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_work_q *queue = pool_queue_locked(pool);
+	int ret = -ENODEV;
+
+	if (queue != NULL) {
+		ret = submit_to_queue_locked(work, &queue);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (ret > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return ret;
+}
+
+int k_work_pool_drain(struct k_work_pool *pool, bool plug)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(!k_is_in_isr());
+
+	bool plugged[CONFIG_MP_MAX_NUM_CPUS];
+	unsigned int num_queues;
+	bool idle;
+	int ret = 0;
+	int rc;
+
+	K_SPINLOCK(&lock) {
+		num_queues = pool->num_queues;
+		for (unsigned int i = 0; i < num_queues; i++) {
+			plugged[i] = flag_test(&pool->queues[i].flags, K_WORK_QUEUE_PLUGGED_BIT);
+		}
+	}
+
+	/* Work taken by another queue may still run after its original
+	 * queue drained, so repeat until all queues are idle at once.  The
+	 * queues stay plugged meanwhile, so that new submissions cannot
+	 * keep this going.
+	 */
+	do {
+		for (unsigned int i = 0; i < num_queues; i++) {
+			rc = k_work_queue_drain(&pool->queues[i], true);
+			if (rc < 0) {
+				return rc;
+			}
+			ret |= rc;
+		}
+
+		K_SPINLOCK(&lock) {
+			idle = true;
+			for (unsigned int i = 0; i < num_queues; i++) {
+				if (flag_test(&pool->queues[i].flags, K_WORK_QUEUE_BUSY_BIT) ||
+				    !sys_slist_is_empty(&pool->queues[i].pending)) {
+					idle = false;
+				}
+			}
+		}
+	} while (!idle);
+
+	if (!plug) {
+		for (unsigned int i = 0; i < num_queues; i++) {
+			if (!plugged[i]) {
+				(void)k_work_queue_unplug(&pool->queues[i]);
+			}
+		}
+	}
+
+	return ret;
+}
+
+int k_work_pool_unplug(struct k_work_pool *pool)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	int ret = -EALREADY;
+
+	for (unsigned int i = 0; i < pool->num_queues; i++) {
+		if (k_work_queue_unplug(&pool->queues[i]) == 0) {
+			ret = 0;
+		}
+	}
+
+	return ret;
+}
+
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 
 /* Timeout handler for delayable work.
@@ -1163,6 +1426,56 @@ int k_work_reschedule_for_queue(struct k_work_q *queue, struct k_work_delayable
 	return ret;
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+
+int k_work_pool_schedule(struct k_work_pool *pool, struct k_work_delayable *dwork,
+			 k_timeout_t delay)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	struct k_work *work = &dwork->work;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_work_q *queue = pool_queue_locked(pool);
+	int ret = 0;
+
+	if (queue == NULL) {
+		ret = -ENODEV;
+	} else if ((work_busy_get_locked(work) & ~K_WORK_RUNNING) == 0U) {
+		/* Schedule the work item if it's idle or running. */
+		ret = schedule_for_queue_locked(&queue, dwork, delay);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+int k_work_pool_reschedule(struct k_work_pool *pool, struct k_work_delayable *dwork,
+			   k_timeout_t delay)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_work_q *queue = pool_queue_locked(pool);
+	int ret = -ENODEV;
+
+	if (queue != NULL) {
+		/* Remove any active scheduling. */
+		(void)unschedule_locked(dwork);
+
+		/* Schedule the work item with the new parameters. */
+		ret = schedule_for_queue_locked(&queue, dwork, delay);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 int k_work_reschedule(struct k_work_delayable *dwork, k_timeout_t delay)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, reschedule, dwork, delay);
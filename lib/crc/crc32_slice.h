@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC32_SLICE_H_
+#define ZEPHYR_LIB_CRC_CRC32_SLICE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/byteorder.h>
+
+#if defined(CONFIG_CRC32_SLICE_BY_8)
+#define CRC32_SLICE_COUNT 8
+#elif defined(CONFIG_CRC32_SLICE_BY_4)
+#define CRC32_SLICE_COUNT 4
+#endif
+
+#ifdef CRC32_SLICE_COUNT
+/*
+ * Slice-by-N update of a reflected 32-bit CRC register.  table[0] is
+ * the usual byte-wise table, table[k] gives the contribution of a byte
+ * followed by k zero bytes, which lets N input bytes be folded in with
+ * N independent lookups.
+ */
+static inline uint32_t crc32_slice_update(const uint32_t table[][256], uint32_t crc,
+					  const uint8_t *data, size_t len)
+{
+	for (; len >= CRC32_SLICE_COUNT; len -= CRC32_SLICE_COUNT) {
+		uint32_t lo = sys_get_le32(data) ^ crc;
+
+		crc = table[CRC32_SLICE_COUNT - 1][lo & 0xff] ^
+		      table[CRC32_SLICE_COUNT - 2][(lo >> 8) & 0xff] ^
+		      table[CRC32_SLICE_COUNT - 3][(lo >> 16) & 0xff] ^
+		      table[CRC32_SLICE_COUNT - 4][lo >> 24];
+
+#if CRC32_SLICE_COUNT > 4
+		uint32_t hi = sys_get_le32(data + 4);
+
+		crc ^= table[3][hi & 0xff] ^
+		       table[2][(hi >> 8) & 0xff] ^
+		       table[1][(hi >> 16) & 0xff] ^
+		       table[0][hi >> 24];
+#endif /* CRC32_SLICE_COUNT > 4 */
+
+		data += CRC32_SLICE_COUNT;
+	}
+
+	for (; len > 0; len--) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xff];
+		data++;
+	}
+
+	return crc;
+}
+#endif /* CRC32_SLICE_COUNT */
+
+#endif /* ZEPHYR_LIB_CRC_CRC32_SLICE_H_ */
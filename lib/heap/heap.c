@@ -160,6 +160,99 @@ static chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
 	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+/* Small chunks are not merged back into the heap when freed.  They stay
+ * marked used, so neighbors never merge with them either, and are kept
+ * on a LIFO list of chunks of the exact same size linked through their
+ * FREE_NEXT field.  The next allocation of that size then simply pops
+ * one, with no bucket search and no split.  The lists are flushed back
+ * into the regular free lists whenever an allocation would otherwise
+ * fail, so they never cause an allocation failure on their own.
+ */
+static void size_class_push(struct z_heap *h, chunkid_t c)
+{
+	chunksz_t sz = chunk_size(h, c);
+
+	set_next_free_chunk(h, c, h->size_classes[sz]);
+	h->size_classes[sz] = c;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, sz);
+#endif
+}
+
+static chunkid_t size_class_pop(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t c = h->size_classes[sz];
+
+	if (c != 0U) {
+		h->size_classes[sz] = next_free_chunk(h, c);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		h->free_bytes -= chunksz_to_bytes(h, sz);
+#endif
+	}
+
+	return c;
+}
+
+static bool size_class_free(struct z_heap *h, chunkid_t c)
+{
+	if (chunk_size(h, c) > SIZE_CLASS_CHUNKS) {
+		return false;
+	}
+
+	size_class_push(h, c);
+	return true;
+}
+
+static chunkid_t size_class_alloc(struct z_heap *h, chunksz_t sz)
+{
+	return (sz <= SIZE_CLASS_CHUNKS) ? size_class_pop(h, sz) : 0;
+}
+
+/* Return every parked chunk to the free lists, true if there were any */
+static bool size_class_flush(struct z_heap *h)
+{
+	bool flushed = false;
+
+	for (chunksz_t sz = 0; sz < SIZE_CLASS_HEADS; sz++) {
+		chunkid_t c;
+
+		while ((c = size_class_pop(h, sz)) != 0U) {
+			set_chunk_used(h, c, false);
+			free_chunk(h, c);
+			flushed = true;
+		}
+	}
+
+	return flushed;
+}
+#else
+static inline bool size_class_free(struct z_heap *h, chunkid_t c)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(c);
+
+	return false;
+}
+
+static inline chunkid_t size_class_alloc(struct z_heap *h, chunksz_t sz)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(sz);
+
+	return 0;
+}
+
+static inline bool size_class_flush(struct z_heap *h)
+{
+	ARG_UNUSED(h);
+
+	return false;
+}
+#endif /* CONFIG_SYS_HEAP_SIZE_CLASSES */
+
 void sys_heap_free(struct sys_heap *heap, void *mem)
 {
 	if (mem == NULL) {
@@ -184,7 +277,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,6 +286,11 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+	if (size_class_free(h, c)) {
+		return;
+	}
+
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -257,6 +354,11 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 		return c;
 	}
 
+	/* Last resort: small chunks parked on the size class lists */
+	if (size_class_flush(h)) {
+		return alloc_chunk(h, sz);
+	}
+
 	return 0;
 }
 
@@ -270,19 +372,22 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes, 0);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
+	chunkid_t c = size_class_alloc(h, chunk_sz);
 
 	if (c == 0U) {
-		return NULL;
-	}
+		c = alloc_chunk(h, chunk_sz);
+		if (c == 0U) {
+			return NULL;
+		}
 
-	/* Split off remainder if any */
-	if (chunk_size(h, c) > chunk_sz) {
-		split_chunks(h, c, c + chunk_sz);
-		free_list_add(h, c + chunk_sz);
-	}
+		/* Split off remainder if any */
+		if (chunk_size(h, c) > chunk_sz) {
+			split_chunks(h, c, c + chunk_sz);
+			free_list_add(h, c + chunk_sz);
+		}
 
-	set_chunk_used(h, c, true);
+		set_chunk_used(h, c, true);
+	}
 
 	mem = chunk_mem(h, c);
 
@@ -571,6 +676,12 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	for (int i = 0; i < SIZE_CLASS_HEADS; i++) {
+		h->size_classes[i] = 0;
+	}
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
@@ -65,6 +65,18 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+/* Largest chunk size (in chunk units, header included) that is kept
+ * on a size class list.  Big heap headers are assumed so that a
+ * CONFIG_SYS_HEAP_SIZE_CLASS_MAX byte request always qualifies.
+ */
+#define SIZE_CLASS_CHUNKS \
+	((CONFIG_SYS_HEAP_SIZE_CLASS_MAX + 8U + CHUNK_UNIT - 1U) / CHUNK_UNIT)
+
+/* One list head per chunk size, padded to keep the buckets 8 byte aligned */
+#define SIZE_CLASS_HEADS ROUND_UP(SIZE_CLASS_CHUNKS + 1U, 2U)
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +85,9 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	chunkid_t size_classes[SIZE_CLASS_HEADS];
 #endif
 	struct z_heap_bucket buckets[0];
 };
@@ -279,6 +294,16 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/* Chunks parked on a size class list look used but are free */
+	for (chunksz_t sz = 0; sz < SIZE_CLASS_HEADS; sz++) {
+		for (c = h->size_classes[sz]; c != 0U; c = next_free_chunk(h, c)) {
+			*alloc_bytes -= chunksz_to_bytes(h, sz);
+			*free_bytes += chunksz_to_bytes(h, sz);
+		}
+	}
+#endif
 }
 
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
@@ -85,6 +85,23 @@ bool sys_heap_validate(struct sys_heap *heap)
 		return false;  /* Should have exactly consumed the buffer */
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/* Chunks parked on the size class lists must be valid, still
+	 * marked USED and of the size of their list.
+	 */
+	for (chunksz_t sz = 0; sz < SIZE_CLASS_HEADS; sz++) {
+		chunksz_t n = 0;
+
+		for (c = h->size_classes[sz]; c != 0U; c = next_free_chunk(h, c)) {
+			VALIDATE(++n < h->end_chunk);
+			VALIDATE(in_bounds(h, c));
+			VALIDATE(valid_chunk(h, c));
+			VALIDATE(chunk_used(h, c));
+			VALIDATE(chunk_size(h, c) == sz);
+		}
+	}
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	/*
 	 * Validate sys_heap_runtime_stats_get API.
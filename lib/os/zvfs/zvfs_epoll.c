@@ -0,0 +1,475 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/zvfs/epoll.h>
+
+/* One event for ZVFS_EPOLLIN and one for ZVFS_EPOLLOUT */
+#define ZVFS_EPOLL_ITEM_EVENTS 2
+
+#define ZVFS_EPOLL_ALWAYS (ZVFS_POLLERR | ZVFS_POLLHUP | ZVFS_POLLNVAL)
+
+struct zvfs_epoll_item {
+	/* Poll events of the descriptor, the tag of each event holds its
+	 * index so that a ready event leads back to its item.
+	 */
+	struct k_poll_event events[ZVFS_EPOLL_ITEM_EVENTS];
+	/* Node in the interest list */
+	sys_dnode_t node;
+	/* Node in the rearm or pending list, when listed is set */
+	sys_snode_t rnode;
+	struct zvfs_epoll_event event;
+	int fd;
+	uint8_t num_events;
+	bool listed;
+};
+
+struct zvfs_epoll {
+	struct k_poll_set set;
+	struct k_mutex lock;
+	/* All registered items */
+	sys_dlist_t items;
+	/* Items checked by the last collection, re-armed before waiting */
+	sys_slist_t rearm;
+	/* Items that reported readiness while being armed */
+	sys_slist_t pending;
+};
+
+SYS_BITARRAY_DEFINE_STATIC(epolls_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll epolls[CONFIG_ZVFS_EPOLL_MAX];
+K_MEM_SLAB_DEFINE_STATIC(epoll_items, sizeof(struct zvfs_epoll_item),
+			 CONFIG_ZVFS_EPOLL_MAX_FDS, sizeof(void *));
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static inline struct zvfs_epoll_item *epoll_event_item(struct k_poll_event *pev)
+{
+	return CONTAINER_OF(pev - pev->tag, struct zvfs_epoll_item, events[0]);
+}
+
+static struct zvfs_epoll_item *epoll_find(struct zvfs_epoll *ep, int fd)
+{
+	struct zvfs_epoll_item *item;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&ep->items, item, node) {
+		if (item->fd == fd) {
+			return item;
+		}
+	}
+
+	return NULL;
+}
+
+static void epoll_item_list(sys_slist_t *list, struct zvfs_epoll_item *item)
+{
+	__ASSERT_NO_MSG(!item->listed);
+
+	item->listed = true;
+	sys_slist_append(list, &item->rnode);
+}
+
+static void epoll_item_unlist(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	if (!item->listed) {
+		return;
+	}
+
+	if (!sys_slist_find_and_remove(&ep->rearm, &item->rnode)) {
+		(void)sys_slist_find_and_remove(&ep->pending, &item->rnode);
+	}
+
+	item->listed = false;
+}
+
+static void epoll_item_disarm(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	for (int i = 0; i < item->num_events; i++) {
+		k_poll_set_remove(&ep->set, &item->events[i]);
+	}
+
+	item->num_events = 0;
+}
+
+static int epoll_item_arm(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->event.events,
+	};
+	struct k_poll_event *pev = item->events;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *ctx;
+	int ret;
+
+	epoll_item_disarm(ep, item);
+
+	ctx = zvfs_get_fd_obj_and_vtable(item->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_PREPARE, &pfd, &pev,
+				      item->events + ARRAY_SIZE(item->events));
+	k_mutex_unlock(lock);
+
+	if (ret == -EXDEV) {
+		/* Offloaded sockets are polled by their offload layer */
+		return -EPERM;
+	}
+
+	if (ret < 0 && ret != -EALREADY) {
+		return ret;
+	}
+
+	item->num_events = pev - item->events;
+	for (int i = 0; i < item->num_events; i++) {
+		item->events[i].tag = i;
+		k_poll_set_add(&ep->set, &item->events[i]);
+	}
+
+	if (ret == -EALREADY) {
+		/* Descriptor is ready (EOF, error...) without any of its
+		 * events being available, check it on the next wait.
+		 */
+		epoll_item_list(&ep->pending, item);
+	}
+
+	return 0;
+}
+
+static void epoll_item_free(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	epoll_item_disarm(ep, item);
+	epoll_item_unlist(ep, item);
+	sys_dlist_remove(&item->node);
+	k_mem_slab_free(&epoll_items, item);
+}
+
+static uint32_t epoll_item_update(struct zvfs_epoll_item *item, int *result)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->event.events,
+	};
+	struct k_poll_event *pev = item->events;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *ctx;
+
+	*result = 0;
+
+	ctx = zvfs_get_fd_obj_and_vtable(item->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		return ZVFS_POLLNVAL;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	*result = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_UPDATE, &pfd, &pev);
+	k_mutex_unlock(lock);
+
+	if (*result != 0 && *result != -EAGAIN) {
+		return ZVFS_POLLERR;
+	}
+
+	return pfd.revents & (item->event.events | ZVFS_EPOLL_ALWAYS);
+}
+
+static struct zvfs_epoll_item *epoll_next(struct zvfs_epoll *ep)
+{
+	struct k_poll_event *pev;
+	sys_snode_t *node;
+
+	node = sys_slist_get(&ep->pending);
+	if (node != NULL) {
+		struct zvfs_epoll_item *item = CONTAINER_OF(node, struct zvfs_epoll_item, rnode);
+
+		item->listed = false;
+		return item;
+	}
+
+	while ((pev = k_poll_set_get(&ep->set)) != NULL) {
+		struct zvfs_epoll_item *item = epoll_event_item(pev);
+
+		/* Another event of the item got it checked already */
+		if (!item->listed) {
+			return item;
+		}
+	}
+
+	return NULL;
+}
+
+/* Arm again the items checked by the last collection.  Only those are
+ * re-armed, which keeps the cost of a wait proportional to the number of
+ * ready descriptors.
+ *
+ * Must be called with ep->lock held
+ */
+static void epoll_rearm(struct zvfs_epoll *ep)
+{
+	struct zvfs_epoll_item *item;
+	sys_snode_t *node;
+
+	while ((node = sys_slist_get(&ep->rearm)) != NULL) {
+		item = CONTAINER_OF(node, struct zvfs_epoll_item, rnode);
+		item->listed = false;
+		if (epoll_item_arm(ep, item) < 0) {
+			/* Reported as POLLNVAL or POLLERR by the update */
+			epoll_item_list(&ep->pending, item);
+		}
+	}
+}
+
+/* Must be called with ep->lock held */
+static int epoll_collect(struct zvfs_epoll *ep, struct zvfs_epoll_event *events, int maxevents)
+{
+	struct zvfs_epoll_item *item;
+	sys_slist_t retry;
+	sys_snode_t *node;
+	uint32_t revents;
+	int result;
+	int n = 0;
+
+	sys_slist_init(&retry);
+
+	while (n < maxevents && (item = epoll_next(ep)) != NULL) {
+		revents = epoll_item_update(item, &result);
+		if (result == -EAGAIN) {
+			epoll_item_list(&retry, item);
+			continue;
+		}
+
+		/* Level-triggered: whatever was checked is armed again
+		 * before waiting, the rest stays registered meanwhile.
+		 */
+		epoll_item_list(&ep->rearm, item);
+
+		if (revents != 0) {
+			events[n].events = revents;
+			events[n].data = item->event.data;
+			n++;
+		}
+	}
+
+	while ((node = sys_slist_get(&retry)) != NULL) {
+		item = CONTAINER_OF(node, struct zvfs_epoll_item, rnode);
+		item->listed = false;
+		if (epoll_item_arm(ep, item) < 0) {
+			epoll_item_list(&ep->pending, item);
+		}
+	}
+
+	return n;
+}
+
+int zvfs_epoll_create(int flags)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (sys_bitarray_alloc(&epolls_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&epolls_bitarray, 1, offset);
+		return -1;
+	}
+
+	ep = &epolls[offset];
+	k_poll_set_init(&ep->set);
+	k_mutex_init(&ep->lock);
+	sys_dlist_init(&ep->items);
+	sys_slist_init(&ep->rearm);
+	sys_slist_init(&ep->pending);
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_item *item;
+	struct zvfs_epoll *ep;
+	int ret = 0;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (fd == epfd) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (op != ZVFS_EPOLL_CTL_DEL && event == NULL) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	if (zvfs_get_fd_obj(fd, NULL, EBADF) == NULL) {
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	item = epoll_find(ep, fd);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (item != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		if (k_mem_slab_alloc(&epoll_items, (void **)&item, K_NO_WAIT) < 0) {
+			ret = -ENOMEM;
+			break;
+		}
+
+		memset(item, 0, sizeof(*item));
+		item->fd = fd;
+		item->event = *event;
+		sys_dlist_append(&ep->items, &item->node);
+
+		ret = epoll_item_arm(ep, item);
+		if (ret < 0) {
+			epoll_item_free(ep, item);
+		}
+		break;
+
+	case ZVFS_EPOLL_CTL_MOD:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		item->event = *event;
+		epoll_item_unlist(ep, item);
+		ret = epoll_item_arm(ep, item);
+		break;
+
+	case ZVFS_EPOLL_CTL_DEL:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_item_free(ep, item);
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout)
+{
+	struct zvfs_epoll *ep;
+	k_timepoint_t end;
+	int ret = 0;
+	int n;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	epoll_rearm(ep);
+
+	for (;;) {
+		n = epoll_collect(ep, events, maxevents);
+		if (n > 0 || ret != 0) {
+			break;
+		}
+
+		/* The items just checked found nothing, they have to be armed
+		 * again before blocking or their next event would be missed.
+		 */
+		epoll_rearm(ep);
+		if (!sys_slist_is_empty(&ep->pending)) {
+			continue;
+		}
+
+		k_mutex_unlock(&ep->lock);
+		ret = k_poll_set_wait(&ep->set, sys_timepoint_timeout(end));
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	return n;
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+	sys_dnode_t *node;
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	while ((node = sys_dlist_peek_head(&ep->items)) != NULL) {
+		epoll_item_free(ep, CONTAINER_OF(node, struct zvfs_epoll_item, node));
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	sys_bitarray_free(&epolls_bitarray, 1, ep - epolls);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
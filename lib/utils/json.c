@@ -9,6 +9,7 @@
 #include <errno.h>
 #include <limits.h>
 #include <math.h>
+#include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/printk.h>
 #include <zephyr/sys/util.h>
 #include <stdbool.h>
@@ -18,6 +19,14 @@
 
 #include <zephyr/data/json.h>
 
+#if defined(CONFIG_JSON_LIBRARY_BULK_SCAN) && defined(__SSE2__)
+#define JSON_SCAN_SSE2
+#include <emmintrin.h>
+#elif defined(CONFIG_JSON_LIBRARY_BULK_SCAN) && defined(__ARM_NEON) && defined(__aarch64__)
+#define JSON_SCAN_NEON
+#include <arm_neon.h>
+#endif
+
 struct json_obj_key_value {
 	const char *key;
 	size_t key_len;
@@ -90,12 +99,108 @@ static int peek(struct json_lexer *lex)
 	return chr;
 }
 
+/* Every byte of a word set to 0x01, and to 0x7f */
+#define WORD_ONES ((uintptr_t)-1 / 0xff)
+#define WORD_LOWS (WORD_ONES * 0x7f)
+
+/* Bit 7 of every byte of the word that is chr is set, all others are clear */
+static inline uintptr_t word_bytes_eq(uintptr_t word, char chr)
+{
+	word ^= WORD_ONES * (uint8_t)chr;
+
+	return ~(((word & WORD_LOWS) + WORD_LOWS) | word | WORD_LOWS);
+}
+
+/*
+ * Find the first quote, backslash or NUL (which ends the input of the lexer)
+ * in [pos, end), or end if there is none.
+ */
+static const char *scan_string(const char *pos, const char *end)
+{
+	uintptr_t word;
+
+#if defined(JSON_SCAN_SSE2)
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i backslash = _mm_set1_epi8('\\');
+	const __m128i zero = _mm_setzero_si128();
+	__m128i chunk;
+	unsigned int mask;
+
+	while ((size_t)(end - pos) >= sizeof(chunk)) {
+		chunk = _mm_loadu_si128((const __m128i *)pos);
+		mask = _mm_movemask_epi8(_mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+			_mm_cmpeq_epi8(chunk, zero)));
+		if (mask != 0) {
+			return pos + u32_count_trailing_zeros(mask);
+		}
+
+		pos += sizeof(chunk);
+	}
+#elif defined(JSON_SCAN_NEON)
+	const uint8x16_t quote = vdupq_n_u8('"');
+	const uint8x16_t backslash = vdupq_n_u8('\\');
+	uint8x16_t chunk;
+
+	while ((size_t)(end - pos) >= sizeof(chunk)) {
+		chunk = vld1q_u8((const uint8_t *)pos);
+		chunk = vorrq_u8(vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash)),
+				 vceqzq_u8(chunk));
+		if (vmaxvq_u8(chunk) != 0) {
+			break;
+		}
+
+		pos += sizeof(chunk);
+	}
+#endif
+
+	while ((size_t)(end - pos) >= sizeof(word)) {
+		memcpy(&word, pos, sizeof(word));
+		if ((word_bytes_eq(word, '"') | word_bytes_eq(word, '\\') |
+		     word_bytes_eq(word, '\0')) != 0) {
+			break;
+		}
+
+		pos += sizeof(word);
+	}
+
+	while (pos < end && *pos != '"' && *pos != '\\' && *pos != '\0') {
+		pos++;
+	}
+
+	return pos;
+}
+
+/* Skip whole words of JSON whitespace, the rest is left to the caller */
+static const char *scan_whitespace(const char *pos, const char *end)
+{
+	uintptr_t word;
+
+	while ((size_t)(end - pos) >= sizeof(word)) {
+		memcpy(&word, pos, sizeof(word));
+		if ((word_bytes_eq(word, ' ') | word_bytes_eq(word, '\n') |
+		     word_bytes_eq(word, '\r') | word_bytes_eq(word, '\t')) != WORD_ONES << 7) {
+			break;
+		}
+
+		pos += sizeof(word);
+	}
+
+	return pos;
+}
+
 static void *lexer_string(struct json_lexer *lex)
 {
 	ignore(lex);
 
 	while (true) {
-		int chr = next(lex);
+		int chr;
+
+		if (IS_ENABLED(CONFIG_JSON_LIBRARY_BULK_SCAN)) {
+			lex->pos = (char *)scan_string(lex->pos, lex->end);
+		}
+
+		chr = next(lex);
 
 		if (chr == '\0') {
 			emit(lex, JSON_TOK_ERROR);
@@ -282,6 +387,10 @@ static void *lexer_json(struct json_lexer *lex)
 			__fallthrough;
 		default:
 			if (isspace(chr) != 0) {
+				if (IS_ENABLED(CONFIG_JSON_LIBRARY_BULK_SCAN)) {
+					lex->pos = (char *)scan_whitespace(lex->pos, lex->end);
+				}
+
 				ignore(lex);
 				continue;
 			}
@@ -1189,6 +1298,603 @@ int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_
 	return obj_parse(json, descr, descr_len, val);
 }
 
+#ifdef CONFIG_JSON_LIBRARY_STREAM
+
+enum json_stream_state {
+	JSON_STREAM_VALUE,
+	JSON_STREAM_ELEM_OR_END,
+	JSON_STREAM_KEY_OR_END,
+	JSON_STREAM_KEY,
+	JSON_STREAM_COLON,
+	JSON_STREAM_NEXT,
+	JSON_STREAM_SKIP,
+	JSON_STREAM_DONE,
+	JSON_STREAM_ERROR,
+};
+
+enum json_stream_lex {
+	JSON_STREAM_LEX_NONE,
+	JSON_STREAM_LEX_KEY,
+	JSON_STREAM_LEX_STRING,
+	JSON_STREAM_LEX_WORD,
+};
+
+static void stream_init(struct json_stream *stream, const struct json_obj_descr *descr,
+			void *field, void *val)
+{
+	stream->descr = descr;
+	stream->field = field;
+	stream->val = val;
+	stream->result = 0;
+	stream->skip = 0;
+	stream->depth = 0;
+	stream->state = JSON_STREAM_VALUE;
+	stream->lex = JSON_STREAM_LEX_NONE;
+	stream->hex = 0;
+	stream->backslash = false;
+}
+
+void json_stream_obj_init(struct json_stream *stream, const struct json_obj_descr *descr,
+			  size_t descr_len, void *val)
+{
+	__ASSERT_NO_MSG(descr_len < (sizeof(stream->result) * CHAR_BIT - 1));
+
+	stream->root = (struct json_obj_descr){
+		.type = JSON_TOK_OBJECT_START,
+		.object = {
+			.sub_descr = descr,
+			.sub_descr_len = descr_len,
+		},
+	};
+
+	stream_init(stream, &stream->root, val, val);
+}
+
+void json_stream_arr_init(struct json_stream *stream, const struct json_obj_descr *descr,
+			  void *val)
+{
+	stream_init(stream, descr, (char *)val + descr->offset, val);
+}
+
+static struct json_stream_frame *stream_top(struct json_stream *stream)
+{
+	return stream->depth > 0 ? &stream->frames[stream->depth - 1] : NULL;
+}
+
+static bool is_word_start(char chr)
+{
+	switch (chr) {
+	case '-':
+	case 't':
+	case 'f':
+	case 'n':
+	case 'N':
+	case 'I':
+		return true;
+	default:
+		return isdigit((unsigned char)chr) != 0;
+	}
+}
+
+static bool is_word_char(char chr)
+{
+	return isalnum((unsigned char)chr) != 0 || chr == '.' || chr == '+' || chr == '-';
+}
+
+static void stream_value_end(struct json_stream *stream)
+{
+	stream->state = stream->depth == 0 ? JSON_STREAM_DONE : JSON_STREAM_NEXT;
+}
+
+/* Take the target of the next value and account for it in its container */
+static int stream_value_start(struct json_stream *stream)
+{
+	struct json_stream_frame *frame = stream_top(stream);
+
+	if (frame == NULL) {
+		/* The root, set up at initialization */
+		return 0;
+	}
+
+	if (frame->count == NULL) {
+		if (stream->descr != NULL) {
+			frame->decoded |= (int64_t)1 << (stream->descr - frame->descr);
+		}
+
+		return 0;
+	}
+
+	if (*frame->count == frame->len) {
+		return -ENOSPC;
+	}
+
+	/* Nested arrays find their length relative to their element */
+	stream->descr = frame->descr;
+	stream->field = frame->field;
+	stream->val = frame->descr->type == JSON_TOK_ARRAY_START ? frame->field : frame->val;
+
+	(*frame->count)++;
+	frame->field += frame->elem_size;
+
+	return 0;
+}
+
+static int stream_open(struct json_stream *stream, char chr)
+{
+	const struct json_obj_descr *descr = stream->descr;
+	const struct json_obj_descr *elem_descr;
+	struct json_stream_frame *frame;
+
+	if (descr == NULL) {
+		stream->skip = 1;
+		stream->state = JSON_STREAM_SKIP;
+		return 0;
+	}
+
+	if (descr->type != (chr == '{' ? JSON_TOK_OBJECT_START : JSON_TOK_ARRAY_START)) {
+		return -EINVAL;
+	}
+
+	if (stream->depth == ARRAY_SIZE(stream->frames)) {
+		return -ENOMEM;
+	}
+
+	frame = &stream->frames[stream->depth++];
+
+	if (chr == '{') {
+		*frame = (struct json_stream_frame){
+			.descr = descr->object.sub_descr,
+			.val = stream->field,
+			.len = descr->object.sub_descr_len,
+		};
+		stream->state = JSON_STREAM_KEY_OR_END;
+
+		return 0;
+	}
+
+	elem_descr = descr->array.element_descr;
+
+	*frame = (struct json_stream_frame){
+		.val = stream->val,
+		.field = stream->field,
+		.count = (size_t *)((char *)stream->val + elem_descr->offset),
+		.len = descr->array.n_elements,
+	};
+
+	/* For nested arrays, skip parent descriptor to get elements */
+	if (elem_descr->type == JSON_TOK_ARRAY_START) {
+		elem_descr = elem_descr->array.element_descr;
+	}
+
+	frame->descr = elem_descr;
+	frame->elem_size = get_elem_size(elem_descr);
+	*frame->count = 0;
+
+	__ASSERT_NO_MSG(frame->elem_size > 0);
+
+	stream->state = JSON_STREAM_ELEM_OR_END;
+
+	return 0;
+}
+
+static int stream_close(struct json_stream *stream)
+{
+	struct json_stream_frame *frame = &stream->frames[--stream->depth];
+
+	if (stream->depth == 0 && frame->count == NULL) {
+		stream->result = frame->decoded;
+	}
+
+	stream_value_end(stream);
+
+	return 0;
+}
+
+static int stream_value(struct json_stream *stream, char chr)
+{
+	int ret;
+
+	ret = stream_value_start(stream);
+	if (ret < 0) {
+		return ret;
+	}
+
+	switch (chr) {
+	case '{':
+	case '[':
+		return stream_open(stream, chr);
+	case '"':
+		/* Strings cannot point into a document that is not kept */
+		if (stream->descr != NULL && stream->descr->type != JSON_TOK_STRING_BUF) {
+			return -EINVAL;
+		}
+
+		stream->lex = JSON_STREAM_LEX_STRING;
+		stream->len = 0;
+
+		return 0;
+	default:
+		if (!is_word_start(chr)) {
+			return -EINVAL;
+		}
+
+		stream->lex = JSON_STREAM_LEX_WORD;
+		stream->word[0] = chr;
+		stream->len = 1;
+
+		return 0;
+	}
+}
+
+static void stream_key_start(struct json_stream *stream)
+{
+	struct json_stream_frame *frame = stream_top(stream);
+
+	/* Fields decoded already are skipped, as by json_obj_parse() */
+	stream->keys = BIT64_MASK(frame->len) & ~(uint64_t)frame->decoded;
+	stream->lex = JSON_STREAM_LEX_KEY;
+	stream->len = 0;
+}
+
+/* Drop the fields whose name does not continue with the key */
+static void stream_key_append(struct json_stream *stream, const char *chars, size_t len)
+{
+	const struct json_obj_descr *descr = stream_top(stream)->descr;
+	uint64_t keys;
+	int i;
+
+	for (keys = stream->keys; keys != 0; keys &= keys - 1) {
+		i = u64_count_trailing_zeros(keys);
+
+		if (stream->len + len > descr[i].field_name_len ||
+		    memcmp(descr[i].field_name + stream->len, chars, len) != 0) {
+			stream->keys &= ~BIT64(i);
+		}
+	}
+
+	stream->len += len;
+}
+
+static void stream_key_end(struct json_stream *stream)
+{
+	struct json_stream_frame *frame = stream_top(stream);
+	uint64_t keys;
+	int i;
+
+	stream->descr = NULL;
+
+	for (keys = stream->keys; keys != 0; keys &= keys - 1) {
+		i = u64_count_trailing_zeros(keys);
+
+		if (frame->descr[i].field_name_len == stream->len) {
+			stream->descr = &frame->descr[i];
+			stream->field = (char *)frame->val + frame->descr[i].offset;
+			stream->val = frame->val;
+			break;
+		}
+	}
+
+	stream->state = JSON_STREAM_COLON;
+}
+
+static int stream_string_append(struct json_stream *stream, const char *chars, size_t len)
+{
+	if (stream->lex == JSON_STREAM_LEX_KEY) {
+		if (stream->keys != 0) {
+			stream_key_append(stream, chars, len);
+		}
+
+		return 0;
+	}
+
+	if (stream->descr != NULL && stream->state != JSON_STREAM_SKIP) {
+		/* Leave room for the terminator */
+		if (stream->len + len >= stream->descr->field.size) {
+			return -EINVAL;
+		}
+
+		memcpy((char *)stream->field + stream->len, chars, len);
+	}
+
+	stream->len += len;
+
+	return 0;
+}
+
+static int stream_string_end(struct json_stream *stream)
+{
+	if (stream->lex == JSON_STREAM_LEX_KEY) {
+		stream->lex = JSON_STREAM_LEX_NONE;
+		stream_key_end(stream);
+		return 0;
+	}
+
+	stream->lex = JSON_STREAM_LEX_NONE;
+
+	if (stream->state == JSON_STREAM_SKIP) {
+		return 0;
+	}
+
+	if (stream->descr != NULL) {
+		((char *)stream->field)[stream->len] = '\0';
+	}
+
+	stream_value_end(stream);
+
+	return 0;
+}
+
+/* Strings are kept escaped, but only valid escape sequences are accepted */
+static int stream_string(struct json_stream *stream, const char **data, const char *end)
+{
+	const char *pos = *data;
+	const char *run;
+	char chr;
+	int ret;
+
+	while (pos < end) {
+		if (stream->hex == 0 && !stream->backslash) {
+			run = pos;
+			if (IS_ENABLED(CONFIG_JSON_LIBRARY_BULK_SCAN)) {
+				pos = scan_string(pos, end);
+			} else {
+				while (pos < end && *pos != '"' && *pos != '\\' && *pos != '\0') {
+					pos++;
+				}
+			}
+
+			ret = stream_string_append(stream, run, pos - run);
+			if (ret < 0) {
+				return ret;
+			}
+
+			if (pos == end) {
+				break;
+			}
+		}
+
+		chr = *pos++;
+
+		if (stream->hex > 0) {
+			if (isxdigit((unsigned char)chr) == 0) {
+				return -EINVAL;
+			}
+
+			stream->hex--;
+		} else if (stream->backslash) {
+			switch (chr) {
+			case '"':
+			case '\\':
+			case '/':
+			case 'b':
+			case 'f':
+			case 'n':
+			case 'r':
+			case 't':
+				break;
+			case 'u':
+				stream->hex = 4;
+				break;
+			default:
+				return -EINVAL;
+			}
+
+			stream->backslash = false;
+		} else if (chr == '\\') {
+			stream->backslash = true;
+		} else if (chr == '\0') {
+			return -EINVAL;
+		} else {
+			*data = pos;
+			return stream_string_end(stream);
+		}
+
+		ret = stream_string_append(stream, &chr, 1);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	*data = pos;
+
+	return 0;
+}
+
+static int stream_word_end(struct json_stream *stream)
+{
+	const struct json_obj_descr *descr = stream->descr;
+	struct json_token token = {
+		.type = JSON_TOK_NUMBER,
+		.start = stream->word,
+		.end = stream->word + stream->len,
+	};
+	int ret;
+
+	stream->lex = JSON_STREAM_LEX_NONE;
+
+	if (stream->state == JSON_STREAM_SKIP) {
+		return 0;
+	}
+
+	if (descr == NULL) {
+		stream_value_end(stream);
+		return 0;
+	}
+
+	stream->word[stream->len] = '\0';
+
+	if (strcmp(stream->word, "true") == 0) {
+		token.type = JSON_TOK_TRUE;
+	} else if (strcmp(stream->word, "false") == 0) {
+		token.type = JSON_TOK_FALSE;
+	} else if (strcmp(stream->word, "null") == 0) {
+		/* Recognized, but not decoded, as by json_obj_parse() */
+		return -EINVAL;
+	}
+
+	/* A JSON_TOK_FLOAT token would point into the word buffer */
+	if (descr->type == JSON_TOK_FLOAT) {
+		return -EINVAL;
+	}
+
+	ret = decode_value(NULL, descr, &token, stream->field, stream->val);
+	if (ret < 0) {
+		return ret;
+	}
+
+	stream_value_end(stream);
+
+	return 0;
+}
+
+static int stream_word(struct json_stream *stream, const char **data, const char *end)
+{
+	const char *pos = *data;
+	bool keep = stream->descr != NULL && stream->state != JSON_STREAM_SKIP;
+
+	for (; pos < end && is_word_char(*pos); pos++) {
+		if (keep) {
+			if (stream->len == sizeof(stream->word) - 1) {
+				return -EINVAL;
+			}
+
+			stream->word[stream->len] = *pos;
+		}
+
+		stream->len++;
+	}
+
+	*data = pos;
+
+	/* The word may go on in the next chunk */
+	if (pos == end) {
+		return 0;
+	}
+
+	return stream_word_end(stream);
+}
+
+/* Skip the contents of a container no descriptor matches */
+static int stream_skip(struct json_stream *stream, char chr)
+{
+	switch (chr) {
+	case '{':
+	case '[':
+		stream->skip++;
+		return 0;
+	case '}':
+	case ']':
+		if (--stream->skip == 0) {
+			stream_value_end(stream);
+		}
+		return 0;
+	case '"':
+		stream->lex = JSON_STREAM_LEX_STRING;
+		stream->len = 0;
+		return 0;
+	case ',':
+	case ':':
+		return 0;
+	default:
+		if (!is_word_start(chr)) {
+			return -EINVAL;
+		}
+
+		stream->lex = JSON_STREAM_LEX_WORD;
+		stream->len = 1;
+		return 0;
+	}
+}
+
+static int stream_token(struct json_stream *stream, char chr)
+{
+	struct json_stream_frame *frame = stream_top(stream);
+
+	if (isspace((unsigned char)chr) != 0) {
+		return 0;
+	}
+
+	switch (stream->state) {
+	case JSON_STREAM_SKIP:
+		return stream_skip(stream, chr);
+	case JSON_STREAM_ELEM_OR_END:
+		if (chr == ']') {
+			return stream_close(stream);
+		}
+
+		__fallthrough;
+	case JSON_STREAM_VALUE:
+		return stream_value(stream, chr);
+	case JSON_STREAM_KEY_OR_END:
+		if (chr == '}') {
+			return stream_close(stream);
+		}
+
+		__fallthrough;
+	case JSON_STREAM_KEY:
+		if (chr != '"') {
+			return -EINVAL;
+		}
+
+		stream_key_start(stream);
+		return 0;
+	case JSON_STREAM_COLON:
+		if (chr != ':') {
+			return -EINVAL;
+		}
+
+		stream->state = JSON_STREAM_VALUE;
+		return 0;
+	case JSON_STREAM_NEXT:
+		if (chr == ',') {
+			stream->state = frame->count != NULL ? JSON_STREAM_VALUE : JSON_STREAM_KEY;
+			return 0;
+		}
+
+		if (chr == (frame->count != NULL ? ']' : '}')) {
+			return stream_close(stream);
+		}
+
+		return -EINVAL;
+	default:
+		return -EINVAL;
+	}
+}
+
+int64_t json_stream_parse(struct json_stream *stream, const char *data, size_t len)
+{
+	const char *end = data + len;
+	int ret;
+
+	while (data < end && stream->state < JSON_STREAM_DONE) {
+		switch (stream->lex) {
+		case JSON_STREAM_LEX_KEY:
+		case JSON_STREAM_LEX_STRING:
+			ret = stream_string(stream, &data, end);
+			break;
+		case JSON_STREAM_LEX_WORD:
+			ret = stream_word(stream, &data, end);
+			break;
+		default:
+			ret = stream_token(stream, *data++);
+			break;
+		}
+
+		if (ret < 0) {
+			stream->state = JSON_STREAM_ERROR;
+			stream->result = ret;
+		}
+	}
+
+	if (stream->state < JSON_STREAM_DONE) {
+		return -EAGAIN;
+	}
+
+	return stream->result;
+}
+
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 static char escape_as(char chr)
 {
 	switch (chr) {
@@ -1370,72 +2076,84 @@ static int str_encode(const char *str, json_append_bytes_t append_bytes,
 	return ret;
 }
 
-static int int32_encode(const int32_t *num, json_append_bytes_t append_bytes,
-			void *data)
+static const char digit_pairs[] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+/* Write num backwards, two digits per division, ending before pos */
+static char *u32_format(uint32_t num, char *pos, int min_digits)
 {
-	char buf[3 * sizeof(int32_t)];
-	int ret;
+	char *end = pos;
 
-	ret = snprintk(buf, sizeof(buf), "%d", *num);
-	if (ret < 0) {
-		return ret;
+	while (num >= 100) {
+		pos -= 2;
+		memcpy(pos, &digit_pairs[(num % 100) * 2], 2);
+		num /= 100;
 	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
+
+	if (num >= 10) {
+		pos -= 2;
+		memcpy(pos, &digit_pairs[num * 2], 2);
+	} else {
+		*--pos = '0' + num;
 	}
 
-	return append_bytes(buf, (size_t)ret, data);
+	while (end - pos < min_digits) {
+		*--pos = '0';
+	}
+
+	return pos;
 }
 
-static int uint32_encode(const uint32_t *num, json_append_bytes_t append_bytes,
-			 void *data)
+static int num_encode(uint64_t num, bool negative, json_append_bytes_t append_bytes,
+		      void *data)
 {
-	char buf[3 * sizeof(uint32_t)];
-	int ret;
+	char buf[sizeof("-18446744073709551615")];
+	char *end = buf + sizeof(buf);
+	char *pos = end;
 
-	ret = snprintk(buf, sizeof(buf), "%u", *num);
-	if (ret < 0) {
-		return ret;
+	/* Only the digits above 32 bits need 64-bit divisions */
+	while (num > UINT32_MAX) {
+		pos = u32_format(num % 1000000000U, pos, 9);
+		num /= 1000000000U;
 	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
+
+	pos = u32_format(num, pos, 1);
+
+	if (negative) {
+		*--pos = '-';
 	}
 
-	return append_bytes(buf, (size_t)ret, data);
+	return append_bytes(pos, end - pos, data);
 }
 
-static int int64_encode(const int64_t *num, json_append_bytes_t append_bytes,
+static int int32_encode(const int32_t *num, json_append_bytes_t append_bytes,
 			void *data)
 {
-	char buf[sizeof("-9223372036854775808")];
-	int ret;
+	uint32_t abs = *num < 0 ? 0U - (uint32_t)*num : (uint32_t)*num;
 
-	ret = snprintk(buf, sizeof(buf), "%" PRId64, *num);
-	if (ret < 0) {
-		return ret;
-	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
-	}
+	return num_encode(abs, *num < 0, append_bytes, data);
+}
 
-	return append_bytes(buf, (size_t)ret, data);
+static int uint32_encode(const uint32_t *num, json_append_bytes_t append_bytes,
+			 void *data)
+{
+	return num_encode(*num, false, append_bytes, data);
 }
 
-static int uint64_encode(const uint64_t *num, json_append_bytes_t append_bytes,
+static int int64_encode(const int64_t *num, json_append_bytes_t append_bytes,
 			void *data)
 {
-	char buf[sizeof("18446744073709551610")];
-	int ret;
+	uint64_t abs = *num < 0 ? 0ULL - (uint64_t)*num : (uint64_t)*num;
 
-	ret = snprintk(buf, sizeof(buf), "%" PRIu64, *num);
-	if (ret < 0) {
-		return ret;
-	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
-	}
+	return num_encode(abs, *num < 0, append_bytes, data);
+}
 
-	return append_bytes(buf, (size_t)ret, data);
+static int uint64_encode(const uint64_t *num, json_append_bytes_t append_bytes,
+			void *data)
+{
+	return num_encode(*num, false, append_bytes, data);
 }
 
 static int print_double(char *str, size_t size, const char *fmt, double num)
@@ -1468,6 +2186,15 @@ static int float_encode(const float *num, json_append_bytes_t append_bytes, void
 	char buf[sizeof("-3.40282347e+38")];
 	int ret;
 
+#ifdef CONFIG_JSON_LIBRARY_FP_SUPPORT
+	/* Integral values below 10^9 print the same with %.9g, without cbprintf */
+	if (fabsf(*num) < 1e9f && *num == (int32_t)*num && !(*num == 0 && signbit(*num))) {
+		int32_t integer = (int32_t)*num;
+
+		return int32_encode(&integer, append_bytes, data);
+	}
+#endif
+
 	ret = print_double(buf, sizeof(buf), "%.9g", (double)*num);
 
 	if (ret < 0) {
@@ -1485,6 +2212,15 @@ static int double_encode(const double *num, json_append_bytes_t append_bytes, vo
 	char buf[sizeof("-1.797693134862316e+308")];
 	int ret;
 
+#ifdef CONFIG_JSON_LIBRARY_FP_SUPPORT
+	/* Integral values below 10^16 print the same with %.16g */
+	if (fabs(*num) < 1e16 && *num == (int64_t)*num && !(*num == 0 && signbit(*num))) {
+		int64_t integer = (int64_t)*num;
+
+		return int64_encode(&integer, append_bytes, data);
+	}
+#endif
+
 	ret = print_double(buf, sizeof(buf), "%.16g", *num);
 
 	if (ret < 0) {
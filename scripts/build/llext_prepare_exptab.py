@@ -12,7 +12,8 @@ is a special section filled with 'llext_const_symbol' structures
 generated by the EXPORT_SYMBOL macro.
 
 Currently, the preparatory work consists mostly of sorting the
-exports table to allow usage of binary search algorithms at runtime.
+exports table (by name, or by SLID) to allow usage of binary search
+algorithms at runtime.
 If CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID option is enabled, SLIDs
 of all exported functions are also injected in the export table by
 this script. (In this case, the preparation process is destructive)
@@ -21,6 +22,7 @@ this script. (In this case, the preparation process is destructive)
 import llext_slidlib
 
 from elftools.elf.elffile import ELFFile
+from elftools.elf.constants import SH_FLAGS
 from elftools.elf.sections import Section
 
 import argparse
@@ -217,26 +219,58 @@ class ZephyrElfExptabPreparator():
         return 0
 
     def _prepare_exptab_for_str_linking(self):
-        #TODO: sort the export table by symbol
-        #      name to allow binary search too
-        #
-        # Plan of action:
-        #   1) Locate in which section the names are located
-        #   2) Load the export table and resolve names
-        #   3) Sort the exports by name
-        #       WARN: THIS MUST USE THE SAME SORTING RULES
-        #       AS LLEXT CODE OR DICHOTOMIC SEARCH WILL BREAK
-        #       Using a custom sorting function might be required.
-        #   4) Write back the updated export table
-        #
-        # N.B.: reusing part of the code in _prepare_elf_for_slid_linking
-        # might be possible and desireable.
-        #
-        # As of writing, this function will never be called as this script
-        # is only called if CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID is enabled,
-        # which makes _prepare_exptab_for_slid_linking be called instead.
-        #
-        self.log.warn(f"_prepare_exptab_for_str_linking: do nothing")
+        """
+        IMPLEMENTATION NOTES:
+          The export table entries point to their names, which are
+          located through the section containing each address.
+
+          The export table is sorted by name in ASCENDING order of
+          the raw bytes, which is the order strcmp() used by the
+          LLEXT code follows.
+        """
+        if self.elf['e_type'] != 'ET_EXEC':
+            #Pointers in position independent images are only
+            #known once relocated at runtime.
+            self.log.info("not an executable ELF - export table left unsorted")
+            return 0
+
+        #1) Locate the sections names may be located in
+        name_sections = [s for s in self.elf.iter_sections()
+                         if (s['sh_flags'] & SH_FLAGS.SHF_ALLOC) and
+                         s['sh_type'] != 'SHT_NOBITS']
+        section_data = {}
+
+        def read_symbol_name(name_ptr):
+            for index, section in enumerate(name_sections):
+                start = section['sh_addr']
+                if start <= name_ptr < start + section['sh_size']:
+                    if index not in section_data:
+                        section_data[index] = section.data()
+                    data = section_data[index]
+                    offset = name_ptr - start
+                    end = data.find(b'\0', offset)
+                    if end >= 0:
+                        return data[offset:end]
+            return None
+
+        #2) Load the export table and resolve names
+        exports_list = []
+        for (name_ptr, export_address) in self.exptab_manipulator:
+            export_name = read_symbol_name(name_ptr)
+            if export_name is None:
+                self.log.warning(f"cannot find export name at 0x{name_ptr:X} "
+                                 "- export table left unsorted")
+                return 0
+            exports_list.append((export_name, name_ptr, export_address))
+
+        #3) Sort the exports by name (order specified above)
+        exports_list.sort(key=lambda export: export[0])
+
+        #4) Write back the updated export table
+        for i, (export_name, name_ptr, export_address) in enumerate(exports_list):
+            self.log.debug(f"{export_name.decode('utf-8', 'replace')} at 0x{export_address:X}")
+            self.exptab_manipulator[i] = (name_ptr, export_address)
+
         return 0
 
     def _set_prep_done_shdr_flag(self):
@@ -12,8 +12,13 @@ This translate stack samples captured by perf subsystem into format
 used by flamegraph.pl. Translation uses .elf file to get function names
 from addresses
 
+The output of ``perf folded`` (CONFIG_PROFILING_PERF_AGGREGATE) is
+accepted as well. Frames given as return addresses are resolved to
+function names, and the sample counts are kept.
+
 Usage:
     ./script/perf/stackcollapse.py <file with perf printbuf output> <ELF file>
+    ./script/perf/stackcollapse.py <file with perf folded output> <ELF file>
 """
 
 import re
@@ -54,12 +59,33 @@ def collapse(buf, elf):
         buf = buf[8 + 8 * count:]
 
 
+def collapse_folded(lines, elf):
+    for line in lines:
+        m = re.match(r"(\S.*) (\d+)$", line.strip())
+        if not m:
+            continue
+
+        frames = m.group(1).split(";")
+        # the first frame is the thread name, the others are kept as they
+        # are on target, so that recursion shows up as repeated functions
+        line = frames[0]
+        for frame in frames[1:]:
+            func = addr_to_sym(int(frame, 16), elf) if frame.startswith("0x") else frame
+            line += ";" + func
+
+        print(line, m.group(2))
+
+
 if __name__ == "__main__":
     elf = ELFFile(open(sys.argv[2], "rb"))
     with open(sys.argv[1], "r") as f:
         inp = f.read()
 
     lines = inp.splitlines()
+    if not lines or not lines[0].startswith("Perf buf length"):
+        collapse_folded(lines, elf)
+        sys.exit(0)
+
     assert int(re.match(r"Perf buf length (\d+)", lines[0]).group(1)) == len(lines) - 1
     buf = binascii.unhexlify("".join(lines[1:]))
     collapse(buf, elf)
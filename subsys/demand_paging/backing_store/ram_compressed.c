@@ -0,0 +1,525 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Compressed RAM-based backing store
+ */
+#include <mmu.h>
+#include <string.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * Evicted data pages are compressed in the LZ4 block format and stored in
+ * a pool of CONFIG_BACKING_STORE_RAM_COMPRESSED_CHUNK sized chunks. A page
+ * occupies as many chunks as its compressed size needs, linked through
+ * chunk_next[], so the pool does not fragment and pages of any
+ * compressibility can share it. Pages which do not compress by at least
+ * one chunk are stored as is.
+ *
+ * The location token is the index of a compressed_page descriptor times
+ * the page size. As the compressed size of a page is only known once it
+ * is paged out, k_mem_paging_backing_store_location_get() reserves chunks
+ * for an uncompressed page and k_mem_paging_backing_store_page_out()
+ * returns those it did not use.
+ *
+ * Copies are kept after a page-in: the page frame is marked
+ * K_MEM_PAGE_FRAME_BACKED and remembers its descriptor in frame_page[].
+ * When such a frame is evicted again and the page is not dirty, as
+ * reported by the MMU the same way the eviction algorithms see it, the
+ * previous location is returned and the kernel skips the page-out, so
+ * clean pages are never compressed twice. These copies are dropped, and
+ * the BACKED bit cleared, whenever chunks or descriptors run short.
+ */
+
+#define PAGE_CHUNKS   DIV_ROUND_UP(CONFIG_MMU_PAGE_SIZE, CONFIG_BACKING_STORE_RAM_COMPRESSED_CHUNK)
+#define POOL_CHUNKS   (CONFIG_BACKING_STORE_RAM_COMPRESSED_SIZE / \
+		       CONFIG_BACKING_STORE_RAM_COMPRESSED_CHUNK)
+#define NUM_PAGES     CONFIG_BACKING_STORE_RAM_COMPRESSED_PAGES
+#define NONE          UINT16_MAX
+
+BUILD_ASSERT(POOL_CHUNKS >= 2 * PAGE_CHUNKS,
+	     "compressed pool must hold at least two uncompressed pages");
+BUILD_ASSERT(POOL_CHUNKS < NONE && NUM_PAGES < NONE);
+BUILD_ASSERT(CONFIG_MMU_PAGE_SIZE <= UINT16_MAX, "LZ4 offsets are 16 bits");
+
+struct compressed_page {
+	/* First chunk of the data, NONE if the page holds no data */
+	uint16_t head;
+	/* Compressed size, CONFIG_MMU_PAGE_SIZE if stored uncompressed */
+	uint16_t size;
+	/* Chunks reserved for a pending page-out */
+	uint16_t reserved;
+	bool used;
+};
+
+static uint8_t pool[POOL_CHUNKS][CONFIG_BACKING_STORE_RAM_COMPRESSED_CHUNK] __aligned(sizeof(void *));
+static uint16_t chunk_next[POOL_CHUNKS];
+static uint16_t free_chunk;
+static size_t free_chunks;
+static size_t reserved_chunks;
+
+static struct compressed_page pages[NUM_PAGES];
+static uint16_t free_page;
+static size_t free_pages;
+
+/* Descriptor holding a clean copy of the page in each page frame */
+static uint16_t frame_page[K_MEM_NUM_PAGE_FRAMES];
+static size_t reclaim_hand;
+
+/* Compressed data staging area, and the compressor hash table */
+static uint8_t stage[CONFIG_MMU_PAGE_SIZE] __aligned(sizeof(void *));
+static uint16_t hash_table[1 << CONFIG_BACKING_STORE_RAM_COMPRESSED_HASH_BITS];
+
+/*
+ * LZ4 block format codec, see
+ * https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+ */
+#define LZ_MIN_MATCH      4
+#define LZ_LAST_LITERALS  5
+#define LZ_MF_LIMIT       12
+
+static inline uint32_t lz_read32(const uint8_t *p)
+{
+	return UNALIGNED_GET((const uint32_t *)p);
+}
+
+static inline uint32_t lz_hash(uint32_t seq)
+{
+	return (seq * 2654435761U) >> (32 - CONFIG_BACKING_STORE_RAM_COMPRESSED_HASH_BITS);
+}
+
+static uint8_t *lz_put_length(uint8_t *op, size_t len)
+{
+	for (; len >= 255; len -= 255) {
+		*op++ = 255;
+	}
+	*op++ = len;
+
+	return op;
+}
+
+/* Emit a sequence, a match length of 0 ends the block */
+static uint8_t *lz_put_sequence(uint8_t *op, const uint8_t *end, const uint8_t *literals,
+				size_t lit_len, size_t offset, size_t match_len)
+{
+	size_t match_code = match_len > 0 ? match_len - LZ_MIN_MATCH : 0;
+	uint8_t *token = op++;
+
+	/* Token, literals with their length bytes, match offset and length bytes */
+	if ((size_t)(end - token) < 1 + lit_len + lit_len / 255 + 1 + 2 + match_code / 255 + 1) {
+		return NULL;
+	}
+
+	*token = MIN(lit_len, 15) << 4;
+	if (lit_len >= 15) {
+		op = lz_put_length(op, lit_len - 15);
+	}
+	memcpy(op, literals, lit_len);
+	op += lit_len;
+
+	if (match_len == 0) {
+		return op;
+	}
+
+	*op++ = offset & 0xff;
+	*op++ = offset >> 8;
+	*token |= MIN(match_code, 15);
+	if (match_code >= 15) {
+		op = lz_put_length(op, match_code - 15);
+	}
+
+	return op;
+}
+
+/* Returns the compressed size, 0 if it does not fit in @p cap bytes */
+static size_t lz_compress(const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+	const uint8_t *ip = src, *anchor = src;
+	const uint8_t *match_limit = src + len - LZ_MF_LIMIT;
+	const uint8_t *extend_limit = src + len - LZ_LAST_LITERALS;
+	uint8_t *op = dst, *end = dst + cap;
+
+	(void)memset(hash_table, 0, sizeof(hash_table));
+
+	while (ip < match_limit) {
+		uint32_t seq = lz_read32(ip);
+		uint32_t h = lz_hash(seq);
+		const uint8_t *ref = src + hash_table[h];
+		size_t match_len;
+
+		hash_table[h] = ip - src;
+		if (ref >= ip || lz_read32(ref) != seq) {
+			/* Skip faster through data which does not compress */
+			ip += 1 + ((ip - anchor) >> 6);
+			continue;
+		}
+
+		match_len = LZ_MIN_MATCH;
+		while (ip + match_len < extend_limit && ref[match_len] == ip[match_len]) {
+			match_len++;
+		}
+
+		op = lz_put_sequence(op, end, anchor, ip - anchor, ip - ref, match_len);
+		if (op == NULL) {
+			return 0;
+		}
+
+		ip += match_len;
+		anchor = ip;
+	}
+
+	op = lz_put_sequence(op, end, anchor, src + len - anchor, 0, 0);
+
+	return op == NULL ? 0 : op - dst;
+}
+
+/* Returns the decompressed size, or -EINVAL on a malformed block */
+static int lz_decompress(const uint8_t *src, size_t len, uint8_t *dst, size_t cap)
+{
+	const uint8_t *ip = src, *in_end = src + len;
+	uint8_t *op = dst, *out_end = dst + cap;
+
+	while (ip < in_end) {
+		size_t lit_len = *ip >> 4;
+		size_t match_len = *ip & 0xf;
+		size_t offset;
+		uint8_t b;
+
+		ip++;
+		if (lit_len == 15) {
+			do {
+				if (ip == in_end) {
+					return -EINVAL;
+				}
+				b = *ip++;
+				lit_len += b;
+			} while (b == 255);
+		}
+
+		if ((size_t)(in_end - ip) < lit_len || (size_t)(out_end - op) < lit_len) {
+			return -EINVAL;
+		}
+		memcpy(op, ip, lit_len);
+		ip += lit_len;
+		op += lit_len;
+
+		if (ip == in_end) {
+			/* The last sequence has no match */
+			break;
+		}
+
+		if (in_end - ip < 2) {
+			return -EINVAL;
+		}
+		offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+
+		if (match_len == 15) {
+			do {
+				if (ip == in_end) {
+					return -EINVAL;
+				}
+				b = *ip++;
+				match_len += b;
+			} while (b == 255);
+		}
+		match_len += LZ_MIN_MATCH;
+
+		if (offset == 0 || offset > (size_t)(op - dst) ||
+		    (size_t)(out_end - op) < match_len) {
+			return -EINVAL;
+		}
+
+		if (offset >= match_len) {
+			memcpy(op, op - offset, match_len);
+			op += match_len;
+		} else {
+			/* Overlapping match, repeats the last offset bytes */
+			for (size_t i = 0; i < match_len; i++, op++) {
+				*op = *(op - offset);
+			}
+		}
+	}
+
+	return op - dst;
+}
+
+/*
+ * Chunk pool
+ */
+static size_t chunks_available(void)
+{
+	return free_chunks - reserved_chunks;
+}
+
+static uint16_t chunks_alloc(size_t count)
+{
+	uint16_t head = free_chunk, tail = head;
+
+	__ASSERT(count > 0 && count <= free_chunks, "chunk count mismatch");
+
+	for (size_t i = 1; i < count; i++) {
+		tail = chunk_next[tail];
+	}
+	free_chunk = chunk_next[tail];
+	chunk_next[tail] = NONE;
+	free_chunks -= count;
+
+	return head;
+}
+
+static size_t chunks_free(uint16_t head)
+{
+	size_t count = 0;
+	uint16_t tail;
+
+	if (head == NONE) {
+		return 0;
+	}
+
+	for (tail = head, count = 1; chunk_next[tail] != NONE; count++) {
+		tail = chunk_next[tail];
+	}
+	chunk_next[tail] = free_chunk;
+	free_chunk = head;
+	free_chunks += count;
+
+	return count;
+}
+
+static void chunks_write(uint16_t chunk, const uint8_t *src, size_t size)
+{
+	size_t len;
+
+	for (; size > 0; size -= len, src += len, chunk = chunk_next[chunk]) {
+		len = MIN(size, CONFIG_BACKING_STORE_RAM_COMPRESSED_CHUNK);
+		memcpy(pool[chunk], src, len);
+	}
+}
+
+static void chunks_read(uint16_t chunk, uint8_t *dst, size_t size)
+{
+	size_t len;
+
+	for (; size > 0; size -= len, dst += len, chunk = chunk_next[chunk]) {
+		len = MIN(size, CONFIG_BACKING_STORE_RAM_COMPRESSED_CHUNK);
+		memcpy(dst, pool[chunk], len);
+	}
+}
+
+/*
+ * Page descriptors
+ */
+static uintptr_t page_to_location(struct compressed_page *page)
+{
+	return (uintptr_t)(page - pages) * CONFIG_MMU_PAGE_SIZE;
+}
+
+static struct compressed_page *location_to_page(uintptr_t location)
+{
+	__ASSERT(location % CONFIG_MMU_PAGE_SIZE == 0,
+		 "unaligned location 0x%lx", location);
+	__ASSERT(location < (NUM_PAGES * CONFIG_MMU_PAGE_SIZE),
+		 "bad location 0x%lx, past bounds of backing store", location);
+
+	return &pages[location / CONFIG_MMU_PAGE_SIZE];
+}
+
+static struct compressed_page *page_alloc(void)
+{
+	struct compressed_page *page = &pages[free_page];
+
+	__ASSERT(free_pages > 0 && !page->used, "page count mismatch");
+	free_page = page->head;
+	free_pages--;
+
+	*page = (struct compressed_page){
+		.head = NONE,
+		.used = true,
+	};
+
+	return page;
+}
+
+static void page_free(struct compressed_page *page)
+{
+	__ASSERT(page->used, "location 0x%lx freed twice", page_to_location(page));
+
+	chunks_free(page->head);
+	reserved_chunks -= page->reserved;
+
+	page->used = false;
+	page->reserved = 0;
+	page->head = free_page;
+	free_page = page - pages;
+	free_pages++;
+}
+
+static size_t page_chunks(struct compressed_page *page)
+{
+	return page->head == NONE ? 0 :
+	       DIV_ROUND_UP(page->size, CONFIG_BACKING_STORE_RAM_COMPRESSED_CHUNK);
+}
+
+/* Drop a clean copy kept for a page frame other than @p except */
+static bool reclaim_one(struct k_mem_page_frame *except)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(frame_page); i++) {
+		size_t idx = (reclaim_hand + i) % ARRAY_SIZE(frame_page);
+		struct k_mem_page_frame *pf = &k_mem_page_frames[idx];
+
+		if (frame_page[idx] == NONE || pf == except) {
+			continue;
+		}
+
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BACKED);
+		page_free(&pages[frame_page[idx]]);
+		frame_page[idx] = NONE;
+		reclaim_hand = idx + 1;
+
+		return true;
+	}
+
+	return false;
+}
+
+int k_mem_paging_backing_store_location_get(struct k_mem_page_frame *pf,
+					    uintptr_t *location,
+					    bool page_fault)
+{
+	size_t idx = pf - k_mem_page_frames;
+	struct compressed_page *page = NULL;
+	size_t need = PAGE_CHUNKS;
+	/* Keep room for one uncompressed page to service page faults */
+	size_t keep_chunks = page_fault ? 0 : PAGE_CHUNKS;
+	size_t keep_pages = page_fault ? 0 : 1;
+
+	if (frame_page[idx] != NONE) {
+		page = &pages[frame_page[idx]];
+
+		if (!k_mem_page_frame_is_backed(pf)) {
+			/* The frame was freed and reused since the copy was made */
+			page_free(page);
+			frame_page[idx] = NONE;
+			page = NULL;
+		} else if ((arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, false) &
+			    ARCH_DATA_PAGE_DIRTY) == 0) {
+			/* Clean, the kernel does not page it out again */
+			frame_page[idx] = NONE;
+			*location = page_to_location(page);
+			return 0;
+		} else {
+			/* Dirty, the old data is released when paged out */
+			need -= MIN(need, page_chunks(page));
+		}
+	}
+
+	while (chunks_available() < need + keep_chunks ||
+	       (page == NULL && free_pages < 1 + keep_pages)) {
+		if (!reclaim_one(pf)) {
+			return -ENOMEM;
+		}
+	}
+
+	if (page == NULL) {
+		page = page_alloc();
+	}
+
+	frame_page[idx] = NONE;
+	page->reserved += need;
+	reserved_chunks += need;
+	*location = page_to_location(page);
+
+	return 0;
+}
+
+void k_mem_paging_backing_store_location_free(uintptr_t location)
+{
+	page_free(location_to_page(location));
+}
+
+void k_mem_paging_backing_store_page_out(uintptr_t location)
+{
+	struct compressed_page *page = location_to_page(location);
+	const uint8_t *data = stage;
+	size_t size, count;
+
+	size = lz_compress(K_MEM_SCRATCH_PAGE, CONFIG_MMU_PAGE_SIZE, stage,
+			   (PAGE_CHUNKS - 1) * CONFIG_BACKING_STORE_RAM_COMPRESSED_CHUNK);
+	if (size == 0) {
+		data = K_MEM_SCRATCH_PAGE;
+		size = CONFIG_MMU_PAGE_SIZE;
+	}
+
+	chunks_free(page->head);
+	reserved_chunks -= page->reserved;
+	page->reserved = 0;
+
+	count = DIV_ROUND_UP(size, CONFIG_BACKING_STORE_RAM_COMPRESSED_CHUNK);
+	__ASSERT(count <= chunks_available(), "page-out without reserved chunks");
+	page->head = chunks_alloc(count);
+	page->size = size;
+	chunks_write(page->head, data, size);
+}
+
+void k_mem_paging_backing_store_page_in(uintptr_t location)
+{
+	struct compressed_page *page = location_to_page(location);
+	int ret;
+
+	__ASSERT(page->head != NONE, "page-in of location 0x%lx without data", location);
+
+	if (page->size == CONFIG_MMU_PAGE_SIZE) {
+		chunks_read(page->head, K_MEM_SCRATCH_PAGE, CONFIG_MMU_PAGE_SIZE);
+		return;
+	}
+
+	chunks_read(page->head, stage, page->size);
+	ret = lz_decompress(stage, page->size, K_MEM_SCRATCH_PAGE, CONFIG_MMU_PAGE_SIZE);
+	__ASSERT(ret == CONFIG_MMU_PAGE_SIZE, "corrupted page at location 0x%lx", location);
+	ARG_UNUSED(ret);
+}
+
+void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
+					      uintptr_t location)
+{
+	size_t idx = pf - k_mem_page_frames;
+
+#ifdef CONFIG_DEMAND_MAPPING
+	/* ignore those */
+	if (location == ARCH_UNPAGED_ANON_ZERO || location == ARCH_UNPAGED_ANON_UNINIT) {
+		return;
+	}
+#endif
+	if (frame_page[idx] != NONE) {
+		/* Stale copy of a page which was unmapped from this frame */
+		page_free(&pages[frame_page[idx]]);
+	}
+
+	/* Keep the data as a clean copy of the paged-in page */
+	frame_page[idx] = location_to_page(location) - pages;
+	k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_BACKED);
+}
+
+void k_mem_paging_backing_store_init(void)
+{
+	for (size_t i = 0; i < POOL_CHUNKS; i++) {
+		chunk_next[i] = i + 1 < POOL_CHUNKS ? i + 1 : NONE;
+	}
+	free_chunk = 0;
+	free_chunks = POOL_CHUNKS;
+	reserved_chunks = 0;
+
+	for (size_t i = 0; i < NUM_PAGES; i++) {
+		pages[i].head = i + 1 < NUM_PAGES ? i + 1 : NONE;
+	}
+	free_page = 0;
+	free_pages = NUM_PAGES;
+
+	for (size_t i = 0; i < ARRAY_SIZE(frame_page); i++) {
+		frame_page[i] = NONE;
+	}
+}
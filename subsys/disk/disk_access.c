@@ -14,6 +14,8 @@
 #include <errno.h>
 #include <zephyr/device.h>
 
+#include "disk_cache.h"
+
 #define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(disk);
@@ -66,6 +68,7 @@ int disk_access_init(const char *pdrv)
 			if (rc == 0) {
 				/* Increment reference count */
 				disk->refcnt++;
+				disk_cache_attach(disk);
 			}
 		}
 	} else if ((disk != NULL) && (disk->refcnt < UINT16_MAX)) {
@@ -98,6 +101,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
+#ifdef CONFIG_DISK_CACHE
+		if (disk->cache != NULL) {
+			return disk_cache_read(disk, data_buf, start_sector, num_sector);
+		}
+#endif
 		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
 	}
 
@@ -112,6 +120,11 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
+#ifdef CONFIG_DISK_CACHE
+		if (disk->cache != NULL) {
+			return disk_cache_write(disk, data_buf, start_sector, num_sector);
+		}
+#endif
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
 	}
 
@@ -131,6 +144,7 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				rc = disk->ops->ioctl(disk, cmd, buf);
 				if (rc == 0) {
 					disk->refcnt++;
+					disk_cache_attach(disk);
 				}
 			} else if (disk->refcnt < UINT16_MAX) {
 				disk->refcnt++;
@@ -143,12 +157,18 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 			if ((buf != NULL) && (*((bool *)buf))) {
 				/* Force deinit disk */
 				disk->refcnt = 0U;
+				(void)disk_cache_sync(disk);
 				disk->ops->ioctl(disk, cmd, buf);
+				disk_cache_detach(disk);
 				rc = 0;
 			} else if (disk->refcnt == 1U) {
-				rc = disk->ops->ioctl(disk, cmd, buf);
+				rc = disk_cache_sync(disk);
+				if (rc == 0) {
+					rc = disk->ops->ioctl(disk, cmd, buf);
+				}
 				if (rc == 0) {
 					disk->refcnt--;
+					disk_cache_detach(disk);
 				}
 			} else if (disk->refcnt > 0) {
 				disk->refcnt--;
@@ -157,6 +177,12 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				LOG_WRN("Disk is already deinitialized");
 			}
 			break;
+		case DISK_IOCTL_CTRL_SYNC:
+			rc = disk_cache_sync(disk);
+			if (rc == 0) {
+				rc = disk->ops->ioctl(disk, cmd, buf);
+			}
+			break;
 		default:
 			rc = disk->ops->ioctl(disk, cmd, buf);
 		}
@@ -181,6 +207,9 @@ int disk_access_register(struct disk_info *disk)
 
 	/* Initialize reference count to zero */
 	disk->refcnt = 0U;
+#ifdef CONFIG_DISK_CACHE
+	disk->cache = NULL;
+#endif
 
 	spinlock_key = k_spin_lock(&lock);
 	/*  append to the disk list */
@@ -204,6 +233,10 @@ int disk_access_unregister(struct disk_info *disk)
 		return -EINVAL;
 	}
 
+	/* Write back what can still be, the disk may already be gone */
+	(void)disk_cache_sync(disk);
+	disk_cache_detach(disk);
+
 	spinlock_key = k_spin_lock(&lock);
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Sector cache between the disk access API and the disk drivers.
+ *
+ * Each cached sector is kept in a block on a per-disk LRU list, least
+ * recently used first, with unused blocks at the front. A cached sector is
+ * always at least as recent as the medium, so reads are served from the
+ * cache wherever possible and only the runs of missing sectors are read
+ * from the driver. Contiguous dirty sectors are written back together
+ * through the batch buffer, which also receives the sectors read ahead.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/storage/disk_access.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/util.h>
+
+#include "disk_cache.h"
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+#define BATCH_SECTORS CONFIG_DISK_CACHE_BATCH_SECTORS
+
+struct disk_cache_block {
+	sys_dnode_t node;
+	uint32_t sector;
+	bool valid;
+	bool dirty;
+	uint8_t data[CONFIG_DISK_CACHE_SECTOR_SIZE] __aligned(sizeof(void *));
+};
+
+struct disk_cache {
+	/* Disk using this cache, NULL if the cache is free */
+	struct disk_info *disk;
+	struct k_mutex lock;
+	sys_dlist_t lru;
+	uint32_t sector_size;
+	uint32_t sector_count;
+	/* Sector following the previous read, to detect sequential reads */
+	uint32_t next_sector;
+	struct disk_cache_block blocks[CONFIG_DISK_CACHE_SECTORS];
+	uint8_t batch[BATCH_SECTORS * CONFIG_DISK_CACHE_SECTOR_SIZE] __aligned(sizeof(void *));
+};
+
+static struct disk_cache caches[CONFIG_DISK_CACHE_DISKS];
+
+/* lock to protect cache assignment */
+static struct k_spinlock lock;
+
+static struct disk_cache_block *find_block(struct disk_cache *cache, uint32_t sector)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache->blocks); i++) {
+		struct disk_cache_block *blk = &cache->blocks[i];
+
+		if (blk->valid && blk->sector == sector) {
+			return blk;
+		}
+	}
+
+	return NULL;
+}
+
+static void touch_block(struct disk_cache *cache, struct disk_cache_block *blk)
+{
+	sys_dlist_remove(&blk->node);
+	sys_dlist_append(&cache->lru, &blk->node);
+}
+
+/* Write back the run of contiguous dirty sectors containing blk */
+static int flush_run(struct disk_cache *cache, struct disk_cache_block *blk)
+{
+	struct disk_cache_block *run[BATCH_SECTORS];
+	struct disk_info *disk = cache->disk;
+	uint32_t first = blk->sector;
+	struct disk_cache_block *prev;
+	uint32_t count = 0;
+	int rc;
+
+	while (first > 0 && blk->sector - first + 1 < BATCH_SECTORS) {
+		prev = find_block(cache, first - 1);
+		if (prev == NULL || !prev->dirty) {
+			break;
+		}
+		first--;
+	}
+
+	while (count < BATCH_SECTORS) {
+		run[count] = find_block(cache, first + count);
+		if (run[count] == NULL || !run[count]->dirty) {
+			break;
+		}
+		count++;
+	}
+
+	if (count == 1) {
+		rc = disk->ops->write(disk, blk->data, first, 1);
+	} else {
+		for (uint32_t i = 0; i < count; i++) {
+			memcpy(&cache->batch[i * cache->sector_size], run[i]->data,
+			       cache->sector_size);
+		}
+		rc = disk->ops->write(disk, cache->batch, first, count);
+	}
+
+	if (rc != 0) {
+		LOG_ERR("%s: failed to write back sectors %u-%u (%d)", disk->name, first,
+			first + count - 1, rc);
+		return rc;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		run[i]->dirty = false;
+	}
+
+	return 0;
+}
+
+/*
+ * Get the least recently used block for a new sector, writing it back
+ * first if it is dirty. With may_flush false, dirty blocks are not reused.
+ */
+static struct disk_cache_block *alloc_block(struct disk_cache *cache, uint32_t sector,
+					    bool may_flush, int *rc)
+{
+	struct disk_cache_block *blk;
+
+	blk = SYS_DLIST_PEEK_HEAD_CONTAINER(&cache->lru, blk, node);
+	*rc = 0;
+
+	if (blk->dirty) {
+		if (!may_flush) {
+			return NULL;
+		}
+
+		*rc = flush_run(cache, blk);
+		if (*rc != 0) {
+			return NULL;
+		}
+	}
+
+	blk->sector = sector;
+	blk->valid = true;
+	touch_block(cache, blk);
+
+	return blk;
+}
+
+static int insert_sector(struct disk_cache *cache, uint32_t sector, const uint8_t *data,
+			 bool dirty)
+{
+	struct disk_cache_block *blk = find_block(cache, sector);
+	int rc = 0;
+
+	if (blk == NULL) {
+		blk = alloc_block(cache, sector, true, &rc);
+		if (blk == NULL) {
+			return rc;
+		}
+	} else {
+		touch_block(cache, blk);
+	}
+
+	memcpy(blk->data, data, cache->sector_size);
+	blk->dirty = blk->dirty || dirty;
+
+	return 0;
+}
+
+/* Read the uncached sectors following a sequential read into the cache */
+static void read_ahead(struct disk_cache *cache, uint32_t sector)
+{
+	struct disk_info *disk = cache->disk;
+	struct disk_cache_block *blk;
+	uint32_t count = 0;
+	int rc;
+
+	while (count < BATCH_SECTORS && sector + count < cache->sector_count &&
+	       find_block(cache, sector + count) == NULL) {
+		count++;
+	}
+
+	if (count == 0 || disk->ops->read(disk, cache->batch, sector, count) != 0) {
+		/* Readahead is best effort */
+		return;
+	}
+
+	/* The batch buffer holds the data, so do not write back sectors */
+	for (uint32_t i = 0; i < count; i++) {
+		blk = alloc_block(cache, sector + i, false, &rc);
+		if (blk == NULL) {
+			break;
+		}
+
+		memcpy(blk->data, &cache->batch[i * cache->sector_size], cache->sector_size);
+		blk->dirty = false;
+	}
+}
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache *cache = disk->cache;
+	uint32_t size = cache->sector_size;
+	struct disk_cache_block *blk;
+	bool sequential;
+	uint32_t i = 0;
+	uint32_t run;
+	int rc = 0;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	sequential = start_sector == cache->next_sector;
+
+	while (i < num_sector) {
+		blk = find_block(cache, start_sector + i);
+		if (blk != NULL) {
+			memcpy(&data_buf[i * size], blk->data, size);
+			touch_block(cache, blk);
+			i++;
+			continue;
+		}
+
+		/* Read the whole run of missing sectors at once */
+		for (run = 1; i + run < num_sector; run++) {
+			if (find_block(cache, start_sector + i + run) != NULL) {
+				break;
+			}
+		}
+
+		rc = disk->ops->read(disk, &data_buf[i * size], start_sector + i, run);
+		if (rc != 0) {
+			break;
+		}
+
+		if (num_sector <= BATCH_SECTORS) {
+			for (uint32_t j = i; j < i + run; j++) {
+				/* Caching is best effort, the data was read */
+				(void)insert_sector(cache, start_sector + j, &data_buf[j * size],
+						    false);
+			}
+		}
+
+		i += run;
+	}
+
+	/* Stays ahead of a sequential reader, not only on the first miss */
+	if (IS_ENABLED(CONFIG_DISK_CACHE_READAHEAD) && rc == 0 && sequential) {
+		read_ahead(cache, start_sector + num_sector);
+	}
+
+	cache->next_sector = start_sector + num_sector;
+
+	k_mutex_unlock(&cache->lock);
+
+	return rc;
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache *cache = disk->cache;
+	uint32_t size = cache->sector_size;
+	struct disk_cache_block *blk;
+	int rc = 0;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	if (IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) && num_sector <= BATCH_SECTORS) {
+		for (uint32_t i = 0; i < num_sector && rc == 0; i++) {
+			rc = insert_sector(cache, start_sector + i, &data_buf[i * size], true);
+		}
+
+		goto out;
+	}
+
+	rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+	if (rc != 0) {
+		goto out;
+	}
+
+	for (uint32_t i = 0; i < num_sector; i++) {
+		blk = find_block(cache, start_sector + i);
+		if (blk != NULL) {
+			memcpy(blk->data, &data_buf[i * size], size);
+			blk->dirty = false;
+			touch_block(cache, blk);
+		} else if (num_sector <= BATCH_SECTORS) {
+			/* No sector is dirty with write-through, so this cannot fail */
+			(void)insert_sector(cache, start_sector + i, &data_buf[i * size], false);
+		}
+	}
+
+out:
+	k_mutex_unlock(&cache->lock);
+
+	return rc;
+}
+
+int disk_cache_sync(struct disk_info *disk)
+{
+	struct disk_cache *cache = disk->cache;
+	struct disk_cache_block *first;
+	int rc = 0;
+
+	if (cache == NULL || !IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK)) {
+		return 0;
+	}
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	/* Write back in ascending sector order, one run of sectors at a time */
+	do {
+		first = NULL;
+
+		for (size_t i = 0; i < ARRAY_SIZE(cache->blocks); i++) {
+			struct disk_cache_block *blk = &cache->blocks[i];
+
+			if (blk->valid && blk->dirty &&
+			    (first == NULL || blk->sector < first->sector)) {
+				first = blk;
+			}
+		}
+
+		if (first != NULL) {
+			rc = flush_run(cache, first);
+		}
+	} while (first != NULL && rc == 0);
+
+	k_mutex_unlock(&cache->lock);
+
+	return rc;
+}
+
+void disk_cache_attach(struct disk_info *disk)
+{
+	struct disk_cache *cache = NULL;
+	uint32_t sector_count = 0;
+	uint32_t sector_size = 0;
+	k_spinlock_key_t key;
+
+	if (disk->ops->ioctl == NULL ||
+	    disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) != 0 ||
+	    sector_size == 0 || sector_size > CONFIG_DISK_CACHE_SECTOR_SIZE) {
+		LOG_WRN("%s: sector size %u not supported by the cache", disk->name,
+			sector_size);
+		return;
+	}
+
+	if (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT, &sector_count) != 0) {
+		/* Only disables readahead */
+		sector_count = 0;
+	}
+
+	key = k_spin_lock(&lock);
+	for (size_t i = 0; i < ARRAY_SIZE(caches); i++) {
+		if (caches[i].disk == NULL) {
+			cache = &caches[i];
+			cache->disk = disk;
+			break;
+		}
+	}
+	k_spin_unlock(&lock, key);
+
+	if (cache == NULL) {
+		LOG_DBG("%s: no cache available", disk->name);
+		return;
+	}
+
+	k_mutex_init(&cache->lock);
+	sys_dlist_init(&cache->lru);
+	cache->sector_size = sector_size;
+	cache->sector_count = sector_count;
+	cache->next_sector = UINT32_MAX;
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache->blocks); i++) {
+		cache->blocks[i].valid = false;
+		cache->blocks[i].dirty = false;
+		sys_dlist_append(&cache->lru, &cache->blocks[i].node);
+	}
+
+	disk->cache = cache;
+	LOG_DBG("%s: cache of %u sectors", disk->name, CONFIG_DISK_CACHE_SECTORS);
+}
+
+void disk_cache_detach(struct disk_info *disk)
+{
+	struct disk_cache *cache = disk->cache;
+	k_spinlock_key_t key;
+
+	if (cache == NULL) {
+		return;
+	}
+
+	disk->cache = NULL;
+
+	key = k_spin_lock(&lock);
+	cache->disk = NULL;
+	k_spin_unlock(&lock, key);
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+#define ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+
+#include <zephyr/drivers/disk.h>
+
+#ifdef CONFIG_DISK_CACHE
+
+/* Assign a cache to an initialized disk, if one is available */
+void disk_cache_attach(struct disk_info *disk);
+
+/* Release the cache of a disk, dropping any unwritten sector */
+void disk_cache_detach(struct disk_info *disk);
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector);
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector);
+
+/* Write all modified sectors of a cached disk to the medium */
+int disk_cache_sync(struct disk_info *disk);
+
+#else
+
+static inline void disk_cache_attach(struct disk_info *disk)
+{
+	ARG_UNUSED(disk);
+}
+
+static inline void disk_cache_detach(struct disk_info *disk)
+{
+	ARG_UNUSED(disk);
+}
+
+static inline int disk_cache_sync(struct disk_info *disk)
+{
+	ARG_UNUSED(disk);
+
+	return 0;
+}
+
+#endif /* CONFIG_DISK_CACHE */
+
+#endif /* ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_ */
@@ -1047,6 +1047,8 @@ int ext2_free_block(struct ext2_data *fs, uint32_t block)
 {
 	LOG_DBG("Free block %d", block);
 
+	ext2_discard_block(fs, block);
+
 	/* Block bitmaps tracks blocks starting from s_first_data_block. */
 	block -= fs->sblock.s_first_data_block;
 
@@ -1158,7 +1160,7 @@ int ext2_free_inode(struct ext2_data *fs, uint32_t ino, bool directory)
 		LOG_DBG("block bitmap write returned: %d", rc);
 		return -EIO;
 	}
-	rc = fs->backend_ops->sync(fs);
+	rc = ext2_sync_blocks(fs);
 	if (rc < 0) {
 		return -EIO;
 	}
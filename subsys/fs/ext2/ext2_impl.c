@@ -25,11 +25,18 @@ static bool initialized;
 #define BLOCK_MEMORY_BUFFER_SIZE (CONFIG_EXT2_MAX_BLOCK_COUNT * CONFIG_EXT2_MAX_BLOCK_SIZE)
 #define BLOCK_STRUCT_BUFFER_SIZE (CONFIG_EXT2_MAX_BLOCK_COUNT * sizeof(struct ext2_block))
 
+/* Number of buckets of the block cache, must be a power of two */
+#define BLOCK_HASH_SIZE 32
+
 /* Structures for blocks slab alocator */
 struct k_mem_slab ext2_block_memory_slab, ext2_block_struct_slab;
 char __aligned(sizeof(void *)) __ext2_block_memory_buffer[BLOCK_MEMORY_BUFFER_SIZE];
 char __aligned(sizeof(void *)) __ext2_block_struct_buffer[BLOCK_STRUCT_BUFFER_SIZE];
 
+/* Block cache: blocks by number, and unused blocks, least recently used first */
+static sys_slist_t block_hash[BLOCK_HASH_SIZE];
+static sys_dlist_t block_lru;
+
 /* Initialize heap memory allocator */
 K_HEAP_DEFINE(direntry_heap, MAX_DIRENTRY_SIZE);
 K_MEM_SLAB_DEFINE(inode_struct_slab, sizeof(struct ext2_inode), MAX_INODES, sizeof(void *));
@@ -66,12 +73,87 @@ void error_behavior(struct ext2_data *fs, const char *msg)
 
 /* Block operations --------------------------------------------------------- */
 
-static struct ext2_block *get_block_struct(void)
+static inline sys_slist_t *block_bucket(uint32_t block)
+{
+	return &block_hash[block & (BLOCK_HASH_SIZE - 1)];
+}
+
+static struct ext2_block *lookup_block(uint32_t block)
+{
+	struct ext2_block *b;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(block_bucket(block), b, hash_node) {
+		if (b->num == block) {
+			return b;
+		}
+	}
+	return NULL;
+}
+
+static void cache_block(struct ext2_block *b)
+{
+	sys_slist_prepend(block_bucket(b->num), &b->hash_node);
+	b->flags |= EXT2_BLOCK_CACHED;
+}
+
+static void uncache_block(struct ext2_block *b)
+{
+	sys_slist_find_and_remove(block_bucket(b->num), &b->hash_node);
+	b->flags &= ~(EXT2_BLOCK_CACHED | EXT2_BLOCK_DIRTY);
+}
+
+static void free_block_struct(struct ext2_block *b)
+{
+	k_mem_slab_free(&ext2_block_memory_slab, (void *)b->data);
+	k_mem_slab_free(&ext2_block_struct_slab, (void *)b);
+}
+
+static int write_back_block(struct ext2_data *fs, struct ext2_block *b)
+{
+	int ret;
+
+	ret = fs->backend_ops->write_block(fs, b->data, b->num);
+	if (ret < 0) {
+		LOG_ERR("write back block %d error %d", b->num, ret);
+		return ret;
+	}
+	b->flags &= ~EXT2_BLOCK_DIRTY;
+	return 0;
+}
+
+/* Free the least recently used unused block, writing it back if it was modified. */
+static int evict_block(struct ext2_data *fs)
+{
+	int ret;
+	struct ext2_block *b = SYS_DLIST_PEEK_HEAD_CONTAINER(&block_lru, b, lru_node);
+
+	if (b == NULL) {
+		return -ENOMEM;
+	}
+
+	if (b->flags & EXT2_BLOCK_DIRTY) {
+		ret = write_back_block(fs, b);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	sys_dlist_remove(&b->lru_node);
+	uncache_block(b);
+	free_block_struct(b);
+	return 0;
+}
+
+static struct ext2_block *get_block_struct(struct ext2_data *fs)
 {
 	int ret;
 	struct ext2_block *b;
 
 	ret = k_mem_slab_alloc(&ext2_block_struct_slab, (void **)&b, K_NO_WAIT);
+	if (ret < 0 && evict_block(fs) == 0) {
+		/* Both slabs have room for one more block now */
+		ret = k_mem_slab_alloc(&ext2_block_struct_slab, (void **)&b, K_NO_WAIT);
+	}
 	if (ret < 0) {
 		LOG_ERR("get block: alloc block struct error %d", ret);
 		return NULL;
@@ -83,14 +165,23 @@ static struct ext2_block *get_block_struct(void)
 		k_mem_slab_free(&ext2_block_struct_slab, (void *)b);
 		return NULL;
 	}
+	b->refs = 1;
 	return b;
 }
 
 struct ext2_block *ext2_get_block(struct ext2_data *fs, uint32_t block)
 {
 	int ret;
-	struct ext2_block *b = get_block_struct();
+	struct ext2_block *b = lookup_block(block);
+
+	if (b != NULL) {
+		if (b->refs++ == 0) {
+			sys_dlist_remove(&b->lru_node);
+		}
+		return b;
+	}
 
+	b = get_block_struct(fs);
 	if (!b) {
 		return NULL;
 	}
@@ -102,12 +193,13 @@ struct ext2_block *ext2_get_block(struct ext2_data *fs, uint32_t block)
 		ext2_drop_block(b);
 		return NULL;
 	}
+	cache_block(b);
 	return b;
 }
 
 struct ext2_block *ext2_get_empty_block(struct ext2_data *fs)
 {
-	struct ext2_block *b = get_block_struct();
+	struct ext2_block *b = get_block_struct(fs);
 
 	if (!b) {
 		return NULL;
@@ -126,6 +218,12 @@ int ext2_write_block(struct ext2_data *fs, struct ext2_block *b)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_EXT2_BLOCK_CACHE) && (b->flags & EXT2_BLOCK_CACHED)) {
+		/* Written back on eviction or by ext2_sync_blocks() */
+		b->flags |= EXT2_BLOCK_DIRTY;
+		return 0;
+	}
+
 	ret = fs->backend_ops->write_block(fs, b->data, b->num);
 	if (ret < 0) {
 		return ret;
@@ -139,12 +237,69 @@ void ext2_drop_block(struct ext2_block *b)
 		return;
 	}
 
-	if (b != NULL && b->data != NULL) {
-		k_mem_slab_free(&ext2_block_memory_slab, (void *)b->data);
-		k_mem_slab_free(&ext2_block_struct_slab, (void *)b);
+	__ASSERT(b->refs > 0, "Block %d dropped more times than fetched", b->num);
+	if (--b->refs > 0) {
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_EXT2_BLOCK_CACHE) && (b->flags & EXT2_BLOCK_CACHED)) {
+		/* Keep the block until its memory is needed for another one */
+		sys_dlist_append(&block_lru, &b->lru_node);
+		return;
+	}
+
+	if (b->flags & EXT2_BLOCK_CACHED) {
+		uncache_block(b);
+	}
+	free_block_struct(b);
+}
+
+void ext2_discard_block(struct ext2_data *fs, uint32_t block)
+{
+	struct ext2_block *b = lookup_block(block);
+
+	ARG_UNUSED(fs);
+
+	if (b == NULL) {
+		return;
+	}
+
+	/* Users still holding the block keep a private copy of it */
+	uncache_block(b);
+	if (b->refs == 0) {
+		sys_dlist_remove(&b->lru_node);
+		free_block_struct(b);
 	}
 }
 
+int ext2_sync_blocks(struct ext2_data *fs)
+{
+	int ret;
+	struct ext2_block *b, *first;
+
+	/* Write back modified blocks in ascending order */
+	do {
+		first = NULL;
+		for (int i = 0; i < BLOCK_HASH_SIZE; i++) {
+			SYS_SLIST_FOR_EACH_CONTAINER(&block_hash[i], b, hash_node) {
+				if ((b->flags & EXT2_BLOCK_DIRTY) &&
+				    (first == NULL || b->num < first->num)) {
+					first = b;
+				}
+			}
+		}
+
+		if (first != NULL) {
+			ret = write_back_block(fs, first);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+	} while (first != NULL);
+
+	return fs->backend_ops->sync(fs);
+}
+
 void ext2_init_blocks_slab(struct ext2_data *fs)
 {
 	memset(__ext2_block_memory_buffer, 0, BLOCK_MEMORY_BUFFER_SIZE);
@@ -157,6 +312,12 @@ void ext2_init_blocks_slab(struct ext2_data *fs)
 
 	k_mem_slab_init(&ext2_block_memory_slab, __ext2_block_memory_buffer, fs->block_size,
 			CONFIG_EXT2_MAX_BLOCK_COUNT);
+
+	/* Blocks cached for a previous instance are gone with the slabs */
+	for (int i = 0; i < BLOCK_HASH_SIZE; i++) {
+		sys_slist_init(&block_hash[i]);
+	}
+	sys_dlist_init(&block_lru);
 }
 
 int ext2_assign_block_num(struct ext2_data *fs, struct ext2_block *b)
@@ -173,8 +334,12 @@ int ext2_assign_block_num(struct ext2_data *fs, struct ext2_block *b)
 		return new_block;
 	}
 
+	/* A cached copy of the block from before it was freed is stale */
+	ext2_discard_block(fs, new_block);
+
 	b->num = new_block;
 	b->flags |= EXT2_BLOCK_ASSIGNED;
+	cache_block(b);
 	return 0;
 }
 
@@ -323,6 +488,14 @@ int ext2_init_fs(struct ext2_data *fs)
 		if (ret < 0) {
 			return ret;
 		}
+
+		/* Mark the file system as in use on the medium right away, so
+		 * that it is checked if the device resets before the first sync
+		 */
+		ret = ext2_sync_blocks(fs);
+		if (ret < 0) {
+			return ret;
+		}
 	}
 
 	ret = ext2_fetch_block_group(fs, 0);
@@ -384,7 +557,7 @@ int ext2_close_fs(struct ext2_data *fs)
 	ext2_drop_block(fs->bgroup.inode_bitmap);
 	ext2_drop_block(fs->bgroup.block_bitmap);
 
-	if (fs->backend_ops->sync(fs) < 0) {
+	if (ext2_sync_blocks(fs) < 0) {
 		return -EIO;
 	}
 	return 0;
@@ -790,12 +963,8 @@ int ext2_inode_sync(struct ext2_inode *inode)
 		if (ret < 0) {
 			return ret;
 		}
-		ret = fs->backend_ops->sync(fs);
-		if (ret < 0) {
-			return ret;
-		}
 	}
-	return 0;
+	return ext2_sync_blocks(fs);
 }
 
 int ext2_get_direntry(struct ext2_file *dir, struct fs_dirent *ent)
@@ -31,15 +31,31 @@ struct ext2_block *ext2_get_block(struct ext2_data *fs, uint32_t block);
 struct ext2_block *ext2_get_empty_block(struct ext2_data *fs);
 
 /**
- * @brief Free the block structure.
+ * @brief Release the block structure.
+ *
+ * With CONFIG_EXT2_BLOCK_CACHE the block is kept in memory until it is needed
+ * for another one.
  */
 void ext2_drop_block(struct ext2_block *b);
 
+/**
+ * @brief Drop the cached copy of a block whose content is no longer needed.
+ *
+ * Used when the block is freed or allocated again.
+ */
+void ext2_discard_block(struct ext2_data *fs, uint32_t block);
+
+/**
+ * @brief Write all modified blocks to the disk and sync it.
+ */
+int ext2_sync_blocks(struct ext2_data *fs);
+
 /**
  * @brief Write block to the disk.
  *
  * NOTICE: to ensure that all writes has ended the sync of disk must be triggered
- * (fs::sync function).
+ * (fs::sync function). With CONFIG_EXT2_BLOCK_CACHE the block is only marked as
+ * modified and written by ext2_sync_blocks() or when it is evicted.
  */
 int ext2_write_block(struct ext2_data *fs, struct ext2_block *b);
 
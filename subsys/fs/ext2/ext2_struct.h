@@ -131,11 +131,16 @@ struct ext2_superblock {
 	((struct ext2_disk_direntry *)(((uint8_t *)(addr)) + (offset)))
 
 #define EXT2_BLOCK_ASSIGNED BIT(0)
+#define EXT2_BLOCK_CACHED   BIT(1) /* found by its number in the block cache */
+#define EXT2_BLOCK_DIRTY    BIT(2) /* modified but not written to the disk yet */
 
 struct ext2_block {
 	uint32_t num;
 	uint8_t flags;
+	uint16_t refs;
 	uint8_t *data;
+	sys_snode_t hash_node;
+	sys_dnode_t lru_node; /* linked only if refs is 0 */
 } __aligned(sizeof(void *));
 
 #define BGROUP_INODE_TABLE(bg) ((struct ext2_disk_inode *)(bg)->inode_table->data)
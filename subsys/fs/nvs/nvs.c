@@ -19,9 +19,10 @@ LOG_MODULE_REGISTER(fs_nvs, CONFIG_NVS_LOG_LEVEL);
 static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate);
 static int nvs_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry);
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#if defined(CONFIG_NVS_LOOKUP_CACHE) || defined(CONFIG_NVS_LOOKUP_INDEX)
+#define NVS_LOOKUP
 
-static inline size_t nvs_lookup_cache_pos(uint16_t id)
+static inline uint16_t nvs_lookup_hash(uint16_t id)
 {
 	uint16_t hash;
 
@@ -33,17 +34,174 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	hash *= 0xdb2dU;
 	hash ^= hash >> 9;
 
-	return hash % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	return hash;
+}
+#endif
+
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+
+static inline size_t nvs_lookup_cache_pos(uint16_t id)
+{
+	return nvs_lookup_hash(id) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+}
+
+static void nvs_lookup_clear(struct nvs_fs *fs)
+{
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+}
+
+/* Record addr for id during a rebuild, unless a more recent ATE was seen */
+static void nvs_lookup_add(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+	uint32_t *cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(id)];
+
+	if (*cache_entry == NVS_LOOKUP_CACHE_NO_ADDR) {
+		*cache_entry = addr;
+	}
+}
+
+static inline void nvs_lookup_set(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+	fs->lookup_cache[nvs_lookup_cache_pos(id)] = addr;
+}
+
+/* Address to start searching for id from, NVS_LOOKUP_CACHE_NO_ADDR if absent */
+static inline uint32_t nvs_lookup_get(struct nvs_fs *fs, uint16_t id)
+{
+	return fs->lookup_cache[nvs_lookup_cache_pos(id)];
+}
+
+/* Make every lookup start from the given address, i.e. search everything */
+static void nvs_lookup_disable(struct nvs_fs *fs, uint32_t addr)
+{
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		fs->lookup_cache[i] = addr;
+	}
 }
 
-static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
+static void nvs_lookup_invalidate(struct nvs_fs *fs, uint32_t sector)
+{
+	uint32_t *cache_entry = fs->lookup_cache;
+	uint32_t *const cache_end = &fs->lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+
+	for (; cache_entry < cache_end; ++cache_entry) {
+		if ((*cache_entry >> ADDR_SECT_SHIFT) == sector) {
+			*cache_entry = NVS_LOOKUP_CACHE_NO_ADDR;
+		}
+	}
+}
+
+#endif /* CONFIG_NVS_LOOKUP_CACHE */
+
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+
+/* Slots in use beyond which no new ID is indexed, keeps probe sequences short */
+#define NVS_LOOKUP_INDEX_MAX_FILL \
+	(CONFIG_NVS_LOOKUP_INDEX_SIZE - CONFIG_NVS_LOOKUP_INDEX_SIZE / 8)
+
+/* The index is an open addressing hash table, with linear probing, from
+ * ID to the address of the most recent ATE written for that ID.  Slots
+ * are never freed: a deleted ID whose delete ATE has been garbage
+ * collected is kept with an address of NVS_LOOKUP_CACHE_NO_ADDR.  If
+ * the table fills up, IDs that are not in it are searched for by
+ * walking the ATEs.
+ */
+static int nvs_lookup_index_slot(struct nvs_fs *fs, uint16_t id)
+{
+	size_t pos = nvs_lookup_hash(id) % CONFIG_NVS_LOOKUP_INDEX_SIZE;
+
+	for (size_t n = 0; n < CONFIG_NVS_LOOKUP_INDEX_SIZE; n++) {
+		uint16_t slot_id = fs->lookup_index_id[pos];
+
+		if ((slot_id == id) || (slot_id == NVS_LOOKUP_INDEX_EMPTY)) {
+			return pos;
+		}
+
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_INDEX_SIZE;
+	}
+
+	return -1;
+}
+
+static void nvs_lookup_clear(struct nvs_fs *fs)
+{
+	memset(fs->lookup_index_id, 0xff, sizeof(fs->lookup_index_id));
+	fs->lookup_index_count = 0U;
+	fs->lookup_index_complete = true;
+}
+
+static void nvs_lookup_set(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+	int slot = nvs_lookup_index_slot(fs, id);
+
+	if ((slot < 0) || ((fs->lookup_index_id[slot] != id) &&
+			   (fs->lookup_index_count >= NVS_LOOKUP_INDEX_MAX_FILL))) {
+		if (fs->lookup_index_complete) {
+			LOG_WRN("Lookup index full, falling back to ATE walks");
+		}
+		fs->lookup_index_complete = false;
+		return;
+	}
+
+	if (fs->lookup_index_id[slot] != id) {
+		fs->lookup_index_id[slot] = id;
+		fs->lookup_index_count++;
+	}
+	fs->lookup_index_addr[slot] = addr;
+}
+
+/* Record addr for id during a rebuild, unless a more recent ATE was seen */
+static void nvs_lookup_add(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+	int slot = nvs_lookup_index_slot(fs, id);
+
+	if ((slot < 0) || (fs->lookup_index_id[slot] != id)) {
+		nvs_lookup_set(fs, id, addr);
+	}
+}
+
+/* Address to start searching for id from, NVS_LOOKUP_CACHE_NO_ADDR if absent */
+static uint32_t nvs_lookup_get(struct nvs_fs *fs, uint16_t id)
+{
+	int slot = nvs_lookup_index_slot(fs, id);
+
+	if ((slot >= 0) && (fs->lookup_index_id[slot] == id)) {
+		return fs->lookup_index_addr[slot];
+	}
+
+	return fs->lookup_index_complete ? NVS_LOOKUP_CACHE_NO_ADDR : fs->ate_wra;
+}
+
+/* Make lookups of IDs not indexed from now on search everything */
+static void nvs_lookup_disable(struct nvs_fs *fs, uint32_t addr)
+{
+	ARG_UNUSED(addr);
+
+	nvs_lookup_clear(fs);
+	fs->lookup_index_complete = false;
+}
+
+static void nvs_lookup_invalidate(struct nvs_fs *fs, uint32_t sector)
+{
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_INDEX_SIZE; i++) {
+		if ((fs->lookup_index_id[i] != NVS_LOOKUP_INDEX_EMPTY) &&
+		    ((fs->lookup_index_addr[i] >> ADDR_SECT_SHIFT) == sector)) {
+			fs->lookup_index_addr[i] = NVS_LOOKUP_CACHE_NO_ADDR;
+		}
+	}
+}
+
+#endif /* CONFIG_NVS_LOOKUP_INDEX */
+
+#ifdef NVS_LOOKUP
+
+static int nvs_lookup_rebuild(struct nvs_fs *fs)
 {
 	int rc;
 	uint32_t addr, ate_addr;
-	uint32_t *cache_entry;
 	struct nvs_ate ate;
 
-	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	nvs_lookup_clear(fs);
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -55,11 +213,8 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
-
-		if (ate.id != 0xFFFF && *cache_entry == NVS_LOOKUP_CACHE_NO_ADDR &&
-		    nvs_ate_valid(fs, &ate)) {
-			*cache_entry = ate_addr;
+		if (ate.id != 0xFFFF && nvs_ate_valid(fs, &ate)) {
+			nvs_lookup_add(fs, ate.id, ate_addr);
 		}
 
 		if (addr == fs->ate_wra) {
@@ -70,19 +225,7 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 	return 0;
 }
 
-static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
-{
-	uint32_t *cache_entry = fs->lookup_cache;
-	uint32_t *const cache_end = &fs->lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
-
-	for (; cache_entry < cache_end; ++cache_entry) {
-		if ((*cache_entry >> ADDR_SECT_SHIFT) == sector) {
-			*cache_entry = NVS_LOOKUP_CACHE_NO_ADDR;
-		}
-	}
-}
-
-#endif /* CONFIG_NVS_LOOKUP_CACHE */
+#endif /* NVS_LOOKUP */
 
 /* basic routines */
 /* nvs_al_size returns size aligned to fs->write_block_size */
@@ -163,10 +306,10 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 
 	rc = nvs_flash_al_wrt(fs, fs->ate_wra, entry,
 			       sizeof(struct nvs_ate));
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#ifdef NVS_LOOKUP
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
-		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
+		nvs_lookup_set(fs, entry->id, fs->ate_wra);
 	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -341,8 +484,8 @@ static int nvs_flash_erase_sector(struct nvs_fs *fs, uint32_t addr)
 	LOG_DBG("Erasing flash at %lx, len %d", (long int) offset,
 		fs->sector_size);
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
-	nvs_lookup_cache_invalidate(fs, addr >> ADDR_SECT_SHIFT);
+#ifdef NVS_LOOKUP
+	nvs_lookup_invalidate(fs, addr >> ADDR_SECT_SHIFT);
 #endif
 	rc = flash_flatten(fs->flash_device, offset, fs->sector_size);
 
@@ -673,8 +816,8 @@ static int nvs_gc(struct nvs_fs *fs)
 			continue;
 		}
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
+#ifdef NVS_LOOKUP
+		wlk_addr = nvs_lookup_get(fs, gc_ate.id);
 
 		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 			wlk_addr = fs->ate_wra;
@@ -917,15 +1060,13 @@ static int nvs_startup(struct nvs_fs *fs)
 		fs->ate_wra &= ADDR_SECT_MASK;
 		fs->ate_wra += (fs->sector_size - 2 * ate_size);
 		fs->data_wra = (fs->ate_wra & ADDR_SECT_MASK);
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#ifdef NVS_LOOKUP
 		/**
 		 * At this point, the lookup cache wasn't built but the gc function need to use it.
 		 * So, temporarily, we set the lookup cache to the end of the fs.
 		 * The cache will be rebuilt afterwards
 		 **/
-		for (i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
-			fs->lookup_cache[i] = fs->ate_wra;
-		}
+		nvs_lookup_disable(fs, fs->ate_wra);
 #endif
 		rc = nvs_gc(fs);
 		goto end;
@@ -962,9 +1103,9 @@ static int nvs_startup(struct nvs_fs *fs)
 
 end:
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#ifdef NVS_LOOKUP
 	if (!rc) {
-		rc = nvs_lookup_cache_rebuild(fs);
+		rc = nvs_lookup_rebuild(fs);
 	}
 #endif
 	/* If the sector is empty add a gc done ate to avoid having insufficient
@@ -1090,8 +1231,8 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	}
 
 	/* find latest entry with same id */
-#ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+#ifdef NVS_LOOKUP
+	wlk_addr = nvs_lookup_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1116,7 +1257,7 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 		}
 	}
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#ifdef NVS_LOOKUP
 no_cached_entry:
 #endif
 
@@ -1226,8 +1367,8 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 
 	cnt_his = 0U;
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+#ifdef NVS_LOOKUP
+	wlk_addr = nvs_lookup_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
@@ -127,37 +127,193 @@ int llext_iterate(int (*fn)(struct llext *ext, void *arg), void *arg)
 	return ret;
 }
 
+#ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+/*
+ * The llext_const_symbol_area section is sorted in ascending SLID order
+ * (see scripts/build/llext_prepare_exptab.py).
+ */
+static const void *llext_find_builtin_sym(uintptr_t slid)
+{
+	const struct llext_const_symbol *sym;
+	size_t lo = 0, hi;
+
+	STRUCT_SECTION_COUNT(llext_const_symbol, &hi);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		STRUCT_SECTION_GET(llext_const_symbol, mid, &sym);
+		if (sym->slid == slid) {
+			return sym->addr;
+		} else if (sym->slid < slid) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return NULL;
+}
+#else
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+/*
+ * scripts/build/llext_prepare_exptab.py sorts the llext_const_symbol_area
+ * section by name when the image is built. Images it could not process,
+ * such as position independent ones, are searched linearly instead, so
+ * check the order once before relying on it.
+ */
+static bool llext_builtin_syms_sorted(void)
+{
+	/* 1 if sorted, 0 if not, -1 until checked */
+	static int sorted = -1;
+	const struct llext_const_symbol *prev = NULL;
+
+	if (sorted >= 0) {
+		return sorted;
+	}
+
+	sorted = 1;
+	STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
+		if (prev != NULL && strcmp(prev->name, sym->name) >= 0) {
+			LOG_DBG("built-in symbol table is not sorted");
+			sorted = 0;
+			break;
+		}
+		prev = sym;
+	}
+
+	return sorted;
+}
+#endif /* CONFIG_LLEXT_SYMBOL_INDEX */
+
+static const void *llext_find_builtin_sym(const char *sym_name)
+{
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+	if (llext_builtin_syms_sorted()) {
+		const struct llext_const_symbol *sym;
+		size_t lo = 0, hi;
+		int cmp;
+
+		STRUCT_SECTION_COUNT(llext_const_symbol, &hi);
+
+		while (lo < hi) {
+			size_t mid = lo + (hi - lo) / 2;
+
+			STRUCT_SECTION_GET(llext_const_symbol, mid, &sym);
+			cmp = strcmp(sym->name, sym_name);
+			if (cmp == 0) {
+				return sym->addr;
+			} else if (cmp < 0) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+
+		return NULL;
+	}
+#endif /* CONFIG_LLEXT_SYMBOL_INDEX */
+
+	STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
+		if (strcmp(sym->name, sym_name) == 0) {
+			return sym->addr;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID */
+
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+/* FNV-1a */
+static uint32_t llext_sym_hash(const char *name)
+{
+	uint32_t hash = 2166136261U;
+
+	while (*name != '\0') {
+		hash = (hash ^ (uint8_t)*name++) * 16777619U;
+	}
+
+	return hash;
+}
+
+void llext_symtable_index(struct llext_symtable *sym_table)
+{
+	size_t size = 1, mask, slot;
+
+	sym_table->index = NULL;
+	sym_table->index_size = 0;
+
+	if (sym_table->sym_cnt == 0 || sym_table->sym_cnt >= UINT16_MAX) {
+		/* Nothing to index, or too many symbols: searched linearly */
+		return;
+	}
+
+	/* Keep the table at most half full */
+	while (size < 2 * sym_table->sym_cnt) {
+		size <<= 1;
+	}
+
+	sym_table->index = llext_alloc(size * sizeof(sym_table->index[0]));
+	if (sym_table->index == NULL) {
+		LOG_WRN("no memory to index %zu symbols", sym_table->sym_cnt);
+		return;
+	}
+
+	memset(sym_table->index, 0, size * sizeof(sym_table->index[0]));
+	sym_table->index_size = size;
+	mask = size - 1;
+
+	for (size_t i = 0; i < sym_table->sym_cnt; i++) {
+		slot = llext_sym_hash(sym_table->syms[i].name) & mask;
+		while (sym_table->index[slot] != 0) {
+			slot = (slot + 1) & mask;
+		}
+		sym_table->index[slot] = i + 1;
+	}
+}
+
+void llext_symtable_index_free(struct llext_symtable *sym_table)
+{
+	llext_free(sym_table->index);
+	sym_table->index = NULL;
+	sym_table->index_size = 0;
+}
+#endif /* CONFIG_LLEXT_SYMBOL_INDEX */
+
 const void *llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
 {
 	if (sym_table == NULL) {
 		/* Built-in symbol table */
 #ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
 		/* 'sym_name' is actually a SLID to search for */
-		uintptr_t slid = (uintptr_t)sym_name;
-
-		/* TODO: perform a binary search instead of linear.
-		 * Note that - as of writing - the llext_const_symbol_area
-		 * section is sorted in ascending SLID order.
-		 * (see scripts/build/llext_prepare_exptab.py)
-		 */
-		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
-			if (slid == sym->slid) {
-				return sym->addr;
-			}
-		}
+		return llext_find_builtin_sym((uintptr_t)sym_name);
 #else
-		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
+		return llext_find_builtin_sym(sym_name);
+#endif
+	}
+
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+	if (sym_table->index != NULL) {
+		size_t mask = sym_table->index_size - 1;
+		size_t slot = llext_sym_hash(sym_name) & mask;
+		const struct llext_symbol *sym;
+
+		for (; sym_table->index[slot] != 0; slot = (slot + 1) & mask) {
+			sym = &sym_table->syms[sym_table->index[slot] - 1];
 			if (strcmp(sym->name, sym_name) == 0) {
 				return sym->addr;
 			}
 		}
-#endif
-	} else {
-		/* find symbols in module */
-		for (size_t i = 0; i < sym_table->sym_cnt; i++) {
-			if (strcmp(sym_table->syms[i].name, sym_name) == 0) {
-				return sym_table->syms[i].addr;
-			}
+
+		return NULL;
+	}
+#endif /* CONFIG_LLEXT_SYMBOL_INDEX */
+
+	/* find symbols in module */
+	for (size_t i = 0; i < sym_table->sym_cnt; i++) {
+		if (strcmp(sym_table->syms[i].name, sym_name) == 0) {
+			return sym_table->syms[i].addr;
 		}
 	}
 
@@ -244,6 +400,9 @@ int llext_unload(struct llext **ext)
 	llext_free_regions(tmp);
 	llext_free(tmp->sym_tab.syms);
 	llext_free(tmp->exp_tab.syms);
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+	llext_symtable_index_free(&tmp->exp_tab);
+#endif
 	llext_free(tmp);
 
 	return 0;
@@ -128,6 +128,10 @@ int llext_restore(struct llext **ext, struct llext_loader **ldr, unsigned int n_
 		if (next->exp_tab.sym_cnt) {
 			next->exp_tab.syms = exp_tab[j++];
 		}
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+		/* The saved index is stale */
+		llext_symtable_index(&next->exp_tab);
+#endif
 
 		sys_slist_append(&llext_list, &next->llext_list);
 	}
@@ -26,6 +26,18 @@ LOG_MODULE_DECLARE(llext, CONFIG_LLEXT_LOG_LEVEL);
 #define SYM_NAME_OR_SLID(name, slid) name
 #endif
 
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+/*
+ * Undefined symbols already resolved while linking the current extension,
+ * by symbol table index: most relocations refer to a few imported functions
+ * and variables. Extensions are linked one at a time under llext_lock.
+ */
+static struct {
+	size_t sym_idx;
+	uintptr_t addr;
+} sym_cache[CONFIG_LLEXT_SYMBOL_CACHE_SIZE];
+#endif
+
 __weak int arch_elf_relocate(struct llext_loader *ldr, struct llext *ext, elf_rela_t *rel,
 			     const elf_shdr_t *shdr)
 {
@@ -177,6 +189,16 @@ int llext_lookup_symbol(struct llext_loader *ldr, struct llext *ext, uintptr_t *
 		 */
 		*link_addr = 0;
 	} else if (sym->st_shndx == SHN_UNDEF) {
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+		size_t sym_idx = ELF_R_SYM(rel->r_info);
+		size_t slot = sym_idx % ARRAY_SIZE(sym_cache);
+
+		if (sym_cache[slot].sym_idx == sym_idx) {
+			*link_addr = sym_cache[slot].addr;
+			return 0;
+		}
+#endif
+
 		/* If symbol is undefined, then we need to look it up */
 		*link_addr = (uintptr_t)llext_find_sym(NULL, SYM_NAME_OR_SLID(name, sym->st_value));
 
@@ -216,6 +238,10 @@ int llext_lookup_symbol(struct llext_loader *ldr, struct llext *ext, uintptr_t *
 		}
 
 		LOG_DBG("found symbol %s at %#lx", name, *link_addr);
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+		sym_cache[slot].sym_idx = sym_idx;
+		sym_cache[slot].addr = *link_addr;
+#endif
 	} else if (sym->st_shndx == SHN_ABS) {
 		/* Absolute symbol */
 		*link_addr = sym->st_value;
@@ -412,6 +438,11 @@ int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_l
 	int link_err = 0;
 	int i, ret;
 
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+	/* Symbol index 0 is never looked up, so this empties the cache */
+	memset(sym_cache, 0, sizeof(sym_cache));
+#endif
+
 	for (i = 0; i < ext->sect_cnt; ++i) {
 		elf_shdr_t *shdr = ext->sect_hdrs + i;
 
@@ -633,6 +633,11 @@ static int llext_export_symbols(struct llext_loader *ldr, struct llext *ext,
 		LOG_DBG("sym %p name %s", sym->addr, sym->name);
 	}
 
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+	/* Other extensions look up their imports in this table */
+	llext_symtable_index(exp_tab);
+#endif
+
 	return 0;
 }
 
@@ -854,6 +859,9 @@ out:
 		llext_free(ext->exp_tab.syms);
 		ext->exp_tab.sym_cnt = 0;
 		ext->exp_tab.syms = NULL;
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+		llext_symtable_index_free(&ext->exp_tab);
+#endif
 	} else {
 		LOG_DBG("Loaded llext: %zu bytes in heap, .text at %p, .rodata at %p",
 			ext->alloc_size, ext->mem[LLEXT_MEM_TEXT], ext->mem[LLEXT_MEM_RODATA]);
@@ -87,4 +87,14 @@ int llext_link(struct llext_loader *ldr, struct llext *ext,
 ssize_t llext_file_offset(struct llext_loader *ldr, uintptr_t offset);
 void llext_dependency_remove_all(struct llext *ext);
 
+/*
+ * Symbol lookup (llext.c)
+ */
+
+#ifdef CONFIG_LLEXT_SYMBOL_INDEX
+/* Tables which cannot be indexed are searched linearly */
+void llext_symtable_index(struct llext_symtable *sym_table);
+void llext_symtable_index_free(struct llext_symtable *sym_table);
+#endif
+
 #endif /* ZEPHYR_SUBSYS_LLEXT_PRIV_H_ */
@@ -125,16 +125,34 @@ static STRUCT_SECTION_ITERABLE(log_msg_ptr, log_msg_ptr);
 static STRUCT_SECTION_ITERABLE_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer, log_buffer);
 static struct mpsc_pbuf_buffer *curr_log_buffer;
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+#define LOG_CPU_BUFFERS CONFIG_MP_MAX_NUM_CPUS
+
+/* CPU 0 uses log_buffer, these are the buffers of the other CPUs and the
+ * messages claimed from them but not processed yet.
+ */
+static struct mpsc_pbuf_buffer cpu_log_buffer[LOG_CPU_BUFFERS - 1];
+static struct log_msg_ptr cpu_msg_ptr[LOG_CPU_BUFFERS - 1];
+#else
+#define LOG_CPU_BUFFERS 1
+#endif
+
 #ifdef CONFIG_MPSC_PBUF
+/* CONFIG_LOG_BUFFER_SIZE is split evenly between the buffers, each one kept
+ * aligned for messages.
+ */
+#define LOG_CPU_BUFFER_WLEN \
+	(ROUND_DOWN(CONFIG_LOG_BUFFER_SIZE / LOG_CPU_BUFFERS, Z_LOG_MSG_ALIGNMENT) / sizeof(int))
+
 static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
-	buf32[CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+	buf32[LOG_CPU_BUFFERS][LOG_CPU_BUFFER_WLEN];
 
 static void z_log_notify_drop(const struct mpsc_pbuf_buffer *buffer,
 			      const union mpsc_pbuf_generic *item);
 
 static const struct mpsc_pbuf_buffer_config mpsc_config = {
-	.buf = (uint32_t *)buf32,
-	.size = ARRAY_SIZE(buf32),
+	.buf = (uint32_t *)buf32[0],
+	.size = ARRAY_SIZE(buf32[0]),
 	.notify_drop = z_log_notify_drop,
 	.get_wlen = log_msg_generic_get_wlen,
 	.flags = (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?
@@ -648,11 +666,50 @@ bool z_log_dropped_pending(void)
 	return dropped_cnt > 0;
 }
 
+static struct mpsc_pbuf_buffer *cpu_buffer(unsigned int cpu)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	return (cpu == 0U) ? &log_buffer : &cpu_log_buffer[cpu - 1U];
+#else
+	ARG_UNUSED(cpu);
+
+	return &log_buffer;
+#endif
+}
+
+/* Buffer of the CPU the caller runs on. A thread may migrate before it
+ * commits the message, which is why commit looks the buffer up from the
+ * message address instead.
+ */
+static struct mpsc_pbuf_buffer *local_buffer(void)
+{
+	return cpu_buffer(IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS) ?
+			  arch_curr_cpu()->id : 0U);
+}
+
+static struct mpsc_pbuf_buffer *msg_buffer(struct log_msg *msg)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	return cpu_buffer(((uintptr_t)msg - (uintptr_t)buf32) / sizeof(buf32[0]));
+#else
+	ARG_UNUSED(msg);
+
+	return &log_buffer;
+#endif
+}
+
 void z_log_msg_init(void)
 {
 #ifdef CONFIG_MPSC_PBUF
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
+
+	for (unsigned int i = 1; i < LOG_CPU_BUFFERS; i++) {
+		struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+		config.buf = buf32[i];
+		mpsc_pbuf_init(cpu_buffer(i), &config);
+	}
 #endif
 }
 
@@ -671,7 +728,7 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
-	return msg_alloc(&log_buffer, wlen);
+	return msg_alloc(local_buffer(), wlen);
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -703,7 +760,7 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
-	msg_commit(&log_buffer, msg);
+	msg_commit(msg_buffer(msg), msg);
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -716,7 +773,34 @@ union log_msg_generic *z_log_msg_local_claim(void)
 
 }
 
-/* If there are buffers dedicated for each link, claim the oldest message (lowest timestamp). */
+/* Peek at the next message of the buffer and pick it if it is older than the
+ * oldest one found so far.
+ */
+static void msg_oldest_check(struct log_msg_ptr *msg_ptr,
+			     struct mpsc_pbuf_buffer *buffer,
+			     log_timestamp_t *t_min,
+			     struct log_msg_ptr **chosen)
+{
+#ifdef CONFIG_MPSC_PBUF
+	if (msg_ptr->msg == NULL) {
+		msg_ptr->msg = (union log_msg_generic *)mpsc_pbuf_claim(buffer);
+	}
+#endif
+
+	if (msg_ptr->msg) {
+		log_timestamp_t t = log_msg_get_timestamp(&msg_ptr->msg->log);
+
+		if (t < *t_min) {
+			*t_min = t;
+			*chosen = msg_ptr;
+			curr_log_buffer = buffer;
+		}
+	}
+}
+
+/* If there are buffers dedicated for each link or CPU, claim the oldest
+ * message (lowest timestamp).
+ */
 union log_msg_generic *z_log_msg_claim_oldest(k_timeout_t *backoff)
 {
 	union log_msg_generic *msg = NULL;
@@ -730,24 +814,18 @@ union log_msg_generic *z_log_msg_claim_oldest(k_timeout_t *backoff)
 		struct log_mpsc_pbuf *buf;
 
 		STRUCT_SECTION_GET(log_mpsc_pbuf, i, &buf);
+		msg_oldest_check(msg_ptr, &buf->buf, &t_min, &chosen);
+		i++;
+	}
 
-#ifdef CONFIG_MPSC_PBUF
-		if (msg_ptr->msg == NULL) {
-			msg_ptr->msg = (union log_msg_generic *)mpsc_pbuf_claim(&buf->buf);
-		}
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (size_t cpu = 0; cpu < ARRAY_SIZE(cpu_msg_ptr); cpu++) {
+		msg_oldest_check(&cpu_msg_ptr[cpu], &cpu_log_buffer[cpu], &t_min, &chosen);
+	}
 #endif
 
-		if (msg_ptr->msg) {
-			log_timestamp_t t = log_msg_get_timestamp(&msg_ptr->msg->log);
-
-			if (t < t_min) {
-				t_min = t;
-				msg = msg_ptr->msg;
-				chosen = msg_ptr;
-				curr_log_buffer = &buf->buf;
-			}
-		}
-		i++;
+	if (chosen) {
+		msg = chosen->msg;
 	}
 
 	if (msg) {
@@ -772,13 +850,13 @@ union log_msg_generic *z_log_msg_claim_oldest(k_timeout_t *backoff)
 		}
 
 		(*chosen).msg = NULL;
-	}
 
-	if (t_min < prev_timestamp) {
-		atomic_inc(&unordered_cnt);
-	}
+		if (t_min < prev_timestamp) {
+			atomic_inc(&unordered_cnt);
+		}
 
-	prev_timestamp = t_min;
+		prev_timestamp = t_min;
+	}
 
 	return msg;
 }
@@ -790,7 +868,8 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if ((IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) ||
+	    IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS)) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -825,10 +904,19 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
-	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
+	if ((!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) &&
+	    !IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS)) {
 		return msg_pending(&log_buffer);
 	}
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (size_t cpu = 0; cpu < ARRAY_SIZE(cpu_msg_ptr); cpu++) {
+		if (cpu_msg_ptr[cpu].msg || msg_pending(&cpu_log_buffer[cpu])) {
+			return true;
+		}
+	}
+#endif
+
 	STRUCT_SECTION_FOREACH(log_msg_ptr, msg_ptr) {
 		struct log_mpsc_pbuf *buf;
 
@@ -905,7 +993,17 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 		return -EINVAL;
 	}
 
-	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
+	*buf_size = 0;
+	*usage = 0;
+
+	for (unsigned int i = 0; i < LOG_CPU_BUFFERS; i++) {
+		uint32_t size;
+		uint32_t now;
+
+		mpsc_pbuf_get_utilization(cpu_buffer(i), &size, &now);
+		*buf_size += size;
+		*usage += now;
+	}
 
 	return 0;
 }
@@ -918,7 +1016,21 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
-	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+	*max = 0;
+
+	for (unsigned int i = 0; i < LOG_CPU_BUFFERS; i++) {
+		uint32_t cpu_max;
+		int err;
+
+		err = mpsc_pbuf_get_max_utilization(cpu_buffer(i), &cpu_max);
+		if (err < 0) {
+			return err;
+		}
+
+		*max += cpu_max;
+	}
+
+	return 0;
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
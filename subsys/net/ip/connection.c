@@ -113,6 +113,210 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* Handlers that can match IP packets are also kept in a hash table, so
+ * that input only needs to look at a few of them. A handler with a
+ * specific remote address and port is hashed on the protocol, local port
+ * and remote address and port, one with only a local port on the protocol
+ * and local port, and one without a local port is kept in the wildcard
+ * list that is checked for every packet. All keys are taken from the raw
+ * sockaddr fields that conn_find_handler() and net_conn_input() compare.
+ */
+#define CONN_LIST_NODE hash_node
+
+static sys_slist_t conn_hash[CONFIG_NET_CONN_HASH_SIZE];
+static sys_slist_t conn_wildcard;
+static uint32_t conn_seq;
+
+static inline uint32_t conn_hash_mix(uint32_t hash, uint32_t val)
+{
+	hash ^= val;
+	hash *= 0x9e3779b1U;
+
+	return hash ^ (hash >> 16);
+}
+
+/* Specific address stored in addr, or NULL if it matches any address */
+static const uint8_t *conn_addr_spec(const struct sockaddr *addr, size_t *len)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
+		if (net_ipv6_is_addr_unspecified(&net_sin6(addr)->sin6_addr)) {
+			return NULL;
+		}
+
+		*len = sizeof(struct in6_addr);
+		return (const uint8_t *)&net_sin6(addr)->sin6_addr;
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && addr->sa_family == AF_INET) {
+		if (net_sin(addr)->sin_addr.s_addr == 0U) {
+			return NULL;
+		}
+
+		*len = sizeof(struct in_addr);
+		return (const uint8_t *)&net_sin(addr)->sin_addr;
+	}
+
+	return NULL;
+}
+
+/* Ports are in network byte order */
+static sys_slist_t *conn_hash_list(uint16_t proto, uint16_t local_port,
+				   const uint8_t *remote_addr, size_t addr_len,
+				   uint16_t remote_port)
+{
+	uint32_t hash;
+
+	if (local_port == 0U) {
+		return &conn_wildcard;
+	}
+
+	hash = conn_hash_mix(proto, local_port);
+
+	if (remote_addr != NULL && remote_port != 0U) {
+		hash = conn_hash_mix(hash, remote_port);
+
+		for (size_t i = 0; i < addr_len; i += sizeof(uint32_t)) {
+			hash = conn_hash_mix(hash,
+					     UNALIGNED_GET((const uint32_t *)&remote_addr[i]));
+		}
+	}
+
+	return &conn_hash[hash % CONFIG_NET_CONN_HASH_SIZE];
+}
+
+static sys_slist_t *conn_hash_list_of(struct net_conn *conn)
+{
+	const uint8_t *remote_addr = NULL;
+	size_t addr_len = 0;
+
+	if (conn->flags & NET_CONN_REMOTE_ADDR_SET) {
+		remote_addr = conn_addr_spec(&conn->remote_addr, &addr_len);
+	}
+
+	return conn_hash_list(conn->proto, net_sin(&conn->local_addr)->sin_port,
+			      remote_addr, addr_len,
+			      net_sin(&conn->remote_addr)->sin_port);
+}
+
+/* Must be called with conn_lock held */
+static void conn_hash_add(struct net_conn *conn)
+{
+	sys_slist_prepend(conn_hash_list_of(conn), &conn->hash_node);
+}
+
+/* Must be called with conn_lock held, before the addresses change */
+static void conn_hash_remove(struct net_conn *conn)
+{
+	sys_slist_find_and_remove(conn_hash_list_of(conn), &conn->hash_node);
+}
+
+/* The only list that can hold a handler identical to the given one */
+static sys_slist_t *conn_find_list(uint16_t proto,
+				   const struct sockaddr *remote_addr,
+				   uint16_t remote_port,
+				   uint16_t local_port)
+{
+	const uint8_t *addr = NULL;
+	size_t addr_len = 0;
+
+	if (remote_addr != NULL) {
+		addr = conn_addr_spec(remote_addr, &addr_len);
+	}
+
+	return conn_hash_list(proto, htons(local_port), addr, addr_len,
+			      htons(remote_port));
+}
+
+/* Lists that can hold handlers matching the packet, without duplicates */
+static size_t conn_input_lists(union net_ip_header *ip_hdr, uint8_t family,
+			       uint8_t proto, uint16_t src_port,
+			       uint16_t dst_port, sys_slist_t *lists[3])
+{
+	const uint8_t *src_addr = NULL;
+	size_t addr_len = 0;
+	size_t count = 0;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+		src_addr = ip_hdr->ipv6->src;
+		addr_len = sizeof(struct in6_addr);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
+		src_addr = ip_hdr->ipv4->src;
+		addr_len = sizeof(struct in_addr);
+	}
+
+	if (dst_port != 0U) {
+		if (src_addr != NULL && src_port != 0U) {
+			lists[count++] = conn_hash_list(proto, dst_port, src_addr,
+							addr_len, src_port);
+		}
+
+		lists[count] = conn_hash_list(proto, dst_port, NULL, 0, 0);
+		if (count == 0 || lists[count] != lists[0]) {
+			count++;
+		}
+	}
+
+	lists[count++] = &conn_wildcard;
+
+	return count;
+}
+
+/* Among equally ranked matches the most recently registered one wins, as
+ * it does when walking conn_used.
+ */
+static inline bool conn_is_newer(struct net_conn *conn, struct net_conn *other)
+{
+	return other != NULL && (int32_t)(conn->seq - other->seq) > 0;
+}
+#else
+#define CONN_LIST_NODE node
+
+static inline void conn_hash_add(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline void conn_hash_remove(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline sys_slist_t *conn_find_list(uint16_t proto,
+					  const struct sockaddr *remote_addr,
+					  uint16_t remote_port,
+					  uint16_t local_port)
+{
+	ARG_UNUSED(proto);
+	ARG_UNUSED(remote_addr);
+	ARG_UNUSED(remote_port);
+	ARG_UNUSED(local_port);
+
+	return &conn_used;
+}
+
+static inline size_t conn_input_lists(union net_ip_header *ip_hdr, uint8_t family,
+				      uint8_t proto, uint16_t src_port,
+				      uint16_t dst_port, sys_slist_t *lists[3])
+{
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(family);
+	ARG_UNUSED(proto);
+	ARG_UNUSED(src_port);
+	ARG_UNUSED(dst_port);
+
+	lists[0] = &conn_used;
+
+	return 1;
+}
+
+static inline bool conn_is_newer(struct net_conn *conn, struct net_conn *other)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(other);
+
+	return false;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -138,6 +342,10 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+#if defined(CONFIG_NET_CONN_HASH)
+	conn->seq = conn_seq++;
+#endif
+	conn_hash_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -159,12 +367,14 @@ static struct net_conn *conn_find_handler(struct net_if *iface,
 					  uint16_t local_port,
 					  bool reuseport_set)
 {
+	sys_slist_t *list = conn_find_list(proto, remote_addr, remote_port,
+					   local_port);
 	struct net_conn *conn;
 	struct net_conn *tmp;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&conn_used, conn, tmp, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(list, conn, tmp, CONN_LIST_NODE) {
 		if (conn->proto != proto) {
 			continue;
 		}
@@ -463,6 +673,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_hash_remove(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -489,14 +700,21 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
+	/* The hash key depends on the addresses, so rehash the handler */
+	conn_hash_remove(conn);
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_local(conn, local_addr, local_port);
-	if (ret < 0) {
-		return ret;
+	if (ret == 0) {
+		ret = net_conn_change_remote(conn, remote_addr, remote_port);
 	}
 
-	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	conn_hash_add(conn);
+
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -610,6 +828,89 @@ static bool is_iface_matching(struct net_conn *conn, struct net_pkt *pkt)
 	return (net_pkt_iface(pkt) == net_context_get_iface(conn->context));
 }
 
+/* Is the candidate connection matching the TCP/UDP packet? */
+static bool conn_input_match(struct net_conn *conn, struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr, uint8_t proto,
+			     uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	/* Is the candidate connection matching the packet's interface? */
+	if (!is_iface_matching(conn, pkt)) {
+		return false; /* wrong interface */
+	}
+
+	/* Is the candidate connection matching the packet's protocol family? */
+	if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only && conn->type != SOCK_RAW)) {
+				return false;
+			}
+		} else {
+			return false; /* wrong protocol family */
+		}
+
+		/* We might have a match for v4-to-v6 mapping, check more */
+	}
+
+	/* Is the candidate connection matching the packet's protocol within the family? */
+	if (conn->proto != proto) {
+		return false; /* wrong protocol */
+	}
+
+	/* Apply protocol-specific matching criteria... */
+	if (!(IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) ||
+	    !(conn->family == AF_INET || conn->family == AF_INET6 ||
+	      conn->family == AF_UNSPEC)) {
+		return false;
+	}
+
+	/* Is the candidate connection matching the packet's TCP/UDP
+	 * address and port?
+	 */
+	if (net_sin(&conn->remote_addr)->sin_port &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if (net_sin(&conn->local_addr)->sin_port &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+		/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+		 * has no IPV6_V6ONLY option set and if the local IPV6 address
+		 * is unspecified, then we could accept a connection from IPv4
+		 * address by mapping it to IPv6 address.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only &&
+			      net_ipv6_is_addr_unspecified(
+				      &net_sin6(&conn->local_addr)->sin6_addr))) {
+				return false; /* wrong local address */
+			}
+		} else {
+			return false; /* wrong local address */
+		}
+
+		/* We might have a match for v4-to-v6 mapping,
+		 * continue with rank checking.
+		 */
+	}
+
+	return true;
+}
+
 #if defined(CONFIG_NET_SOCKETS_PACKET) || defined(CONFIG_NET_SOCKETS_INET_RAW)
 static void conn_raw_socket_deliver(struct net_pkt *pkt, struct net_conn *conn,
 				    bool is_ip)
@@ -808,6 +1109,8 @@ enum net_verdict net_conn_can_input(struct net_pkt *pkt, uint8_t proto)
 	struct net_conn *conn;
 	net_conn_cb_t cb = NULL;
 	void *user_data = NULL;
+	sys_slist_t *lists[3];
+	size_t num_lists;
 
 	/* Only accept input with AF_CAN family and CAN_RAW protocol. */
 	if (net_pkt_family(pkt) != AF_CAN || proto != CAN_RAW) {
@@ -936,118 +1239,59 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		is_mcast_pkt = net_ipv6_is_addr_mcast((struct in6_addr *)ip_hdr->ipv6->dst);
 	}
 
+	num_lists = conn_input_lists(ip_hdr, pkt_family, proto, src_port,
+				     dst_port, lists);
+
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (!is_iface_matching(conn, pkt)) {
-			continue; /* wrong interface */
-		}
+	for (size_t i = 0; i < num_lists; i++) {
+		SYS_SLIST_FOR_EACH_CONTAINER(lists[i], conn, CONN_LIST_NODE) {
+			struct net_pkt *mcast_pkt;
 
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-				      !conn->v6only && conn->type != SOCK_RAW)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
+			if (!conn_input_match(conn, pkt, ip_hdr, proto,
+					      src_port, dst_port)) {
+				continue;
 			}
 
-			/* We might have a match for v4-to-v6 mapping, check more */
-		}
+			if (best_rank > NET_CONN_RANK(conn->flags) ||
+			    (best_rank == NET_CONN_RANK(conn->flags) &&
+			     !conn_is_newer(conn, best_match))) {
+				continue; /* not better than the match we have */
+			}
 
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			continue; /* wrong protocol */
-		}
+			if (!is_mcast_pkt) {
+				best_rank = NET_CONN_RANK(conn->flags);
+				best_match = conn;
 
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
+				continue; /* found a match - but maybe not yet the best */
+			}
 
-		if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-		    (conn_family == AF_INET || conn_family == AF_INET6 ||
-		     conn_family == AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
+			/* If we have a multicast packet, and we found
+			 * a match, then deliver the packet immediately
+			 * to the handler. As there might be several
+			 * sockets interested about these, we need to
+			 * clone the received pkt.
 			 */
-			if (net_sin(&conn->remote_addr)->sin_port &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
 
-			if (net_sin(&conn->local_addr)->sin_port &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
+			NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
+				conn->user_data);
 
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
+			mcast_pkt = net_pkt_clone(
+				pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
+			if (!mcast_pkt) {
+				k_mutex_unlock(&conn_lock);
+				goto drop;
 			}
 
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+			if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
+			    NET_DROP) {
+				net_stats_update_per_proto_drop(pkt_iface, proto);
+				net_pkt_unref(mcast_pkt);
+			} else {
+				net_stats_update_per_proto_recv(pkt_iface, proto);
 			}
 
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
-				struct net_pkt *mcast_pkt;
-
-				if (!is_mcast_pkt) {
-					best_rank = NET_CONN_RANK(conn->flags);
-					best_match = conn;
-
-					continue; /* found a match - but maybe not yet the best */
-				}
-
-				/* If we have a multicast packet, and we found
-				 * a match, then deliver the packet immediately
-				 * to the handler. As there might be several
-				 * sockets interested about these, we need to
-				 * clone the received pkt.
-				 */
-
-				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
-					conn->user_data);
-
-				mcast_pkt = net_pkt_clone(
-					pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
-				if (!mcast_pkt) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				}
-
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
-					net_stats_update_per_proto_drop(pkt_iface, proto);
-					net_pkt_unref(mcast_pkt);
-				} else {
-					net_stats_update_per_proto_recv(pkt_iface, proto);
-				}
-
-				mcast_pkt_delivered = true;
-			}
+			mcast_pkt_delivered = true;
 		}
 	} /* loop end */
 
@@ -1120,6 +1364,14 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	sys_slist_init(&conn_wildcard);
+
+	for (i = 0; i < CONFIG_NET_CONN_HASH_SIZE; i++) {
+		sys_slist_init(&conn_hash[i]);
+	}
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
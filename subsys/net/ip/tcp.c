@@ -59,7 +59,7 @@ static int tcp_tx_window =
 	CONFIG_NET_PKT_BUF_TX_DATA_POOL_SIZE / 3;
 #endif /* CONFIG_NET_BUF_FIXED_DATA_SIZE */
 #endif
-#ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
+#if defined(CONFIG_NET_TCP_RANDOMIZED_RTO) || defined(CONFIG_NET_TCP_TIMESTAMPS)
 #define TCP_RTO_MS (conn->rto)
 #else
 #define TCP_RTO_MS (tcp_rto)
@@ -421,11 +421,23 @@ out:
 
 static void tcp_derive_rto(struct tcp *conn)
 {
+#if defined(CONFIG_NET_TCP_RANDOMIZED_RTO) || defined(CONFIG_NET_TCP_TIMESTAMPS)
+	uint32_t rto = (uint32_t)tcp_rto;
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	/* Once the round-trip time has been measured, use SRTT + 4 * RTTVAR
+	 * as described in RFC 6298, but never go below the configured
+	 * initial timeout.
+	 */
+	if (conn->srtt != 0U) {
+		rto = MAX(rto, (conn->srtt >> 3) + MAX(conn->rttvar, 1U));
+	}
+#endif
+
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
-	/* Compute a randomized rto 1 and 1.5 times tcp_rto */
+	/* Compute a randomized rto 1 and 1.5 times the base rto */
 	uint32_t gain;
 	uint8_t gain8;
-	uint32_t rto;
 
 	/* Getting random is computational expensive, so only use 8 bits */
 	sys_rand_get(&gain8, sizeof(uint8_t));
@@ -433,14 +445,82 @@ static void tcp_derive_rto(struct tcp *conn)
 	gain = (uint32_t)gain8;
 	gain += 1 << 9;
 
-	rto = (uint32_t)tcp_rto;
 	rto = (gain * rto) >> 9;
-	conn->rto = (uint16_t)rto;
+#endif
+	conn->rto = (uint16_t)MIN(rto, UINT16_MAX);
 #else
 	ARG_UNUSED(conn);
 #endif
 }
 
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+/* Feed the round-trip time measured from an echoed timestamp into the
+ * RFC 6298 estimator.
+ */
+static void tcp_rtt_sample(struct tcp *conn)
+{
+	uint32_t rtt;
+	int32_t delta;
+
+	if (!conn->ts_ok || !conn->recv_options.ts_found ||
+	    conn->recv_options.tsecr == 0U) {
+		return;
+	}
+
+	rtt = k_uptime_get_32() - conn->recv_options.tsecr;
+	if ((int32_t)rtt < 0) {
+		return;
+	}
+
+	if (conn->srtt == 0U) {
+		conn->srtt = rtt << 3;
+		conn->rttvar = rtt << 1;
+	} else {
+		delta = (int32_t)rtt - (int32_t)(conn->srtt >> 3);
+		conn->srtt += delta;
+
+		if (delta < 0) {
+			delta = -delta;
+		}
+
+		delta -= (int32_t)(conn->rttvar >> 2);
+		conn->rttvar += delta;
+	}
+
+	NET_DBG("conn: %p rtt=%u srtt=%u rttvar=%u", conn, rtt,
+		conn->srtt >> 3, conn->rttvar >> 2);
+
+	tcp_derive_rto(conn);
+}
+
+/* Protection against wrapped sequence numbers (RFC 7323, chapter 5),
+ * which does not apply to RST segments.
+ */
+static bool tcp_paws_reject(struct tcp *conn, struct tcphdr *th)
+{
+	return conn->ts_ok && conn->recv_options.ts_found && !(th_flags(th) & RST) &&
+	       (int32_t)(conn->recv_options.tsval - conn->ts_recent) < 0;
+}
+
+static void tcp_ts_recent_update(struct tcp *conn, struct tcphdr *th)
+{
+	if (conn->ts_ok && conn->recv_options.ts_found &&
+	    net_tcp_seq_cmp(th_seq(th), conn->ack) <= 0 &&
+	    (int32_t)(conn->recv_options.tsval - conn->ts_recent) >= 0) {
+		conn->ts_recent = conn->recv_options.tsval;
+	}
+}
+#else
+static inline void tcp_rtt_sample(struct tcp *conn) { }
+
+static inline bool tcp_paws_reject(struct tcp *conn, struct tcphdr *th)
+{
+	return false;
+}
+
+static inline void tcp_ts_recent_update(struct tcp *conn, struct tcphdr *th) { }
+#endif /* CONFIG_NET_TCP_TIMESTAMPS */
+
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
 /* Implementation according to RFC6582 */
@@ -999,7 +1079,7 @@ static uint8_t *tcp_options_get(struct net_pkt *pkt, int tcp_options_len,
 }
 
 static bool tcp_options_check(struct tcp_options *recv_options,
-			      struct net_pkt *pkt, ssize_t len)
+			      struct net_pkt *pkt, ssize_t len, bool syn)
 {
 	uint8_t options_buf[40]; /* TCP header max options size is 40 */
 	bool result = len > 0 && ((len % 4) == 0) ? true : false;
@@ -1009,8 +1089,13 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	/* The MSS and window scale are only announced in the handshake and
+	 * last for the whole connection.
+	 */
+	if (syn) {
+		recv_options->mss_found = false;
+		recv_options->wnd_found = false;
+	}
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1045,6 +1130,10 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
+			if (!syn) {
+				break;
+			}
+
 			recv_options->mss =
 				ntohs(UNALIGNED_GET((uint16_t *)(options + 2)));
 			recv_options->mss_found = true;
@@ -1056,9 +1145,52 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
+			if (!syn) {
+				break;
+			}
+
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_OPT:
+			if (opt_len < 2 + NET_TCP_SACK_BLOCK_SIZE ||
+			    (opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE != 0) {
+				result = false;
+				goto end;
+			}
+
+			for (int i = 2; i < opt_len &&
+			     recv_options->sack_count < NET_TCP_SACK_MAX_BLOCKS;
+			     i += NET_TCP_SACK_BLOCK_SIZE) {
+				struct tcp_sack_block *blk =
+					&recv_options->sack[recv_options->sack_count++];
+
+				blk->start = ntohl(UNALIGNED_GET((uint32_t *)(options + i)));
+				blk->end = ntohl(UNALIGNED_GET((uint32_t *)(options + i + 4)));
+			}
+			break;
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+		case NET_TCP_TIMESTAMP_OPT:
+			if (opt_len != NET_TCP_TIMESTAMP_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->tsval = ntohl(UNALIGNED_GET((uint32_t *)(options + 2)));
+			recv_options->tsecr = ntohl(UNALIGNED_GET((uint32_t *)(options + 6)));
+			recv_options->ts_found = true;
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1250,7 +1382,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1264,11 +1396,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / sizeof(uint32_t);
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
@@ -1453,17 +1581,115 @@ err:
 	tcp_pkt_unref(rst);
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* The receive queue holds a single run of out-of-order data, which is
+ * reported to the peer as one SACK block.
+ */
+static bool tcp_sack_block_get(struct tcp *conn, uint32_t *start, uint32_t *end)
+{
+	if (!conn->sack_ok || !CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT ||
+	    net_pkt_is_empty(conn->queue_recv_data)) {
+		return false;
+	}
+
+	*start = tcp_get_seq(conn->queue_recv_data->buffer);
+	*end = *start + net_pkt_get_len(conn->queue_recv_data);
+
+	return net_tcp_seq_cmp(*start, conn->ack) > 0;
+}
+#endif
+
+/* Payload that fits in a segment next to the options we add to it */
+static int tcp_send_mss(struct tcp *conn)
+{
+	int mss = conn_mss(conn);
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	if (conn->ts_ok) {
+		mss -= 2 * NET_TCP_NOP_SIZE + NET_TCP_TIMESTAMP_SIZE;
+	}
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	uint32_t start, end;
+
+	if (tcp_sack_block_get(conn, &start, &end)) {
+		mss -= 2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_BLOCK_SIZE;
+	}
+#endif
+
+	return mss;
+}
+
+/* Build the SACK permitted, timestamp and SACK options of an outgoing
+ * segment, each padded with NOPs to a multiple of four bytes. The MSS
+ * option is written separately by net_tcp_set_mss_opt().
+ */
+static size_t tcp_options_build(struct tcp *conn, uint8_t flags, uint8_t *buf)
+{
+	size_t len = 0;
+
+#ifdef CONFIG_NET_TCP_SACK
+	if ((flags & SYN) && conn->sack_ok) {
+		buf[len++] = NET_TCP_NOP_OPT;
+		buf[len++] = NET_TCP_NOP_OPT;
+		buf[len++] = NET_TCP_SACK_PERM_OPT;
+		buf[len++] = NET_TCP_SACK_PERM_SIZE;
+	}
+#endif
+
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	if (conn->ts_ok) {
+		buf[len++] = NET_TCP_NOP_OPT;
+		buf[len++] = NET_TCP_NOP_OPT;
+		buf[len++] = NET_TCP_TIMESTAMP_OPT;
+		buf[len++] = NET_TCP_TIMESTAMP_SIZE;
+		sys_put_be32(k_uptime_get_32(), &buf[len]);
+		len += sizeof(uint32_t);
+		sys_put_be32((flags & ACK) ? conn->ts_recent : 0U, &buf[len]);
+		len += sizeof(uint32_t);
+	}
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+	uint32_t start, end;
+
+	if (!(flags & SYN) && (flags & ACK) &&
+	    tcp_sack_block_get(conn, &start, &end)) {
+		buf[len++] = NET_TCP_NOP_OPT;
+		buf[len++] = NET_TCP_NOP_OPT;
+		buf[len++] = NET_TCP_SACK_OPT;
+		buf[len++] = 2 + NET_TCP_SACK_BLOCK_SIZE;
+		sys_put_be32(start, &buf[len]);
+		len += sizeof(uint32_t);
+		sys_put_be32(end, &buf[len]);
+		len += sizeof(uint32_t);
+	}
+#endif
+
+	ARG_UNUSED(conn);
+	ARG_UNUSED(flags);
+	ARG_UNUSED(buf);
+
+	return len;
+}
+
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
 	size_t alloc_len = sizeof(struct tcphdr);
+	uint8_t opts[40]; /* TCP header max options size is 40 */
+	size_t opts_len;
 	struct net_pkt *pkt;
 	int ret = 0;
 
+	opts_len = tcp_options_build(conn, flags, opts);
+
 	if (conn->send_options.mss_found) {
 		alloc_len += sizeof(uint32_t);
 	}
 
+	alloc_len += opts_len;
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1482,7 +1708,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, alloc_len - sizeof(struct tcphdr));
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1496,6 +1722,14 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	if (opts_len > 0) {
+		ret = net_pkt_write(pkt, opts, opts_len);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1665,7 +1899,7 @@ static int tcp_send_data(struct tcp *conn)
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(tcp_unsent_len(conn), tcp_send_mss(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1715,6 +1949,218 @@ static int tcp_send_data(struct tcp *conn)
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* Resend len bytes of already sent data starting offset bytes after
+ * snd.una, without touching the send state.
+ */
+static int tcp_resend_range(struct tcp *conn, uint32_t offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = tcp_pkt_alloc(conn, len);
+	if (!pkt) {
+		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_pkt_peek(pkt, conn->send_data, offset, len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
+	if (ret == 0) {
+		net_stats_update_tcp_resent(conn->iface, len);
+		net_stats_update_tcp_seg_rexmit(conn->iface);
+	}
+
+	tcp_pkt_unref(pkt);
+
+	return ret;
+}
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sacked_count = 0;
+	conn->sack_recovery = false;
+}
+
+/* Merge a SACK block received from the peer into the scoreboard */
+static void tcp_sack_add(struct tcp *conn, uint32_t start, uint32_t end)
+{
+	uint32_t snd_nxt = conn->seq + conn->unacked_len;
+	struct tcp_sack_block *sb = conn->sacked;
+	int count = conn->sacked_count;
+	int i, j;
+
+	/* Clip the block to the unacknowledged data, which leaves nothing
+	 * of a D-SACK block.
+	 */
+	if (net_tcp_seq_cmp(start, conn->seq) < 0) {
+		start = conn->seq;
+	}
+
+	if (net_tcp_seq_cmp(end, snd_nxt) > 0) {
+		end = snd_nxt;
+	}
+
+	if (net_tcp_seq_cmp(start, end) >= 0) {
+		return;
+	}
+
+	/* Skip the ranges ending before the block, then absorb the ones it
+	 * overlaps or touches.
+	 */
+	for (i = 0; i < count && net_tcp_seq_cmp(sb[i].end, start) < 0; i++) {
+	}
+
+	for (j = i; j < count && net_tcp_seq_cmp(sb[j].start, end) <= 0; j++) {
+		if (net_tcp_seq_cmp(sb[j].start, start) < 0) {
+			start = sb[j].start;
+		}
+
+		if (net_tcp_seq_cmp(sb[j].end, end) > 0) {
+			end = sb[j].end;
+		}
+	}
+
+	if (j == i) {
+		if (count == TCP_SACK_SCOREBOARD_SIZE) {
+			/* Forget the highest range to make room */
+			if (i == count) {
+				return;
+			}
+
+			count--;
+		}
+
+		memmove(&sb[i + 1], &sb[i], (count - i) * sizeof(sb[0]));
+		count++;
+	} else {
+		memmove(&sb[i + 1], &sb[j], (count - j) * sizeof(sb[0]));
+		count -= j - i - 1;
+	}
+
+	sb[i].start = start;
+	sb[i].end = end;
+	conn->sacked_count = count;
+}
+
+static void tcp_sack_update(struct tcp *conn)
+{
+	if (!conn->sack_ok) {
+		return;
+	}
+
+	for (int i = 0; i < conn->recv_options.sack_count; i++) {
+		tcp_sack_add(conn, conn->recv_options.sack[i].start,
+			     conn->recv_options.sack[i].end);
+	}
+}
+
+/* Drop the ranges that have been cumulatively acknowledged */
+static void tcp_sack_prune(struct tcp *conn)
+{
+	int i;
+
+	for (i = 0; i < conn->sacked_count &&
+	     net_tcp_seq_cmp(conn->sacked[i].end, conn->seq) <= 0; i++) {
+	}
+
+	conn->sacked_count -= i;
+	memmove(&conn->sacked[0], &conn->sacked[i],
+		conn->sacked_count * sizeof(conn->sacked[0]));
+
+	if (conn->sacked_count > 0 &&
+	    net_tcp_seq_cmp(conn->sacked[0].start, conn->seq) < 0) {
+		conn->sacked[0].start = conn->seq;
+	}
+}
+
+/* Resend up to budget bytes of the holes below the highest SACKed byte
+ * that have not been resent yet in this recovery (RFC 6675, simplified).
+ */
+static void tcp_sack_retransmit(struct tcp *conn, int budget)
+{
+	uint32_t next = conn->sack_high_rxt;
+	int mss = tcp_send_mss(conn);
+
+	if (net_tcp_seq_cmp(next, conn->seq) < 0) {
+		next = conn->seq;
+	}
+
+	for (int i = 0; i < conn->sacked_count && budget > 0; i++) {
+		while (budget > 0 &&
+		       net_tcp_seq_cmp(next, conn->sacked[i].start) < 0) {
+			int len = MIN((int)(conn->sacked[i].start - next), mss);
+
+			if (tcp_resend_range(conn, next - conn->seq, len) < 0) {
+				goto out;
+			}
+
+			next += len;
+			budget -= len;
+		}
+
+		if (net_tcp_seq_cmp(next, conn->sacked[i].end) < 0) {
+			next = conn->sacked[i].end;
+		}
+	}
+
+out:
+	conn->sack_high_rxt = next;
+}
+
+/* On the third duplicate ACK, start resending the SACK holes. Returns
+ * false if the peer has not SACKed anything, so that the caller falls
+ * back to resending the first unacknowledged segment.
+ */
+static bool tcp_sack_fast_retransmit(struct tcp *conn)
+{
+	if (!conn->sack_ok || conn->sacked_count == 0) {
+		return false;
+	}
+
+	conn->sack_recovery = true;
+	conn->sack_recovery_point = conn->seq + conn->unacked_len;
+	conn->sack_high_rxt = conn->seq;
+
+	tcp_sack_retransmit(conn, MAX(conn_mss(conn), conn->unacked_len / 2));
+
+	return true;
+}
+
+/* Every further ACK during recovery releases one more segment */
+static void tcp_sack_recovery_ack(struct tcp *conn)
+{
+	if (!conn->sack_recovery) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(conn->seq, conn->sack_recovery_point) >= 0) {
+		conn->sack_recovery = false;
+		return;
+	}
+
+	tcp_sack_retransmit(conn, conn_mss(conn));
+}
+#else
+static inline void tcp_sack_reset(struct tcp *conn) { }
+
+static inline void tcp_sack_update(struct tcp *conn) { }
+
+static inline void tcp_sack_prune(struct tcp *conn) { }
+
+static inline bool tcp_sack_fast_retransmit(struct tcp *conn)
+{
+	return false;
+}
+
+static inline void tcp_sack_recovery_ack(struct tcp *conn) { }
+#endif /* CONFIG_NET_TCP_SACK */
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1815,6 +2261,7 @@ static void tcp_resend_data(struct k_work *work)
 
 		conn->data_mode = TCP_DATA_MODE_RESEND;
 		conn->unacked_len = 0;
+		tcp_sack_reset(conn);
 
 		ret = tcp_send_data(conn);
 		if (ret == -ENODATA) {
@@ -2840,8 +3287,15 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+	/* Only the MSS and window scale options are kept between segments */
+	conn->recv_options.sack_perm_found = false;
+	conn->recv_options.ts_found = false;
+#ifdef CONFIG_NET_TCP_SACK
+	conn->recv_options.sack_count = 0;
+#endif
+
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
-						  tcp_options_len)) {
+						  tcp_options_len, th_flags(th) & SYN)) {
 		NET_DBG("DROP: Invalid TCP option list");
 		net_tcp_reply_rst(pkt);
 		do_close = true;
@@ -2849,6 +3303,18 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+	if ((conn->state != TCP_LISTEN) && (conn->state != TCP_SYN_SENT)) {
+		if (tcp_paws_reject(conn, th)) {
+			NET_DBG("conn: %p, DROP: PAWS check failed", conn);
+			net_stats_update_tcp_seg_drop(conn->iface);
+			tcp_out(conn, ACK);
+			k_mutex_unlock(&conn->lock);
+			return NET_DROP;
+		}
+
+		tcp_ts_recent_update(conn, th);
+	}
+
 	if ((conn->state != TCP_LISTEN) && (conn->state != TCP_SYN_SENT) && FL(&fl, &, SYN)) {
 		/* According to RFC 793, ch 3.9 Event Processing, receiving SYN
 		 * once the connection has been established is an error
@@ -2888,6 +3354,15 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	switch (conn->state) {
 	case TCP_LISTEN:
 		if (FL(&fl, ==, SYN)) {
+#ifdef CONFIG_NET_TCP_SACK
+			conn->sack_ok = conn->recv_options.sack_perm_found;
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+			conn->ts_ok = conn->recv_options.ts_found;
+			if (conn->ts_ok) {
+				conn->ts_recent = conn->recv_options.tsval;
+			}
+#endif
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
@@ -2923,6 +3398,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 			k_work_cancel_delayable(&conn->establish_timer);
 			k_work_cancel_delayable(&conn->send_data_timer);
+			tcp_rtt_sample(conn);
 			tcp_conn_ref(conn);
 			net_context_set_state(conn->context,
 					      NET_CONTEXT_CONNECTED);
@@ -3006,6 +3482,16 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			k_work_cancel_delayable(&conn->send_data_timer);
+#ifdef CONFIG_NET_TCP_SACK
+			conn->sack_ok = conn->recv_options.sack_perm_found;
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+			conn->ts_ok = conn->recv_options.ts_found;
+			if (conn->ts_ok) {
+				conn->ts_recent = conn->recv_options.tsval;
+			}
+#endif
+			tcp_rtt_sample(conn);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -3080,6 +3566,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		keep_alive_timer_restart(conn);
 
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
+		tcp_sack_update(conn);
+
 		if (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
 			/* Only if there is pending data, increment the duplicate ack count */
 			if (conn->send_data_total > 0) {
@@ -3099,20 +3587,26 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			/* Only do fast retransmit when not already in a resend state */
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
 			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
-				/* Apply a fast retransmit */
-				int temp_unacked_len = conn->unacked_len;
+				/* Apply a fast retransmit, of all the SACK holes
+				 * if the peer told us about them.
+				 */
+				if (!tcp_sack_fast_retransmit(conn)) {
+					int temp_unacked_len = conn->unacked_len;
 
-				conn->unacked_len = 0;
+					conn->unacked_len = 0;
 
-				(void)tcp_send_data(conn);
+					(void)tcp_send_data(conn);
 
-				/* Restore the current transmission */
-				conn->unacked_len = temp_unacked_len;
+					/* Restore the current transmission */
+					conn->unacked_len = temp_unacked_len;
+				}
 
 				tcp_ca_fast_retransmit(conn);
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 				}
+			} else if (conn->dup_ack_cnt > DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) {
+				tcp_sack_recovery_ack(conn);
 			}
 		}
 #endif
@@ -3159,6 +3653,10 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
+			tcp_rtt_sample(conn);
+			tcp_sack_prune(conn);
+			tcp_sack_recovery_ack(conn);
+
 			/* Receipt of an acknowledgment that covers a sequence number
 			 * not previously acknowledged indicates that the connection
 			 * makes a "forward progress".
@@ -3685,6 +4183,12 @@ static int tcp_start_handshake(struct tcp *conn)
 	k_mutex_lock(&conn->lock, K_FOREVER);
 	tcp_check_sock_options(conn);
 	conn->send_options.mss_found = true;
+#ifdef CONFIG_NET_TCP_SACK
+	conn->sack_ok = true;
+#endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	conn->ts_ok = true;
+#endif
 	ret = tcp_out_ext(conn, SYN, NULL /* no data */, conn->seq);
 	if (ret < 0) {
 		k_mutex_unlock(&conn->lock);
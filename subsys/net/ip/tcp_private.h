@@ -227,18 +227,45 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
+#define NET_TCP_TIMESTAMP_OPT    8
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+#define NET_TCP_TIMESTAMP_SIZE    10
+
+/* Most SACK blocks that fit in the TCP option space */
+#define NET_TCP_SACK_MAX_BLOCKS   4
+
+/* Number of SACKed ranges of the send queue remembered by the sender */
+#define TCP_SACK_SCOREBOARD_SIZE  8
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	uint32_t tsval;
+	uint32_t tsecr;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_count;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_perm_found : 1;
+	bool ts_found : 1;
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
@@ -318,9 +345,21 @@ struct tcp { /* TCP connection */
 	uint16_t recv_win;
 	uint16_t send_win_max;
 	uint16_t send_win;
-#ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
+#if defined(CONFIG_NET_TCP_RANDOMIZED_RTO) || defined(CONFIG_NET_TCP_TIMESTAMPS)
 	uint16_t rto;
 #endif
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	uint32_t ts_recent; /* Last TSval to echo back to the peer */
+	uint32_t srtt;      /* Smoothed round-trip time in ms, scaled by 8 */
+	uint32_t rttvar;    /* Round-trip time variation in ms, scaled by 4 */
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	/* Sorted, disjoint ranges of the send queue the peer has SACKed */
+	struct tcp_sack_block sacked[TCP_SACK_SCOREBOARD_SIZE];
+	uint32_t sack_recovery_point;
+	uint32_t sack_high_rxt;
+	uint8_t sacked_count;
+#endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 	struct tcp_collision_avoidance_reno ca;
 #endif
@@ -337,6 +376,13 @@ struct tcp { /* TCP connection */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
 	bool rst_received : 1;
+#ifdef CONFIG_NET_TCP_TIMESTAMPS
+	bool ts_ok : 1;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_ok : 1;
+	bool sack_recovery : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
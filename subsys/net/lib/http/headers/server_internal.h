@@ -47,12 +47,43 @@ bool compression_value_is_valid(enum http_compression compression);
 /* Others */
 struct http_resource_detail *get_resource_detail(const struct http_service_desc *service,
 						 const char *path, int *len, bool is_ws);
+bool http_server_resource_matches(const struct http_resource_desc *resource, const char *path,
+				  bool is_websocket, int *path_len);
+bool http_server_route_ready(const struct http_service_desc *service);
+const struct http_resource_desc *http_server_route_lookup(const struct http_service_desc *service,
+							  const char *path, bool is_websocket,
+							  int *path_len);
 int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t len);
 void http_server_get_content_type_from_extension(char *url, char *content_type,
 						 size_t content_type_size);
 int http_server_find_file(char *fname, size_t fname_size, size_t *file_size,
 			  uint8_t supported_compression, enum http_compression *chosen_compression);
 void http_client_timer_restart(struct http_client_ctx *client);
+
+/* Static filesystem resource cache */
+struct http_fs_cache_entry {
+	sys_dnode_t node;
+	/* Requested file name followed by the suffix of the chosen variant */
+	char path[HTTP_SERVER_MAX_URL_LENGTH];
+	size_t name_len;
+	size_t size;
+	/* File contents, NULL if only the metadata is cached */
+	uint8_t *data;
+	int64_t checked;
+	char etag[HTTP_SERVER_ETAG_LEN];
+	uint8_t supported_compression;
+	enum http_compression compression;
+	uint16_t refs;
+	bool stale;
+};
+
+int http_server_fs_cache_get(const char *fname, uint8_t supported_compression,
+			     struct http_fs_cache_entry **entry);
+void http_server_fs_cache_put(struct http_fs_cache_entry *entry);
+bool http_server_fs_cache_not_modified(const struct http_fs_cache_entry *entry,
+				       const struct http_client_ctx *client);
+bool http_server_claim_dynamic_resource(struct http_resource_detail_dynamic *detail,
+					struct http_client_ctx *client);
 bool http_response_is_final(struct http_response_ctx *rsp, enum http_data_status status);
 bool http_response_is_provided(struct http_response_ctx *rsp);
 
@@ -41,23 +41,64 @@ LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
 
 #define HTTP_SERVER_MAX_SERVICES CONFIG_HTTP_SERVER_NUM_SERVICES
 #define HTTP_SERVER_MAX_CLIENTS  CONFIG_HTTP_SERVER_MAX_CLIENTS
-#define HTTP_SERVER_SOCK_COUNT (1 + HTTP_SERVER_MAX_SERVICES + HTTP_SERVER_MAX_CLIENTS)
+#define HTTP_SERVER_NUM_WORKERS  CONFIG_HTTP_SERVER_NUM_WORKERS
+#define HTTP_SERVER_WORKER_CLIENTS \
+	DIV_ROUND_UP(HTTP_SERVER_MAX_CLIENTS, HTTP_SERVER_NUM_WORKERS)
+#define HTTP_SERVER_SOCK_COUNT (1 + HTTP_SERVER_MAX_SERVICES + HTTP_SERVER_WORKER_CLIENTS)
 
+#if HTTP_SERVER_NUM_WORKERS > 1
+struct http_server_handoff {
+	const struct http_service_desc *service;
+	int fd;
+};
+#endif
+
+/* One context per event loop. The first one is run by the server thread and
+ * owns the listen sockets, the others only serve the clients handed over to
+ * them by the first one.
+ */
 struct http_server_ctx {
 	int listen_fds; /* max value of 1 + MAX_SERVICES */
 
-	/* First pollfd is eventfd that can be used to stop the server,
-	 * then we have the server listen sockets,
+	/* Number of clients assigned to this context */
+	int num_clients;
+
+	/* First pollfd is eventfd that can be used to stop or wake up the
+	 * event loop, then we have the server listen sockets,
 	 * and then the accepted sockets.
 	 */
 	struct zsock_pollfd fds[HTTP_SERVER_SOCK_COUNT];
-	struct http_client_ctx clients[HTTP_SERVER_MAX_CLIENTS];
+	struct http_client_ctx clients[HTTP_SERVER_WORKER_CLIENTS];
+
+#if HTTP_SERVER_NUM_WORKERS > 1
+	/* Accepted sockets waiting to be picked up by the worker */
+	struct k_msgq handoff;
+	struct http_server_handoff handoff_buf[HTTP_SERVER_WORKER_CLIENTS];
+	struct k_sem start;
+#endif
 };
 
-static struct http_server_ctx server_ctx;
+static struct http_server_ctx server_ctx[HTTP_SERVER_NUM_WORKERS];
 static K_SEM_DEFINE(server_start, 0, 1);
 static bool server_running;
 
+/* Protects the client counters, which are updated from every event loop,
+ * and the events of the listen sockets, which are paused while their
+ * service is full and resumed by whichever loop releases a client.
+ */
+static struct k_spinlock clients_lock;
+
+/* Protects the holder of dynamic resources */
+static struct k_spinlock resource_lock;
+
+#if HTTP_SERVER_NUM_WORKERS > 1
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, HTTP_SERVER_NUM_WORKERS - 1,
+				   CONFIG_HTTP_SERVER_STACK_SIZE);
+static struct k_thread worker_threads[HTTP_SERVER_NUM_WORKERS - 1];
+static K_SEM_DEFINE(workers_done, 0, HTTP_SERVER_NUM_WORKERS - 1);
+static bool workers_stopping;
+#endif
+
 #if defined(CONFIG_HTTP_SERVER_TLS_USE_ALPN)
 static const char *const alpn_list[] = {"h2", "http/1.1"};
 #endif
@@ -92,6 +133,7 @@ int http_server_init(struct http_server_ctx *ctx)
 	/* Initialize fds */
 	memset(ctx->fds, 0, sizeof(ctx->fds));
 	memset(ctx->clients, 0, sizeof(ctx->clients));
+	ctx->num_clients = 0;
 
 	for (i = 0; i < ARRAY_SIZE(ctx->fds); i++) {
 		ctx->fds[i].fd = INVALID_SOCK;
@@ -279,8 +321,57 @@ static int accept_new_client(int server_fd)
 	return new_socket;
 }
 
+static void update_client_count(struct http_server_ctx *ctx,
+				const struct http_service_desc *svc, int delta)
+{
+	k_spinlock_key_t key = k_spin_lock(&clients_lock);
+
+	ctx->num_clients += delta;
+	svc->data->num_clients += delta;
+
+	k_spin_unlock(&clients_lock, key);
+}
+
+static struct http_server_ctx *client_server_ctx(struct http_client_ctx *client)
+{
+	ARRAY_FOR_EACH_PTR(server_ctx, ctx) {
+		if (IS_ARRAY_ELEMENT(ctx->clients, client)) {
+			return ctx;
+		}
+	}
+
+	__ASSERT(false, "client %p not owned by the server", client);
+
+	return NULL;
+}
+
+#if HTTP_SERVER_NUM_WORKERS > 1
+static void http_server_workers_stop(void);
+
+static void close_pending_handoffs(struct http_server_ctx *ctx)
+{
+	struct http_server_handoff handoff;
+
+	while (k_msgq_get(&ctx->handoff, &handoff, K_NO_WAIT) == 0) {
+		update_client_count(ctx, handoff.service, -1);
+		zsock_close(handoff.fd);
+	}
+}
+#endif
+
 static void close_all_sockets(struct http_server_ctx *ctx)
 {
+#if HTTP_SERVER_NUM_WORKERS > 1
+	if (ctx == &server_ctx[0]) {
+		/* Workers may still wake up the first context, so they have
+		 * to be stopped before its eventfd is closed.
+		 */
+		http_server_workers_stop();
+	} else {
+		close_pending_handoffs(ctx);
+	}
+#endif
+
 	zsock_close(ctx->fds[0].fd); /* close eventfd */
 	ctx->fds[0].fd = -1;
 
@@ -293,7 +384,7 @@ static void close_all_sockets(struct http_server_ctx *ctx)
 			zsock_close(ctx->fds[i].fd);
 		} else {
 			struct http_client_ctx *client =
-				&server_ctx.clients[i - ctx->listen_fds];
+				&ctx->clients[i - ctx->listen_fds];
 
 			close_client_connection(client);
 		}
@@ -301,6 +392,10 @@ static void close_all_sockets(struct http_server_ctx *ctx)
 		ctx->fds[i].fd = -1;
 	}
 
+	if (ctx != &server_ctx[0]) {
+		return;
+	}
+
 	HTTP_SERVICE_FOREACH(svc) {
 		*svc->fd = -1;
 	}
@@ -345,27 +440,58 @@ static void client_release_resources(struct http_client_ctx *client)
 	}
 }
 
+bool http_server_claim_dynamic_resource(struct http_resource_detail_dynamic *detail,
+					struct http_client_ctx *client)
+{
+	k_spinlock_key_t key = k_spin_lock(&resource_lock);
+	bool claimed = (detail->holder == NULL || detail->holder == client);
+
+	if (claimed) {
+		detail->holder = client;
+	}
+
+	k_spin_unlock(&resource_lock, key);
+
+	return claimed;
+}
+
 void http_server_release_client(struct http_client_ctx *client)
 {
 	int i;
 	struct k_work_sync sync;
-
-	__ASSERT_NO_MSG(IS_ARRAY_ELEMENT(server_ctx.clients, client));
+	struct http_server_ctx *ctx = client_server_ctx(client);
+	struct http_server_ctx *main_ctx = &server_ctx[0];
+	k_spinlock_key_t key;
+	bool resumed = false;
 
 	k_work_cancel_delayable_sync(&client->inactivity_timer, &sync);
 	client_release_resources(client);
 
+	/* Together with the count, so that a listener paused on a full service
+	 * concurrently is resumed
+	 */
+	key = k_spin_lock(&clients_lock);
+
+	ctx->num_clients--;
 	client->service->data->num_clients--;
 
-	for (i = 0; i < server_ctx.listen_fds; i++) {
-		if (server_ctx.fds[i].fd == *client->service->fd) {
-			server_ctx.fds[i].events = ZSOCK_POLLIN;
+	for (i = 0; i < main_ctx->listen_fds; i++) {
+		if (main_ctx->fds[i].fd == *client->service->fd) {
+			resumed = main_ctx->fds[i].events == 0;
+			main_ctx->fds[i].events = ZSOCK_POLLIN;
 			break;
 		}
 	}
-	for (i = server_ctx.listen_fds; i < ARRAY_SIZE(server_ctx.fds); i++) {
-		if (server_ctx.fds[i].fd == client->fd) {
-			server_ctx.fds[i].fd = INVALID_SOCK;
+
+	k_spin_unlock(&clients_lock, key);
+
+	if (resumed && ctx != main_ctx) {
+		/* Let the first context poll the listener again */
+		eventfd_write(main_ctx->fds[0].fd, 1);
+	}
+	for (i = ctx->listen_fds; i < ARRAY_SIZE(ctx->fds); i++) {
+		if (ctx->fds[i].fd == client->fd) {
+			ctx->fds[i].fd = INVALID_SOCK;
 			break;
 		}
 	}
@@ -399,7 +525,7 @@ static void client_timeout(struct k_work *work)
 
 void http_client_timer_restart(struct http_client_ctx *client)
 {
-	__ASSERT_NO_MSG(IS_ARRAY_ELEMENT(server_ctx.clients, client));
+	__ASSERT_NO_MSG(client_server_ctx(client) != NULL);
 
 	k_work_reschedule(&client->inactivity_timer, INACTIVITY_TIMEOUT);
 }
@@ -544,14 +670,165 @@ static int handle_http_request(struct http_client_ctx *client)
 	return 0;
 }
 
+static int add_client(struct http_server_ctx *ctx, const struct http_service_desc *service,
+		      int new_socket)
+{
+	for (int j = ctx->listen_fds; j < ctx->listen_fds + ARRAY_SIZE(ctx->clients); j++) {
+		if (ctx->fds[j].fd != INVALID_SOCK) {
+			continue;
+		}
+
+		ctx->fds[j].fd = new_socket;
+		ctx->fds[j].events = ZSOCK_POLLIN;
+		ctx->fds[j].revents = 0;
+
+		LOG_DBG("Init client #%d", j - ctx->listen_fds);
+
+		init_client_ctx(&ctx->clients[j - ctx->listen_fds], service, new_socket);
+
+		return 0;
+	}
+
+	LOG_DBG("No free slot found.");
+
+	return -ENOMEM;
+}
+
+/* Stop polling the listen socket fds[i] of a full service */
+static bool pause_full_listener(struct http_server_ctx *ctx, int i,
+				const struct http_service_desc *service)
+{
+	k_spinlock_key_t key = k_spin_lock(&clients_lock);
+	bool full = service->data->num_clients >= service->concurrent;
+
+	if (full) {
+		ctx->fds[i].events = 0;
+	}
+
+	k_spin_unlock(&clients_lock, key);
+
+	return full;
+}
+
+/* Pick the event loop with the fewest clients and account the new client to it */
+static struct http_server_ctx *pick_server_ctx(const struct http_service_desc *service)
+{
+	struct http_server_ctx *target = &server_ctx[0];
+	k_spinlock_key_t key = k_spin_lock(&clients_lock);
+
+	for (int w = 1; w < HTTP_SERVER_NUM_WORKERS; w++) {
+		struct http_server_ctx *ctx = &server_ctx[w];
+
+		if (ctx->fds[0].fd >= 0 && ctx->num_clients < target->num_clients) {
+			target = ctx;
+		}
+	}
+
+	target->num_clients++;
+	service->data->num_clients++;
+
+	k_spin_unlock(&clients_lock, key);
+
+	return target;
+}
+
+#if HTTP_SERVER_NUM_WORKERS > 1
+static int handoff_client(struct http_server_ctx *ctx, const struct http_service_desc *service,
+			  int new_socket)
+{
+	struct http_server_handoff handoff = {
+		.service = service,
+		.fd = new_socket,
+	};
+	int ret;
+
+	ret = k_msgq_put(&ctx->handoff, &handoff, K_NO_WAIT);
+	if (ret < 0) {
+		return ret;
+	}
+
+	eventfd_write(ctx->fds[0].fd, 1);
+
+	return 0;
+}
+
+static void receive_handoffs(struct http_server_ctx *ctx)
+{
+	struct http_server_handoff handoff;
+
+	/* The first context accepts the clients it serves itself, only the
+	 * workers have a handoff queue.
+	 */
+	if (ctx == &server_ctx[0]) {
+		return;
+	}
+
+	while (k_msgq_get(&ctx->handoff, &handoff, K_NO_WAIT) == 0) {
+		if (add_client(ctx, handoff.service, handoff.fd) < 0) {
+			update_client_count(ctx, handoff.service, -1);
+			zsock_close(handoff.fd);
+		}
+	}
+}
+
+static bool server_ctx_running(struct http_server_ctx *ctx)
+{
+	if (ctx != &server_ctx[0]) {
+		return !workers_stopping;
+	}
+
+	return server_running;
+}
+#else
+static int handoff_client(struct http_server_ctx *ctx, const struct http_service_desc *service,
+			  int new_socket)
+{
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(service);
+	ARG_UNUSED(new_socket);
+
+	return -ENOTSUP;
+}
+
+static void receive_handoffs(struct http_server_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+
+static bool server_ctx_running(struct http_server_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	return server_running;
+}
+#endif /* HTTP_SERVER_NUM_WORKERS > 1 */
+
+static int assign_client(struct http_server_ctx *ctx, const struct http_service_desc *service,
+			 int new_socket)
+{
+	struct http_server_ctx *target = pick_server_ctx(service);
+	int ret;
+
+	if (target == ctx) {
+		ret = add_client(ctx, service, new_socket);
+	} else {
+		ret = handoff_client(target, service, new_socket);
+	}
+
+	if (ret < 0) {
+		update_client_count(target, service, -1);
+	}
+
+	return ret;
+}
+
 static int http_server_run(struct http_server_ctx *ctx)
 {
 	struct http_client_ctx *client;
 	const struct http_service_desc *service;
 	eventfd_t value;
-	bool found_slot;
 	int new_socket;
-	int ret, i, j;
+	int ret, i;
 	int sock_error;
 	socklen_t optlen = sizeof(int);
 
@@ -567,14 +844,20 @@ static int http_server_run(struct http_server_ctx *ctx)
 
 		if (ret == 0) {
 			/* should not happen because timeout is -1 */
-			break;
+			goto closing;
 		}
 
-		if (ret == 1 && ctx->fds[0].revents) {
+		if (ctx->fds[0].revents && !server_ctx_running(ctx)) {
+			if (ret == 1) {
+				eventfd_read(ctx->fds[0].fd, &value);
+				LOG_DBG("Received stop event. exiting ..");
+				ret = 0;
+				goto closing;
+			}
+		} else if (ctx->fds[0].revents) {
+			/* Woken up for handed over clients or a resumed listener */
 			eventfd_read(ctx->fds[0].fd, &value);
-			LOG_DBG("Received stop event. exiting ..");
-			ret = 0;
-			goto closing;
+			receive_handoffs(ctx);
 		}
 
 		for (i = 1; i < ARRAY_SIZE(ctx->fds); i++) {
@@ -621,8 +904,7 @@ static int http_server_run(struct http_server_ctx *ctx)
 				service = lookup_service(ctx->fds[i].fd);
 				__ASSERT(NULL != service, "fd not associated with a service");
 
-				if (service->data->num_clients >= service->concurrent) {
-					ctx->fds[i].events = 0;
+				if (pause_full_listener(ctx, i, service)) {
 					continue;
 				}
 
@@ -633,29 +915,7 @@ static int http_server_run(struct http_server_ctx *ctx)
 					continue;
 				}
 
-				found_slot = false;
-
-				for (j = ctx->listen_fds; j < ARRAY_SIZE(ctx->fds); j++) {
-					if (ctx->fds[j].fd != INVALID_SOCK) {
-						continue;
-					}
-
-					ctx->fds[j].fd = new_socket;
-					ctx->fds[j].events = ZSOCK_POLLIN;
-					ctx->fds[j].revents = 0;
-
-					service->data->num_clients++;
-
-					LOG_DBG("Init client #%d", j - ctx->listen_fds);
-
-					init_client_ctx(&ctx->clients[j - ctx->listen_fds], service,
-							new_socket);
-					found_slot = true;
-					break;
-				}
-
-				if (!found_slot) {
-					LOG_DBG("No free slot found.");
+				if (assign_client(ctx, service, new_socket) < 0) {
 					zsock_close(new_socket);
 				}
 
@@ -741,7 +1001,7 @@ static int path_len_without_query(const char *path)
 	return len;
 }
 
-static bool skip_this(struct http_resource_desc *resource, bool is_websocket)
+static bool skip_this(const struct http_resource_desc *resource, bool is_websocket)
 {
 	struct http_resource_detail *detail;
 
@@ -760,32 +1020,53 @@ static bool skip_this(struct http_resource_desc *resource, bool is_websocket)
 	return false;
 }
 
-struct http_resource_detail *get_resource_detail(const struct http_service_desc *service,
-						 const char *path, int *path_len, bool is_websocket)
+bool http_server_resource_matches(const struct http_resource_desc *resource, const char *path,
+				  bool is_websocket, int *path_len)
 {
-	HTTP_SERVICE_FOREACH_RESOURCE(service, resource) {
-		if (skip_this(resource, is_websocket)) {
-			continue;
-		}
+	if (skip_this(resource, is_websocket)) {
+		return false;
+	}
 
-		if (IS_ENABLED(CONFIG_HTTP_SERVER_RESOURCE_WILDCARD)) {
-			int ret;
+	if (IS_ENABLED(CONFIG_HTTP_SERVER_RESOURCE_WILDCARD)) {
+		int ret;
 
-			ret = fnmatch(resource->resource, path, (FNM_PATHNAME | FNM_LEADING_DIR));
-			if (ret == 0) {
-				*path_len = path_len_without_query(path);
-				return resource->detail;
-			}
+		ret = fnmatch(resource->resource, path, (FNM_PATHNAME | FNM_LEADING_DIR));
+		if (ret == 0) {
+			*path_len = path_len_without_query(path);
+			return true;
 		}
+	}
 
-		if (compare_strings(path, resource->resource) == 0) {
-			NET_DBG("Got match for %s", resource->resource);
+	if (compare_strings(path, resource->resource) == 0) {
+		NET_DBG("Got match for %s", resource->resource);
 
-			*path_len = strlen(resource->resource);
-			return resource->detail;
+		*path_len = strlen(resource->resource);
+		return true;
+	}
+
+	return false;
+}
+
+struct http_resource_detail *get_resource_detail(const struct http_service_desc *service,
+						 const char *path, int *path_len, bool is_websocket)
+{
+	const struct http_resource_desc *match = NULL;
+
+	if (IS_ENABLED(CONFIG_HTTP_SERVER_RESOURCE_TRIE) && http_server_route_ready(service)) {
+		match = http_server_route_lookup(service, path, is_websocket, path_len);
+	} else {
+		HTTP_SERVICE_FOREACH_RESOURCE(service, resource) {
+			if (http_server_resource_matches(resource, path, is_websocket, path_len)) {
+				match = resource;
+				break;
+			}
 		}
 	}
 
+	if (match != NULL) {
+		return match->detail;
+	}
+
 	if (service->res_fallback != NULL) {
 		*path_len = path_len_without_query(path);
 		return service->res_fallback;
@@ -960,13 +1241,121 @@ int http_server_stop(void)
 
 	server_running = false;
 	k_sem_reset(&server_start);
-	eventfd_write(server_ctx.fds[0].fd, 1);
+	eventfd_write(server_ctx[0].fds[0].fd, 1);
 
 	LOG_DBG("Stopping HTTP server");
 
 	return 0;
 }
 
+#if HTTP_SERVER_NUM_WORKERS > 1
+static int started_workers;
+
+static void http_server_worker_thread(void *p1, void *p2, void *p3)
+{
+	struct http_server_ctx *ctx = p1;
+	int ret;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&ctx->start, K_FOREVER);
+
+		ret = http_server_run(ctx);
+		if (ret < 0) {
+			LOG_ERR("HTTP server worker %d stopped (%d)", (int)(ctx - server_ctx), ret);
+		}
+
+		k_sem_give(&workers_done);
+	}
+}
+
+static void http_server_workers_create(void)
+{
+	for (int w = 1; w < HTTP_SERVER_NUM_WORKERS; w++) {
+		struct http_server_ctx *ctx = &server_ctx[w];
+		k_tid_t tid;
+
+		ctx->fds[0].fd = INVALID_SOCK;
+		k_sem_init(&ctx->start, 0, 1);
+		k_msgq_init(&ctx->handoff, (char *)ctx->handoff_buf, sizeof(ctx->handoff_buf[0]),
+			    ARRAY_SIZE(ctx->handoff_buf));
+
+		tid = k_thread_create(&worker_threads[w - 1], worker_stacks[w - 1],
+				      K_THREAD_STACK_SIZEOF(worker_stacks[w - 1]),
+				      http_server_worker_thread, ctx, NULL, NULL,
+				      THREAD_PRIORITY, 0, K_FOREVER);
+		k_thread_name_set(tid, "http_server_worker");
+
+#if defined(CONFIG_HTTP_SERVER_WORKER_CPU_PIN)
+		/* The server thread itself is not pinned and keeps CPU 0 busy
+		 * with accepting, so spread the workers over the other CPUs.
+		 */
+		(void)k_thread_cpu_pin(tid, w % arch_num_cpus());
+#endif
+
+		k_thread_start(tid);
+	}
+}
+
+static void http_server_workers_start(void)
+{
+	int fd;
+
+	workers_stopping = false;
+
+	for (int w = 1; w < HTTP_SERVER_NUM_WORKERS; w++) {
+		struct http_server_ctx *ctx = &server_ctx[w];
+
+		memset(ctx->fds, 0, sizeof(ctx->fds));
+		memset(ctx->clients, 0, sizeof(ctx->clients));
+		ctx->num_clients = 0;
+
+		for (int i = 0; i < ARRAY_SIZE(ctx->fds); i++) {
+			ctx->fds[i].fd = INVALID_SOCK;
+		}
+
+		/* Wakes the worker up for new clients and to stop it */
+		fd = eventfd(0, 0);
+		if (fd < 0) {
+			LOG_ERR("eventfd failed for worker %d (%d)", w, -errno);
+			continue;
+		}
+
+		ctx->fds[0].fd = fd;
+		ctx->fds[0].events = ZSOCK_POLLIN;
+		ctx->listen_fds = 1;
+
+		started_workers++;
+		k_sem_give(&ctx->start);
+	}
+}
+
+static void http_server_workers_stop(void)
+{
+	workers_stopping = true;
+
+	for (int w = 1; w < HTTP_SERVER_NUM_WORKERS; w++) {
+		if (server_ctx[w].fds[0].fd >= 0) {
+			eventfd_write(server_ctx[w].fds[0].fd, 1);
+		}
+	}
+
+	for (; started_workers > 0; started_workers--) {
+		k_sem_take(&workers_done, K_FOREVER);
+	}
+}
+#else
+static void http_server_workers_create(void)
+{
+}
+
+static void http_server_workers_start(void)
+{
+}
+#endif /* HTTP_SERVER_NUM_WORKERS > 1 */
+
 static void http_server_thread(void *p1, void *p2, void *p3)
 {
 	int ret;
@@ -975,17 +1364,21 @@ static void http_server_thread(void *p1, void *p2, void *p3)
 	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
+	http_server_workers_create();
+
 	while (true) {
 		k_sem_take(&server_start, K_FOREVER);
 
 		while (server_running) {
-			ret = http_server_init(&server_ctx);
+			ret = http_server_init(&server_ctx[0]);
 			if (ret < 0) {
 				LOG_ERR("Failed to initialize HTTP2 server");
 				goto again;
 			}
 
-			ret = http_server_run(&server_ctx);
+			http_server_workers_start();
+
+			ret = http_server_run(&server_ctx[0]);
 			if (!server_running) {
 				continue;
 			}
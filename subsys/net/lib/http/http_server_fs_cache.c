@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/http/server.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/dlist.h>
+
+LOG_MODULE_DECLARE(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
+
+#include "headers/server_internal.h"
+
+static struct http_fs_cache_entry entries[CONFIG_HTTP_SERVER_FS_CACHE_ENTRIES];
+
+/* Cached entries, most recently used first */
+static sys_dlist_t lru = SYS_DLIST_STATIC_INIT(&lru);
+
+K_HEAP_DEFINE(cache_heap, CONFIG_HTTP_SERVER_FS_CACHE_SIZE);
+K_MUTEX_DEFINE(cache_lock);
+
+static void entry_drop(struct http_fs_cache_entry *entry)
+{
+	if (entry->data != NULL) {
+		k_heap_free(&cache_heap, entry->data);
+		entry->data = NULL;
+	}
+
+	if (sys_dnode_is_linked(&entry->node)) {
+		sys_dlist_remove(&entry->node);
+	}
+}
+
+static struct http_fs_cache_entry *entry_find(const char *fname, size_t len,
+					      uint8_t supported_compression)
+{
+	struct http_fs_cache_entry *entry;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&lru, entry, node) {
+		if (entry->name_len == len &&
+		    entry->supported_compression == supported_compression &&
+		    memcmp(entry->path, fname, len) == 0) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* Drop the least recently used entry that is not being sent */
+static bool evict_one(void)
+{
+	struct http_fs_cache_entry *entry;
+	sys_dnode_t *node;
+
+	for (node = sys_dlist_peek_tail(&lru); node != NULL; node = sys_dlist_peek_prev(&lru, node)) {
+		entry = CONTAINER_OF(node, struct http_fs_cache_entry, node);
+
+		if (entry->refs == 0) {
+			entry_drop(entry);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static struct http_fs_cache_entry *entry_alloc(void)
+{
+	do {
+		ARRAY_FOR_EACH_PTR(entries, entry) {
+			if (!sys_dnode_is_linked(&entry->node)) {
+				return entry;
+			}
+		}
+	} while (evict_one());
+
+	return NULL;
+}
+
+static uint8_t *data_alloc(size_t size)
+{
+	uint8_t *data;
+
+	do {
+		data = k_heap_alloc(&cache_heap, MAX(size, 1), K_NO_WAIT);
+		if (data != NULL) {
+			return data;
+		}
+	} while (evict_one());
+
+	return NULL;
+}
+
+static int read_file(struct fs_file_t *file, struct http_fs_cache_entry *entry)
+{
+	uint8_t buf[64];
+	uint32_t crc = 0;
+	size_t offset = 0;
+	ssize_t len;
+
+	while (offset < entry->size) {
+		if (entry->data != NULL) {
+			len = fs_read(file, entry->data + offset, entry->size - offset);
+		} else {
+			len = fs_read(file, buf, MIN(sizeof(buf), entry->size - offset));
+		}
+
+		if (len <= 0) {
+			return len < 0 ? len : -EIO;
+		}
+
+		crc = crc32_ieee_update(crc, entry->data != NULL ? entry->data + offset : buf, len);
+		offset += len;
+	}
+
+	snprintk(entry->etag, sizeof(entry->etag), "\"%08x-%zx\"", (unsigned int)crc,
+		 entry->size);
+
+	return 0;
+}
+
+static int entry_fill(struct http_fs_cache_entry *entry, const char *fname, size_t len,
+		      uint8_t supported_compression)
+{
+	struct fs_file_t file;
+	int ret;
+
+	if (len >= sizeof(entry->path)) {
+		return -ENAMETOOLONG;
+	}
+
+	memcpy(entry->path, fname, len + 1);
+	entry->compression = HTTP_NONE;
+
+	ret = http_server_find_file(entry->path, sizeof(entry->path), &entry->size,
+				    supported_compression, &entry->compression);
+	if (ret < 0) {
+		return -ENOENT;
+	}
+
+	entry->name_len = len;
+	entry->supported_compression = supported_compression;
+	entry->refs = 0;
+	entry->stale = false;
+
+	/* A file that does not fit is still cached with its metadata */
+	if (entry->size <= CONFIG_HTTP_SERVER_FS_CACHE_MAX_FILE_SIZE) {
+		entry->data = data_alloc(entry->size);
+	}
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, entry->path, FS_O_READ);
+	if (ret < 0) {
+		LOG_ERR("fs_open %s: %d", entry->path, ret);
+		entry_drop(entry);
+		return ret;
+	}
+
+	ret = read_file(&file, entry);
+	fs_close(&file);
+
+	if (ret < 0) {
+		LOG_ERR("Filesystem read error (%d)", ret);
+		entry_drop(entry);
+		return ret;
+	}
+
+	entry->checked = k_uptime_get();
+
+	return 0;
+}
+
+static bool entry_valid(struct http_fs_cache_entry *entry)
+{
+	struct fs_dirent dirent;
+	int64_t now = k_uptime_get();
+
+	if (entry->stale) {
+		return false;
+	}
+
+	if (now - entry->checked < CONFIG_HTTP_SERVER_FS_CACHE_TTL) {
+		return true;
+	}
+
+	if (fs_stat(entry->path, &dirent) < 0 || dirent.size != entry->size) {
+		return false;
+	}
+
+	entry->checked = now;
+
+	return true;
+}
+
+int http_server_fs_cache_get(const char *fname, uint8_t supported_compression,
+			     struct http_fs_cache_entry **entry)
+{
+	struct http_fs_cache_entry *found;
+	size_t len = strlen(fname);
+	int ret = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	found = entry_find(fname, len, supported_compression);
+	if (found != NULL && !entry_valid(found)) {
+		if (found->refs > 0) {
+			/* Still being sent in its old version */
+			ret = -EBUSY;
+			goto out;
+		}
+
+		entry_drop(found);
+		found = NULL;
+	}
+
+	if (found == NULL) {
+		found = entry_alloc();
+		if (found == NULL) {
+			ret = -ENOMEM;
+			goto out;
+		}
+
+		ret = entry_fill(found, fname, len, supported_compression);
+		if (ret < 0) {
+			goto out;
+		}
+	} else {
+		sys_dlist_remove(&found->node);
+	}
+
+	sys_dlist_prepend(&lru, &found->node);
+	found->refs++;
+	*entry = found;
+
+out:
+	k_mutex_unlock(&cache_lock);
+
+	return ret;
+}
+
+void http_server_fs_cache_put(struct http_fs_cache_entry *entry)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	entry->refs--;
+	if (entry->refs == 0 && entry->stale) {
+		entry_drop(entry);
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+bool http_server_fs_cache_not_modified(const struct http_fs_cache_entry *entry,
+				       const struct http_client_ctx *client)
+{
+	const char *tags = client->if_none_match;
+
+	if (tags[0] == '\0') {
+		return false;
+	}
+
+	return strcmp(tags, "*") == 0 || strstr(tags, entry->etag) != NULL;
+}
+
+void http_server_fs_cache_invalidate(void)
+{
+	struct http_fs_cache_entry *entry, *next;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&lru, entry, next, node) {
+		if (entry->refs > 0) {
+			entry->stale = true;
+		} else {
+			entry_drop(entry);
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
@@ -466,9 +466,6 @@ static int dynamic_post_put_req(struct http_resource_detail_dynamic *dynamic_det
 
 #if defined(CONFIG_FILE_SYSTEM)
 
-int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *static_fs_detail,
-				    struct http_client_ctx *client)
-{
 #define RESPONSE_TEMPLATE_STATIC_FS                                                                \
 	"HTTP/1.1 200 OK\r\n"                                                                      \
 	"Content-Length: %zd\r\n"                                                                  \
@@ -488,12 +485,121 @@ int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *stati
 		(STATIC_FS_RESPONSE_BASE_SIZE + CONTENT_ENCODING_HEADER_SIZE),                     \
 		(STATIC_FS_RESPONSE_BASE_SIZE))
 
+static int http1_send_file(struct http_client_ctx *client, const char *fname, size_t file_size,
+			   char *buf, size_t buf_size)
+{
+	struct fs_file_t file;
+	size_t remaining;
+	int len;
+	int ret;
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, fname, FS_O_READ);
+	if (ret < 0) {
+		LOG_ERR("fs_open %s: %d", fname, ret);
+		return ret;
+	}
+
+	remaining = file_size;
+	while (remaining > 0) {
+		len = fs_read(&file, buf, MIN(buf_size, remaining));
+		if (len <= 0) {
+			LOG_ERR("Filesystem read error (%d)", len);
+			ret = len < 0 ? len : -EIO;
+			break;
+		}
+
+		ret = http_server_sendall(client, buf, len);
+		if (ret < 0) {
+			break;
+		}
+
+		remaining -= len;
+	}
+
+	fs_close(&file);
+
+	return ret;
+}
+
+#if defined(CONFIG_HTTP_SERVER_FS_CACHE)
+
+#define RESPONSE_TEMPLATE_STATIC_FS_ETAG                                                           \
+	"HTTP/1.1 200 OK\r\n"                                                                      \
+	"Content-Length: %zd\r\n"                                                                  \
+	"Content-Type: %s%s%s\r\n"                                                                 \
+	"ETag: %s\r\n\r\n"
+#define RESPONSE_TEMPLATE_NOT_MODIFIED                                                             \
+	"HTTP/1.1 304 Not Modified\r\n"                                                            \
+	"ETag: %s\r\n\r\n"
+
+/* Returns -EAGAIN if the file has to be served without the cache */
+static int http1_send_cached_file(struct http_client_ctx *client, const char *fname,
+				  const char *content_type)
+{
+	char http_response[STATIC_FS_RESPONSE_SIZE + sizeof("ETag: \r\n") + HTTP_SERVER_ETAG_LEN];
+	struct http_fs_cache_entry *entry;
+	uint8_t supported_compression = 0;
+	const char *encoding = "";
+	int len;
+	int ret;
+
+#if defined(CONFIG_HTTP_SERVER_COMPRESSION)
+	supported_compression = client->supported_compression;
+#endif
+
+	ret = http_server_fs_cache_get(fname, supported_compression, &entry);
+	if (ret == -ENOENT) {
+		LOG_ERR("fs_stat %s: %d", fname, ret);
+		return send_http1_404(client);
+	} else if (ret < 0) {
+		return -EAGAIN;
+	}
+
+	if (http_server_fs_cache_not_modified(entry, client)) {
+		len = snprintk(http_response, sizeof(http_response),
+			       RESPONSE_TEMPLATE_NOT_MODIFIED, entry->etag);
+		ret = http_server_sendall(client, http_response, len);
+		client->http1_headers_sent = true;
+		goto out;
+	}
+
+	if (IS_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION)) {
+		encoding = http_compression_text(entry->compression);
+	}
+
+	len = snprintk(http_response, sizeof(http_response), RESPONSE_TEMPLATE_STATIC_FS_ETAG,
+		       entry->size, content_type, encoding[0] != 0 ? CONTENT_ENCODING_HEADER : "",
+		       encoding, entry->etag);
+	ret = http_server_sendall(client, http_response, len);
+	if (ret < 0) {
+		goto out;
+	}
+
+	client->http1_headers_sent = true;
+
+	/* Small files go out straight from the cache */
+	if (entry->data != NULL) {
+		ret = http_server_sendall(client, entry->data, entry->size);
+	} else {
+		ret = http1_send_file(client, entry->path, entry->size, http_response,
+				      sizeof(http_response));
+	}
+
+out:
+	http_server_fs_cache_put(entry);
+
+	return ret;
+}
+#endif /* CONFIG_HTTP_SERVER_FS_CACHE */
+
+int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *static_fs_detail,
+				    struct http_client_ctx *client)
+{
 	enum http_compression chosen_compression = 0;
 	int len;
-	int remaining;
 	int ret;
 	size_t file_size;
-	struct fs_file_t file;
 	char fname[HTTP_SERVER_MAX_URL_LENGTH];
 	char content_type[HTTP_SERVER_MAX_CONTENT_TYPE_LEN] = "text/html";
 	char http_response[STATIC_FS_RESPONSE_SIZE];
@@ -514,6 +620,13 @@ int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *stati
 			 client->url_buffer);
 	}
 
+#if defined(CONFIG_HTTP_SERVER_FS_CACHE)
+	ret = http1_send_cached_file(client, fname, content_type);
+	if (ret != -EAGAIN) {
+		return ret;
+	}
+#endif
+
 	/* open file, if it exists */
 #ifdef CONFIG_HTTP_SERVER_COMPRESSION
 	ret = http_server_find_file(fname, sizeof(fname), &file_size, client->supported_compression,
@@ -525,14 +638,6 @@ int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *stati
 		LOG_ERR("fs_stat %s: %d", fname, ret);
 		return send_http1_404(client);
 	}
-	fs_file_t_init(&file);
-	ret = fs_open(&file, fname, FS_O_READ);
-	if (ret < 0) {
-		LOG_ERR("fs_open %s: %d", fname, ret);
-		if (ret < 0) {
-			return ret;
-		}
-	}
 
 	LOG_DBG("found %s, file size: %zu", fname, file_size);
 
@@ -548,33 +653,13 @@ int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *stati
 	}
 	ret = http_server_sendall(client, http_response, len);
 	if (ret < 0) {
-		goto close;
+		return ret;
 	}
 
 	client->http1_headers_sent = true;
 
 	/* read and send file */
-	remaining = file_size;
-	while (remaining > 0) {
-		len = fs_read(&file, http_response, sizeof(http_response));
-		if (len < 0) {
-			LOG_ERR("Filesystem read error (%d)", len);
-			goto close;
-		}
-
-		ret = http_server_sendall(client, http_response, len);
-		if (ret < 0) {
-			goto close;
-		}
-		remaining -= len;
-	}
-	ret = http_server_sendall(client, "\r\n\r\n", 4);
-
-close:
-	/* close file */
-	fs_close(&file);
-
-	return ret;
+	return http1_send_file(client, fname, file_size, http_response, sizeof(http_response));
 }
 #endif
 
@@ -595,7 +680,7 @@ static int handle_http1_dynamic_resource(
 		return send_http1_405(client);
 	}
 
-	if (dynamic_detail->holder != NULL && dynamic_detail->holder != client) {
+	if (!http_server_claim_dynamic_resource(dynamic_detail, client)) {
 		ret = send_http1_409(client);
 		if (ret < 0) {
 			return ret;
@@ -604,8 +689,6 @@ static int handle_http1_dynamic_resource(
 		return enter_http_done_state(client);
 	}
 
-	dynamic_detail->holder = client;
-
 	switch (client->method) {
 	case HTTP_HEAD:
 		if (user_method & BIT(HTTP_HEAD)) {
@@ -724,6 +807,11 @@ static int on_header_field(struct http_parser *parser, const char *at,
 				ctx->accept_encoding_next = true;
 			}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_FS_CACHE
+			else if (strcasecmp(ctx->header_buffer, "If-None-Match") == 0) {
+				ctx->if_none_match_next = true;
+			}
+#endif /* CONFIG_HTTP_SERVER_FS_CACHE */
 
 			ctx->header_buffer[0] = '\0';
 		}
@@ -816,6 +904,14 @@ static int on_header_value(struct http_parser *parser,
 				ctx->accept_encoding_next = false;
 			}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_FS_CACHE
+			if (ctx->if_none_match_next) {
+				if (offset < sizeof(ctx->if_none_match)) {
+					memcpy(ctx->if_none_match, ctx->header_buffer, offset + 1);
+				}
+				ctx->if_none_match_next = false;
+			}
+#endif /* CONFIG_HTTP_SERVER_FS_CACHE */
 
 			ctx->header_buffer[0] = '\0';
 		}
@@ -900,6 +996,10 @@ int enter_http1_request(struct http_client_ctx *client)
 		client->header_capture_ctx.store_next_value = false;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_FS_CACHE)
+	client->if_none_match[0] = '\0';
+#endif
+
 	memset(client->header_buffer, 0, sizeof(client->header_buffer));
 	memset(client->url_buffer, 0, sizeof(client->url_buffer));
 
@@ -451,12 +451,126 @@ out:
 }
 
 #if defined(CONFIG_FILE_SYSTEM)
+static int http2_send_file(struct http_client_ctx *client, const char *fname, size_t file_size,
+			   uint32_t stream_id)
+{
+	struct fs_file_t file;
+	size_t remaining;
+	char tmp[64];
+	int len;
+	int ret;
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, fname, FS_O_READ);
+	if (ret < 0) {
+		LOG_ERR("fs_open %s: %d", fname, ret);
+		return ret;
+	}
+
+	remaining = file_size;
+	while (remaining > 0) {
+		len = fs_read(&file, tmp, sizeof(tmp));
+		if (len <= 0) {
+			LOG_ERR("Filesystem read error (%d)", len);
+			ret = len < 0 ? len : -EIO;
+			break;
+		}
+
+		remaining -= MIN(remaining, len);
+		ret = send_data_frame(client, tmp, len, stream_id,
+				      (remaining > 0) ? 0 : HTTP2_FLAG_END_STREAM);
+		if (ret < 0) {
+			LOG_DBG("Cannot write to socket (%d)", ret);
+			break;
+		}
+	}
+
+	fs_close(&file);
+
+	return ret;
+}
+
+#if defined(CONFIG_HTTP_SERVER_FS_CACHE)
+/* Returns -EAGAIN if the file has to be served without the cache */
+static int http2_send_cached_file(struct http_client_ctx *client, struct http2_frame *frame,
+				  const char *fname, struct http_resource_detail *res_detail)
+{
+	struct http_fs_cache_entry *entry;
+	struct http_header etag = {
+		.name = "etag",
+	};
+	uint8_t supported_compression = 0;
+	int ret;
+
+#if defined(CONFIG_HTTP_SERVER_COMPRESSION)
+	supported_compression = client->supported_compression;
+#endif
+
+	ret = http_server_fs_cache_get(fname, supported_compression, &entry);
+	if (ret == -ENOENT) {
+		LOG_ERR("fs_stat %s: %d", fname, ret);
+
+		ret = send_headers_frame(client, HTTP_404_NOT_FOUND, frame->stream_identifier, NULL,
+					 0, NULL, 0);
+		if (ret < 0) {
+			LOG_DBG("Cannot write to socket (%d)", ret);
+		}
+		return ret;
+	} else if (ret < 0) {
+		return -EAGAIN;
+	}
+
+	etag.value = entry->etag;
+
+	if (http_server_fs_cache_not_modified(entry, client)) {
+		ret = send_headers_frame(client, HTTP_304_NOT_MODIFIED, frame->stream_identifier,
+					 NULL, HTTP2_FLAG_END_STREAM, &etag, 1);
+		if (ret < 0) {
+			LOG_DBG("Cannot write to socket (%d)", ret);
+			goto out;
+		}
+
+		client->current_stream->end_stream_sent = true;
+		goto out;
+	}
+
+	if (IS_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION)) {
+		res_detail->content_encoding = http_compression_text(entry->compression);
+	}
+
+	ret = send_headers_frame(client, HTTP_200_OK, frame->stream_identifier, res_detail,
+				 entry->size == 0 ? HTTP2_FLAG_END_STREAM : 0, &etag, 1);
+	if (ret < 0) {
+		LOG_DBG("Cannot write to socket (%d)", ret);
+		goto out;
+	}
+
+	/* Small files go out straight from the cache, in a single DATA frame */
+	if (entry->data != NULL && entry->size > 0) {
+		ret = send_data_frame(client, entry->data, entry->size, frame->stream_identifier,
+				      HTTP2_FLAG_END_STREAM);
+	} else if (entry->size > 0) {
+		ret = http2_send_file(client, entry->path, entry->size, frame->stream_identifier);
+	}
+
+	if (ret < 0) {
+		goto out;
+	}
+
+	client->current_stream->end_stream_sent = true;
+
+out:
+	http_server_fs_cache_put(entry);
+
+	return ret;
+}
+#endif /* CONFIG_HTTP_SERVER_FS_CACHE */
+
 static int handle_http2_static_fs_resource(struct http_resource_detail_static_fs *static_fs_detail,
 					   struct http2_frame *frame,
 					   struct http_client_ctx *client)
 {
 	int ret;
-	struct fs_file_t file;
 	char fname[HTTP_SERVER_MAX_URL_LENGTH];
 	char content_type[HTTP_SERVER_MAX_CONTENT_TYPE_LEN] = "text/html";
 	struct http_resource_detail res_detail = {
@@ -468,8 +582,6 @@ static int handle_http2_static_fs_resource(struct http_resource_detail_static_fs
 	};
 	enum http_compression chosen_compression = 0;
 	int len;
-	int remaining;
-	char tmp[64];
 
 	if (client->method != HTTP_GET) {
 		return send_http2_405(client, frame);
@@ -491,6 +603,13 @@ static int handle_http2_static_fs_resource(struct http_resource_detail_static_fs
 			 client->url_buffer);
 	}
 
+#if defined(CONFIG_HTTP_SERVER_FS_CACHE)
+	ret = http2_send_cached_file(client, frame, fname, &res_detail);
+	if (ret != -EAGAIN) {
+		return ret;
+	}
+#endif
+
 	/* open file, if it exists */
 #ifdef CONFIG_HTTP_SERVER_COMPRESSION
 	ret = http_server_find_file(fname, sizeof(fname), &client->data_len,
@@ -508,51 +627,27 @@ static int handle_http2_static_fs_resource(struct http_resource_detail_static_fs
 		}
 		return ret;
 	}
-	fs_file_t_init(&file);
-	ret = fs_open(&file, fname, FS_O_READ);
-	if (ret < 0) {
-		LOG_ERR("fs_open %s: %d", fname, ret);
-		if (ret < 0) {
-			return ret;
-		}
-	}
 
 	/* send headers */
 	if (IS_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION)) {
 		res_detail.content_encoding = http_compression_text(chosen_compression);
 	}
-	ret = send_headers_frame(client, HTTP_200_OK, frame->stream_identifier, &res_detail, 0,
-				 NULL, 0);
+	ret = send_headers_frame(client, HTTP_200_OK, frame->stream_identifier, &res_detail,
+				 client->data_len == 0 ? HTTP2_FLAG_END_STREAM : 0, NULL, 0);
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
-		goto out;
+		return ret;
 	}
 
 	/* read and send file */
-	remaining = client->data_len;
-	while (remaining > 0) {
-		len = fs_read(&file, tmp, sizeof(tmp));
-		if (len < 0) {
-			LOG_ERR("Filesystem read error (%d)", len);
-			goto out;
-		}
-
-		remaining -= len;
-		ret = send_data_frame(client, tmp, len, frame->stream_identifier,
-				      (remaining > 0) ? 0 : HTTP2_FLAG_END_STREAM);
-		if (ret < 0) {
-			LOG_DBG("Cannot write to socket (%d)", ret);
-			goto out;
-		}
+	ret = http2_send_file(client, fname, client->data_len, frame->stream_identifier);
+	if (ret < 0) {
+		return ret;
 	}
 
 	client->current_stream->end_stream_sent = true;
 
-out:
-	/* close file */
-	fs_close(&file);
-
-	return ret;
+	return 0;
 }
 #endif /* CONFIG_FILE_SYSTEM */
 
@@ -782,7 +877,7 @@ static int handle_http2_dynamic_resource(
 		return send_http2_405(client, frame);
 	}
 
-	if (dynamic_detail->holder != NULL && dynamic_detail->holder != client) {
+	if (!http_server_claim_dynamic_resource(dynamic_detail, client)) {
 		ret = send_http2_409(client, frame);
 		if (ret < 0) {
 			return ret;
@@ -791,8 +886,6 @@ static int handle_http2_dynamic_resource(
 		return enter_http_done_state(client);
 	}
 
-	dynamic_detail->holder = client;
-
 	switch (client->method) {
 	case HTTP_GET:
 	case HTTP_DELETE:
@@ -1351,6 +1444,11 @@ static int process_header(struct http_client_ctx *client,
 			HTTP_GET, HTTP_DELETE, HTTP_POST, HTTP_PUT, HTTP_PATCH
 		};
 
+#if defined(CONFIG_HTTP_SERVER_FS_CACHE)
+		/* Pseudo-headers come first, so this starts a new request */
+		client->if_none_match[0] = '\0';
+#endif
+
 		for (int i = 0; i < ARRAY_SIZE(supported_methods); i++) {
 			if ((header->value_len ==
 			     strlen(http_method_str(supported_methods[i]))) &&
@@ -1405,6 +1503,15 @@ static int process_header(struct http_client_ctx *client,
 						       &client->supported_compression);
 	}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_FS_CACHE
+	else if (header->name_len == (sizeof("if-none-match") - 1) &&
+		 memcmp(header->name, "if-none-match", header->name_len) == 0) {
+		if (header->value_len < sizeof(client->if_none_match)) {
+			memcpy(client->if_none_match, header->value, header->value_len);
+			client->if_none_match[header->value_len] = '\0';
+		}
+	}
+#endif /* CONFIG_HTTP_SERVER_FS_CACHE */
 	else {
 		/* Just ignore for now. */
 		LOG_DBG("Ignoring field %.*s", (int)header->name_len, header->name);
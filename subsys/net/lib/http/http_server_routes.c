@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Resource path trie. The resources of every service are split into path
+ * segments at boot and stored as a trie, with the children of all nodes
+ * kept in one hash table keyed by parent node and segment. A literal
+ * resource hangs off the node of its last segment, a wildcard resource off
+ * the node of its longest literal segment prefix, as with FNM_PATHNAME a
+ * wildcard never matches a '/'. A lookup walks the request path segment
+ * by segment and only checks the resources found along the way, with the
+ * same match function and precedence as the linear lookup.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/init.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/http/service.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_DECLARE(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
+
+#include "headers/server_internal.h"
+
+#define ROUTE_NIL       0
+#define ROUTE_SIZE      CONFIG_HTTP_SERVER_RESOURCE_TRIE_SIZE
+#define ROUTE_HASH_SIZE NHPOT(2 * ROUTE_SIZE)
+
+struct route_node {
+	const char *seg;
+	uint16_t seg_len;
+	uint16_t parent;
+	/* Resources ending at this node */
+	uint16_t exact;
+	/* Wildcard resources whose literal prefix ends at this node */
+	uint16_t wild;
+};
+
+/* Resource lists are kept in resource order */
+struct route_entry {
+	uint16_t res;
+	uint16_t next;
+};
+
+struct route_match {
+	const struct http_resource_desc *resource;
+	uint16_t res;
+	int path_len;
+};
+
+/* Index 0 of both pools is the list terminator */
+static struct route_node nodes[ROUTE_SIZE + 1];
+static struct route_entry entries[ROUTE_SIZE + 1];
+static uint16_t route_hash[ROUTE_HASH_SIZE];
+static uint16_t nodes_used;
+static uint16_t entries_used;
+
+static uint32_t route_hash_key(uint16_t parent, const char *seg, size_t len)
+{
+	/* FNV-1a, seeded with the parent node */
+	uint32_t hash = (2166136261U ^ parent) * 16777619U;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ (uint8_t)seg[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static size_t segment_len(const char *seg, const char *end)
+{
+	const char *p = seg;
+
+	while (p < end && *p != '/') {
+		p++;
+	}
+
+	return p - seg;
+}
+
+static bool segment_is_wildcard(const char *seg, size_t len)
+{
+	if (!IS_ENABLED(CONFIG_HTTP_SERVER_RESOURCE_WILDCARD)) {
+		return false;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		if (seg[i] == '*' || seg[i] == '?' || seg[i] == '[' || seg[i] == '\\') {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static uint16_t find_child(uint16_t parent, const char *seg, size_t len)
+{
+	uint32_t slot = route_hash_key(parent, seg, len);
+	struct route_node *node;
+
+	for (;; slot++) {
+		slot &= ROUTE_HASH_SIZE - 1;
+
+		if (route_hash[slot] == ROUTE_NIL) {
+			return ROUTE_NIL;
+		}
+
+		node = &nodes[route_hash[slot]];
+		if (node->parent == parent && node->seg_len == len &&
+		    memcmp(node->seg, seg, len) == 0) {
+			return route_hash[slot];
+		}
+	}
+}
+
+static uint16_t node_alloc(uint16_t parent, const char *seg, size_t len)
+{
+	struct route_node *node;
+
+	if (nodes_used == ROUTE_SIZE || len > UINT16_MAX) {
+		return ROUTE_NIL;
+	}
+
+	node = &nodes[++nodes_used];
+	node->seg = seg;
+	node->seg_len = len;
+	node->parent = parent;
+	node->exact = ROUTE_NIL;
+	node->wild = ROUTE_NIL;
+
+	return nodes_used;
+}
+
+static uint16_t add_child(uint16_t parent, const char *seg, size_t len)
+{
+	uint16_t child;
+	uint32_t slot;
+
+	child = find_child(parent, seg, len);
+	if (child != ROUTE_NIL) {
+		return child;
+	}
+
+	child = node_alloc(parent, seg, len);
+	if (child == ROUTE_NIL) {
+		return ROUTE_NIL;
+	}
+
+	/* The table is at most half full, so there is always a free slot */
+	slot = route_hash_key(parent, seg, len);
+	while (route_hash[slot & (ROUTE_HASH_SIZE - 1)] != ROUTE_NIL) {
+		slot++;
+	}
+
+	route_hash[slot & (ROUTE_HASH_SIZE - 1)] = child;
+
+	return child;
+}
+
+static int add_entry(uint16_t *list, uint16_t res)
+{
+	uint16_t *link = list;
+
+	if (entries_used == ROUTE_SIZE) {
+		return -ENOMEM;
+	}
+
+	entries_used++;
+	entries[entries_used].res = res;
+	entries[entries_used].next = ROUTE_NIL;
+
+	while (*link != ROUTE_NIL) {
+		link = &entries[*link].next;
+	}
+
+	*link = entries_used;
+
+	return 0;
+}
+
+static int route_insert(uint16_t root, const char *resource, uint16_t res)
+{
+	const char *end = resource + strlen(resource);
+	const char *seg = resource;
+	uint16_t node = root;
+	size_t len;
+
+	while (true) {
+		len = segment_len(seg, end);
+
+		if (segment_is_wildcard(seg, len)) {
+			return add_entry(&nodes[node].wild, res);
+		}
+
+		node = add_child(node, seg, len);
+		if (node == ROUTE_NIL) {
+			return -ENOMEM;
+		}
+
+		if (seg + len == end) {
+			return add_entry(&nodes[node].exact, res);
+		}
+
+		seg += len + 1;
+	}
+}
+
+static int route_build(const struct http_service_desc *svc)
+{
+	uint16_t root;
+	uint16_t res = 0;
+	int ret;
+
+	root = node_alloc(ROUTE_NIL, NULL, 0);
+	if (root == ROUTE_NIL) {
+		return -ENOMEM;
+	}
+
+	HTTP_SERVICE_FOREACH_RESOURCE(svc, resource) {
+		ret = route_insert(root, resource->resource, res++);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	svc->data->route_root = root;
+
+	return 0;
+}
+
+static void route_check(const struct http_service_desc *svc, uint16_t list, const char *path,
+			bool is_websocket, struct route_match *match)
+{
+	const struct http_resource_desc *resource;
+	int path_len;
+
+	/* Only a resource defined earlier than the current match can win */
+	for (; list != ROUTE_NIL && entries[list].res < match->res; list = entries[list].next) {
+		resource = &svc->res_begin[entries[list].res];
+
+		if (http_server_resource_matches(resource, path, is_websocket, &path_len)) {
+			match->resource = resource;
+			match->res = entries[list].res;
+			match->path_len = path_len;
+			return;
+		}
+	}
+}
+
+bool http_server_route_ready(const struct http_service_desc *service)
+{
+	return service->data->route_root != ROUTE_NIL;
+}
+
+const struct http_resource_desc *http_server_route_lookup(const struct http_service_desc *service,
+							  const char *path, bool is_websocket,
+							  int *path_len)
+{
+	struct route_match match = {
+		.res = UINT16_MAX,
+	};
+	const char *end = path + strcspn(path, "?");
+	uint16_t node = service->data->route_root;
+	const char *seg = path;
+	size_t len;
+
+	route_check(service, nodes[node].wild, path, is_websocket, &match);
+
+	while (true) {
+		len = segment_len(seg, end);
+
+		node = find_child(node, seg, len);
+		if (node == ROUTE_NIL) {
+			break;
+		}
+
+		route_check(service, nodes[node].wild, path, is_websocket, &match);
+
+		/* fnmatch() with FNM_LEADING_DIR also lets a resource match
+		 * the paths below it.
+		 */
+		if (seg + len == end || IS_ENABLED(CONFIG_HTTP_SERVER_RESOURCE_WILDCARD)) {
+			route_check(service, nodes[node].exact, path, is_websocket, &match);
+		}
+
+		if (seg + len == end) {
+			break;
+		}
+
+		seg += len + 1;
+	}
+
+	if (match.resource != NULL) {
+		*path_len = match.path_len;
+	}
+
+	return match.resource;
+}
+
+static int http_server_routes_init(void)
+{
+	HTTP_SERVICE_FOREACH(svc) {
+		if (route_build(svc) < 0) {
+			LOG_WRN("Resource trie full, service on port %u uses linear lookup",
+				*svc->port);
+		}
+	}
+
+	LOG_DBG("Resource trie uses %u nodes, %u entries", nodes_used, entries_used);
+
+	return 0;
+}
+
+SYS_INIT(http_server_routes_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
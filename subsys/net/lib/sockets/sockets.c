@@ -805,6 +805,24 @@ static inline int z_vrfy_zsock_ioctl_impl(int sock, unsigned long request, va_li
 #include <zephyr/syscalls/zsock_ioctl_impl_mrsh.c>
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZERO_COPY)
+ssize_t zsock_recv_zc(int sock, struct net_buf **frags, int flags)
+{
+	int bytes_received;
+
+	bytes_received = zsock_ioctl(sock, ZFD_IOCTL_RECV_ZC, frags, flags);
+
+	sock_obj_core_update_recv_stats(sock, bytes_received);
+
+	return bytes_received;
+}
+
+int zsock_recv_zc_release(int sock, struct net_buf *frags)
+{
+	return zsock_ioctl(sock, ZFD_IOCTL_RECV_ZC_RELEASE, frags);
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZERO_COPY */
+
 int z_impl_zsock_inet_pton(sa_family_t family, const char *src, void *dst)
 {
 	if (net_addr_pton(family, src, dst) == 0) {
@@ -1473,6 +1473,131 @@ static ssize_t zsock_recv_stream(struct net_context *ctx, struct msghdr *msg,
 	return recv_len;
 }
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZERO_COPY)
+/* Take the payload of a received packet out of it, dropping the headers in
+ * front of the read cursor, and free the packet itself.
+ */
+static struct net_buf *pkt_payload_detach(struct net_pkt *pkt)
+{
+	struct net_buf *frag = pkt->cursor.buf;
+
+	if (frag == NULL) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	while (pkt->buffer != frag) {
+		pkt->buffer = net_buf_frag_del(NULL, pkt->buffer);
+	}
+
+	net_buf_pull(frag, pkt->cursor.pos - frag->data);
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	return frag;
+}
+
+static int zsock_recv_stream_zc(struct net_context *ctx, struct net_buf **frags,
+				int flags)
+{
+	k_timeout_t timeout = K_FOREVER;
+	struct net_buf *head = NULL;
+	struct net_pkt *pkt;
+	size_t recv_len = 0;
+	int res;
+
+	if (frags == NULL || (flags & ~ZSOCK_MSG_DONTWAIT) != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*frags = NULL;
+
+	if (net_context_get_type(ctx) != SOCK_STREAM) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+		errno = ENOTCONN;
+		return -1;
+	}
+
+	if (sock_is_error(ctx)) {
+		errno = POINTER_TO_INT(ctx->user_data);
+		return -1;
+	}
+
+	if (sock_is_eof(ctx)) {
+		return 0;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+	}
+
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		res = zsock_wait_data(ctx, &timeout);
+		if (res < 0) {
+			errno = -res;
+			return -1;
+		}
+	}
+
+	while ((pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT)) != NULL) {
+		size_t len = net_pkt_remaining_data(pkt);
+		bool eof = net_pkt_eof(pkt);
+		struct net_buf *payload;
+
+		if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+		    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+			net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+		}
+
+		if (len > 0) {
+			payload = pkt_payload_detach(pkt);
+			head = (head == NULL) ? payload : net_buf_frag_add(head, payload);
+			recv_len += len;
+		} else {
+			net_pkt_unref(pkt);
+		}
+
+		if (eof) {
+			sock_set_eof(ctx);
+			break;
+		}
+	}
+
+	if (recv_len == 0 && !sock_is_eof(ctx)) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	*frags = head;
+
+	return MIN(recv_len, INT_MAX);
+}
+
+static int zsock_recv_zc_release_ctx(struct net_context *ctx, struct net_buf *frags)
+{
+	size_t len;
+
+	if (frags == NULL) {
+		return 0;
+	}
+
+	len = net_buf_frags_len(frags);
+	net_buf_unref(frags);
+
+	/* The data is only consumed now, so let the peer send more */
+	net_context_update_recv_wnd(ctx, len);
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZERO_COPY */
+
 ssize_t zsock_recvfrom_ctx(struct net_context *ctx, void *buf, size_t max_len,
 			   int flags,
 			   struct sockaddr *src_addr, socklen_t *addrlen)
@@ -2997,6 +3122,26 @@ static int sock_ioctl_vmeth(void *obj, unsigned int request, va_list args)
 		return 0;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZERO_COPY)
+	case ZFD_IOCTL_RECV_ZC: {
+		struct net_buf **frags;
+		int flags;
+
+		frags = va_arg(args, struct net_buf **);
+		flags = va_arg(args, int);
+
+		return zsock_recv_stream_zc(obj, frags, flags);
+	}
+
+	case ZFD_IOCTL_RECV_ZC_RELEASE: {
+		struct net_buf *frags;
+
+		frags = va_arg(args, struct net_buf *);
+
+		return zsock_recv_zc_release_ctx(obj, frags);
+	}
+#endif
+
 	default:
 		errno = EOPNOTSUPP;
 		return -1;
@@ -121,9 +121,28 @@ static void tcp_receiver_cleanup(void)
 	zperf_session_reset(SESSION_TCP);
 }
 
-static int tcp_recv_data(struct net_socket_service_event *pev)
+/* Receive and discard the data available on the socket */
+static int tcp_recv(int sock)
 {
+#if defined(CONFIG_NET_ZPERF_SERVER_RECV_ZERO_COPY)
+	struct net_buf *frags;
+	int ret;
+
+	ret = zsock_recv_zc(sock, &frags, 0);
+	if (ret > 0) {
+		(void)zsock_recv_zc_release(sock, frags);
+	}
+
+	return ret;
+#else
 	static uint8_t buf[TCP_RECEIVER_BUF_SIZE];
+
+	return zsock_recv(sock, buf, sizeof(buf), 0);
+#endif
+}
+
+static int tcp_recv_data(struct net_socket_service_event *pev)
+{
 	int i, ret = 0;
 	int family, sock, sock_error;
 	struct sockaddr addr_incoming_conn;
@@ -189,7 +208,7 @@ static int tcp_recv_data(struct net_socket_service_event *pev)
 		}
 
 	} else {
-		ret = zsock_recv(pev->event.fd, buf, sizeof(buf), 0);
+		ret = tcp_recv(pev->event.fd);
 		if (ret < 0) {
 			(void)zsock_getsockopt(pev->event.fd, SOL_SOCKET,
 					       SO_DOMAIN, &family, &optlen);
@@ -12,9 +12,47 @@
 #include <zephyr/shell/shell_uart.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#if defined(CONFIG_SYMTAB)
+#include <zephyr/debug/symtab.h>
+#endif
+
+#if defined(CONFIG_FILE_SYSTEM)
+#include <zephyr/fs/fs.h>
+#elif defined(CONFIG_SEMIHOST)
+#include <zephyr/arch/common/semihost.h>
+#endif
 
 size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
 
+#if defined(CONFIG_PROFILING_PERF_AGGREGATE)
+
+#define PERF_STACKS  CONFIG_PROFILING_PERF_AGGREGATE_STACKS
+#define PERF_THREADS CONFIG_PROFILING_PERF_AGGREGATE_THREADS
+#define PERF_DEPTH   CONFIG_PROFILING_PERF_AGGREGATE_DEPTH
+
+struct perf_thread {
+	k_tid_t tid;
+	uint32_t samples;
+#if defined(CONFIG_THREAD_NAME)
+	/* Copied, the thread may be gone by the time the samples are printed */
+	char name[CONFIG_THREAD_MAX_NAME_LEN];
+#endif
+};
+
+/* A distinct stack trace of a thread, the trace itself is kept in the perf buffer */
+struct perf_stack {
+	/* 0 if the slot is unused */
+	uint32_t count;
+	uint32_t hash;
+	uint16_t thread;
+	uint16_t len;
+	uint32_t offset;
+};
+
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
+
 struct perf_data_t {
 	struct k_timer timer;
 
@@ -25,6 +63,17 @@ struct perf_data_t {
 	size_t idx;
 	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
 	bool buf_full;
+
+#if defined(CONFIG_PROFILING_PERF_AGGREGATE)
+	uintptr_t trace[PERF_DEPTH];
+	struct perf_stack stacks[PERF_STACKS];
+	struct perf_thread threads[PERF_THREADS];
+	size_t stacks_used;
+	size_t threads_used;
+	uint32_t samples;
+	/* Samples whose stack trace could not be stored */
+	uint32_t dropped;
+#endif
 };
 
 static void perf_tracer(struct k_timer *timer);
@@ -34,6 +83,120 @@ static struct perf_data_t perf_data = {
 	.dwork = Z_WORK_DELAYABLE_INITIALIZER(perf_dwork_handler),
 };
 
+#if defined(CONFIG_PROFILING_PERF_AGGREGATE)
+
+static int perf_thread_index(struct perf_data_t *perf_data_ptr, k_tid_t tid)
+{
+	struct perf_thread *thread;
+
+	for (size_t i = 0; i < perf_data_ptr->threads_used; i++) {
+		if (perf_data_ptr->threads[i].tid == tid) {
+			return i;
+		}
+	}
+
+	if (perf_data_ptr->threads_used == PERF_THREADS) {
+		return -1;
+	}
+
+	thread = &perf_data_ptr->threads[perf_data_ptr->threads_used];
+	thread->tid = tid;
+	thread->samples = 0;
+#if defined(CONFIG_THREAD_NAME)
+	strncpy(thread->name, tid->name, sizeof(thread->name) - 1);
+	thread->name[sizeof(thread->name) - 1] = '\0';
+#endif
+
+	return perf_data_ptr->threads_used++;
+}
+
+static uint32_t perf_stack_hash(int thread, const uintptr_t *trace, size_t len)
+{
+	/* FNV-1a over the return addresses, seeded with the thread */
+	uint32_t hash = (2166136261U ^ (uint32_t)thread) * 16777619U;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ (uint32_t)trace[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+/*
+ * Count the sample against its thread and its stack trace. A trace seen
+ * before only bumps its count, a new one is appended to the perf buffer.
+ * Once the buffer or the table is full new traces are dropped, but the
+ * known ones keep counting.
+ */
+static void perf_aggregate(struct perf_data_t *perf_data_ptr)
+{
+	const uintptr_t *trace = perf_data_ptr->trace;
+	struct perf_stack *stack = NULL;
+	uint32_t hash;
+	size_t slot;
+	size_t len;
+	int thread;
+
+	perf_data_ptr->samples++;
+
+	thread = perf_thread_index(perf_data_ptr, _current);
+	if (thread < 0) {
+		perf_data_ptr->dropped++;
+		return;
+	}
+
+	perf_data_ptr->threads[thread].samples++;
+
+	len = arch_perf_current_stack_trace(perf_data_ptr->trace, PERF_DEPTH);
+	if (len == 0) {
+		perf_data_ptr->dropped++;
+		return;
+	}
+
+	hash = perf_stack_hash(thread, trace, len);
+
+	for (size_t i = 0; i < PERF_STACKS; i++) {
+		slot = (hash + i) % PERF_STACKS;
+		stack = &perf_data_ptr->stacks[slot];
+
+		if (stack->count == 0) {
+			break;
+		}
+
+		if (stack->hash == hash && stack->thread == thread && stack->len == len &&
+		    memcmp(&perf_data_ptr->buf[stack->offset], trace, len * sizeof(*trace)) == 0) {
+			stack->count++;
+			return;
+		}
+	}
+
+	/* Keep one slot free, so that lookups always end */
+	if (stack == NULL || stack->count != 0 || perf_data_ptr->stacks_used == PERF_STACKS - 1 ||
+	    perf_data_ptr->idx + len > CONFIG_PROFILING_PERF_BUFFER_SIZE) {
+		perf_data_ptr->buf_full = true;
+		perf_data_ptr->dropped++;
+		return;
+	}
+
+	memcpy(&perf_data_ptr->buf[perf_data_ptr->idx], trace, len * sizeof(*trace));
+
+	stack->count = 1;
+	stack->hash = hash;
+	stack->thread = thread;
+	stack->len = len;
+	stack->offset = perf_data_ptr->idx;
+
+	perf_data_ptr->idx += len;
+	perf_data_ptr->stacks_used++;
+}
+
+static void perf_tracer(struct k_timer *timer)
+{
+	perf_aggregate((struct perf_data_t *)k_timer_user_data_get(timer));
+}
+
+#else
+
 static void perf_tracer(struct k_timer *timer)
 {
 	struct perf_data_t *perf_data_ptr =
@@ -57,13 +220,17 @@ static void perf_tracer(struct k_timer *timer)
 	}
 }
 
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
+
 static void perf_dwork_handler(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
 	struct perf_data_t *perf_data_ptr = CONTAINER_OF(dwork, struct perf_data_t, dwork);
 
 	k_timer_stop(&perf_data_ptr->timer);
-	if (perf_data_ptr->buf_full) {
+	if (IS_ENABLED(CONFIG_PROFILING_PERF_AGGREGATE)) {
+		shell_print(perf_data_ptr->sh, "Perf done!");
+	} else if (perf_data_ptr->buf_full) {
 		shell_error(perf_data_ptr->sh, "Perf buf overflow!");
 	} else {
 		shell_print(perf_data_ptr->sh, "Perf done!");
@@ -77,7 +244,7 @@ static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 		return -EINPROGRESS;
 	}
 
-	if (perf_data.buf_full) {
+	if (perf_data.buf_full && !IS_ENABLED(CONFIG_PROFILING_PERF_AGGREGATE)) {
 		shell_warn(sh, "Perf buffer is full");
 		return -ENOBUFS;
 	}
@@ -110,6 +277,14 @@ static int cmd_perf_clear(const struct shell *sh, size_t argc, char **argv)
 	perf_data.idx = 0;
 	perf_data.buf_full = false;
 
+#if defined(CONFIG_PROFILING_PERF_AGGREGATE)
+	memset(perf_data.stacks, 0, sizeof(perf_data.stacks));
+	perf_data.stacks_used = 0;
+	perf_data.threads_used = 0;
+	perf_data.samples = 0;
+	perf_data.dropped = 0;
+#endif
+
 	return 0;
 }
 
@@ -122,9 +297,16 @@ static int cmd_perf_info(const struct shell *sh, size_t argc, char **argv)
 	shell_print(sh, "Perf buf: %zu/%d %s", perf_data.idx, CONFIG_PROFILING_PERF_BUFFER_SIZE,
 		    perf_data.buf_full ? "(full)" : "");
 
+#if defined(CONFIG_PROFILING_PERF_AGGREGATE)
+	shell_print(sh, "Samples: %u, stacks: %zu/%d, threads: %zu/%d, dropped: %u",
+		    perf_data.samples, perf_data.stacks_used, PERF_STACKS - 1,
+		    perf_data.threads_used, PERF_THREADS, perf_data.dropped);
+#endif
+
 	return 0;
 }
 
+#if !defined(CONFIG_PROFILING_PERF_AGGREGATE)
 static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 {
 	if (k_work_delayable_is_pending(&perf_data.dwork)) {
@@ -142,10 +324,224 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+#else
+
+typedef int (*perf_out_t)(void *ctx, const char *line, size_t len);
+
+static const char *perf_thread_name(const struct perf_thread *thread, char *buf, size_t size)
+{
+#if defined(CONFIG_THREAD_NAME)
+	if (thread->name[0] != '\0') {
+		return thread->name;
+	}
+#endif
+
+	snprintk(buf, size, "%p", (void *)thread->tid);
+
+	return buf;
+}
+
+/*
+ * Format a stack as "thread;outermost;...;innermost count", the folded
+ * format read by flamegraph.pl. Without CONFIG_SYMTAB the frames are
+ * return addresses, which scripts/profiling/stackcollapse.py resolves.
+ */
+static int perf_folded_line(const struct perf_stack *stack, char *line, size_t size)
+{
+	const uintptr_t *trace = &perf_data.buf[stack->offset];
+	char name_buf[sizeof(void *) * 2 + 3];
+	size_t len;
+	int ret;
+
+	ret = snprintk(line, size, "%s",
+		       perf_thread_name(&perf_data.threads[stack->thread], name_buf,
+					sizeof(name_buf)));
+	len = MIN((size_t)ret, size - 1);
+
+	for (size_t i = stack->len; i-- > 0;) {
+#if defined(CONFIG_SYMTAB)
+		ret = snprintk(line + len, size - len, ";%s",
+			       symtab_find_symbol_name(trace[i], NULL));
+#else
+		ret = snprintk(line + len, size - len, ";0x%lx", (unsigned long)trace[i]);
+#endif
+		len += MIN((size_t)ret, size - 1 - len);
+	}
+
+	ret = snprintk(line + len, size - len, " %u", stack->count);
+	len += MIN((size_t)ret, size - 1 - len);
+
+	return len;
+}
+
+static int perf_folded_write(perf_out_t out, void *ctx)
+{
+	static char line[CONFIG_PROFILING_PERF_AGGREGATE_LINE_LEN];
+	int ret;
+
+	ARRAY_FOR_EACH_PTR(perf_data.stacks, stack) {
+		if (stack->count == 0) {
+			continue;
+		}
+
+		ret = out(ctx, line, perf_folded_line(stack, line, sizeof(line)));
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int perf_out_shell(void *ctx, const char *line, size_t len)
+{
+	shell_print((const struct shell *)ctx, "%.*s", (int)len, line);
+
+	return 0;
+}
+
+#if defined(CONFIG_FILE_SYSTEM)
+
+static int perf_out_file(void *ctx, const char *line, size_t len)
+{
+	struct fs_file_t *file = ctx;
+	ssize_t ret;
+
+	ret = fs_write(file, line, len);
+	if (ret == len) {
+		ret = fs_write(file, "\n", 1);
+	}
+
+	return ret < 0 ? ret : 0;
+}
+
+static int perf_folded_to_file(const char *path)
+{
+	struct fs_file_t file;
+	int ret;
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, path, FS_O_CREATE | FS_O_WRITE | FS_O_TRUNC);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = perf_folded_write(perf_out_file, &file);
+	fs_close(&file);
+
+	return ret;
+}
+
+#elif defined(CONFIG_SEMIHOST)
+
+static int perf_out_semihost(void *ctx, const char *line, size_t len)
+{
+	long fd = POINTER_TO_INT(ctx);
+
+	/* semihost_write() returns the number of bytes not written */
+	if (semihost_write(fd, line, len) != 0 || semihost_write(fd, "\n", 1) != 0) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int perf_folded_to_file(const char *path)
+{
+	long fd;
+	int ret;
+
+	fd = semihost_open(path, SEMIHOST_OPEN_W);
+	if (fd < 0) {
+		return -EIO;
+	}
+
+	ret = perf_folded_write(perf_out_semihost, INT_TO_POINTER(fd));
+	semihost_close(fd);
+
+	return ret;
+}
+
+#else
+
+static int perf_folded_to_file(const char *path)
+{
+	ARG_UNUSED(path);
+
+	return -ENOTSUP;
+}
+
+#endif /* CONFIG_FILE_SYSTEM */
+
+static int cmd_perf_folded(const struct shell *sh, size_t argc, char **argv)
+{
+	int ret;
+
+	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+		shell_warn(sh, "Perf is running");
+		return -EINPROGRESS;
+	}
+
+	if (argc < 2) {
+		return perf_folded_write(perf_out_shell, (void *)sh);
+	}
+
+	ret = perf_folded_to_file(argv[1]);
+	if (ret < 0) {
+		shell_error(sh, "Cannot write %s (%d)", argv[1], ret);
+		return ret;
+	}
+
+	shell_print(sh, "Wrote %zu stacks to %s", perf_data.stacks_used, argv[1]);
+
+	return 0;
+}
+
+static int cmd_perf_threads(const struct shell *sh, size_t argc, char **argv)
+{
+	char name_buf[sizeof(void *) * 2 + 3];
+	const struct perf_thread *thread;
+	uint32_t permille;
+
+	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+		shell_warn(sh, "Perf is running");
+		return -EINPROGRESS;
+	}
+
+	shell_print(sh, "%-24s %10s %7s", "Thread", "Samples", "CPU");
+
+	for (size_t i = 0; i < perf_data.threads_used; i++) {
+		thread = &perf_data.threads[i];
+		permille = (uint64_t)thread->samples * 1000U / MAX(perf_data.samples, 1);
+
+		shell_print(sh, "%-24s %10u %5u.%u%%",
+			    perf_thread_name(thread, name_buf, sizeof(name_buf)), thread->samples,
+			    permille / 10U, permille % 10U);
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
+
 #define CMD_HELP_RECORD                                                                            \
 	"Start recording for <duration> ms on <frequency> Hz\n"                                    \
 	"Usage: record <duration> <frequency>"
 
+#if defined(CONFIG_PROFILING_PERF_AGGREGATE)
+#define CMD_HELP_FOLDED                                                                            \
+	"Print the samples as folded stacks, or write them to <file>\n"                            \
+	"Usage: folded [<file>]"
+
+SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_perf,
+	SHELL_CMD_ARG(record, NULL, CMD_HELP_RECORD, cmd_perf_record, 3, 0),
+	SHELL_CMD_ARG(folded, NULL, CMD_HELP_FOLDED, cmd_perf_folded, 1, 1),
+	SHELL_CMD_ARG(threads, NULL, "Print the samples per thread", cmd_perf_threads, 0, 0),
+	SHELL_CMD_ARG(clear, NULL, "Clear the perf buffer", cmd_perf_clear, 0, 0),
+	SHELL_CMD_ARG(info, NULL, "Print the perf info", cmd_perf_info, 0, 0),
+	SHELL_SUBCMD_SET_END
+);
+#else
 SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_perf,
 	SHELL_CMD_ARG(record, NULL, CMD_HELP_RECORD, cmd_perf_record, 3, 0),
 	SHELL_CMD_ARG(printbuf, NULL, "Print the perf buffer", cmd_perf_print, 0, 0),
@@ -153,4 +549,5 @@ SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_perf,
 	SHELL_CMD_ARG(info, NULL, "Print the perf info", cmd_perf_info, 0, 0),
 	SHELL_SUBCMD_SET_END
 );
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
 SHELL_CMD_ARG_REGISTER(perf, &m_sub_perf, "Lightweight profiler", NULL, 0, 0);
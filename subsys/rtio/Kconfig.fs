@@ -0,0 +1,11 @@
+# Copyright (c) 2025 The Zephyr Project Contributors
+# SPDX-License-Identifier: Apache-2.0
+
+config RTIO_FS
+	bool "RTIO file system operations"
+	depends on FILE_SYSTEM
+	select RTIO_WORKQ
+	help
+	  Enable file iodevs, which read and write open files from the RTIO
+	  work queues. Every operation in flight takes one work item, see
+	  RTIO_WORKQ_POOL_ITEMS.
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/fs.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/work.h>
+
+static void rtio_fs_handler(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	struct rtio_fs *fs = sqe->iodev->data;
+	uint8_t *buf;
+	uint32_t buf_len;
+	ssize_t ret;
+
+	if (sqe->op == RTIO_OP_RX) {
+		if (rtio_sqe_rx_buf(iodev_sqe, 1, rtio_mempool_block_size(iodev_sqe->r), &buf,
+				    &buf_len) < 0) {
+			rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+			return;
+		}
+	}
+
+	k_mutex_lock(&fs->lock, K_FOREVER);
+
+	if (sqe->op == RTIO_OP_RX) {
+		ret = fs_read(fs->file, buf, buf_len);
+	} else {
+		ret = fs_write(fs->file, sqe->tx.buf, sqe->tx.buf_len);
+	}
+
+	k_mutex_unlock(&fs->lock);
+
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, ret);
+	}
+}
+
+static void rtio_fs_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req;
+
+	if (iodev_sqe->sqe.op != RTIO_OP_RX && iodev_sqe->sqe.op != RTIO_OP_TX) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	req = rtio_work_req_alloc();
+	if (req == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, rtio_fs_handler);
+}
+
+const struct rtio_iodev_api rtio_fs_iodev_api = {
+	.submit = rtio_fs_submit,
+};
+
+void rtio_fs_attach(const struct rtio_iodev *iodev, struct fs_file_t *file)
+{
+	struct rtio_fs *fs = iodev->data;
+
+	fs->file = file;
+	k_mutex_init(&fs->lock);
+}
@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Socket operations for RTIO. Submissions are queued on their socket and
+ * the socket is handed to a single reactor thread, which tries the
+ * operations without blocking and waits on an epoll instance for the
+ * sockets whose operations would block. A socket is only registered with
+ * the epoll instance while it has pending operations, so that idle and
+ * closed sockets do not wake the reactor. A multishot receive that finds
+ * the mempool exhausted is parked, without watching its socket, and tried
+ * again periodically until the consumer has released some blocks.
+ */
+
+#include <errno.h>
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/socket.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
+#include <zephyr/zvfs/eventfd.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(rtio_socket, CONFIG_RTIO_LOG_LEVEL);
+
+static K_THREAD_STACK_DEFINE(rtio_sock_stack, CONFIG_RTIO_SOCKET_STACK_SIZE);
+static struct k_thread rtio_sock_thread;
+
+/* Sockets with new submissions or to be detached */
+static struct mpsc rtio_sock_news;
+
+/* Sockets whose multishot receive waits for mempool blocks */
+static sys_slist_t rtio_sock_starved;
+
+static int rtio_sock_epfd = -1;
+static int rtio_sock_efd = -1;
+
+static void rtio_sock_wake_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)zvfs_eventfd_write(rtio_sock_efd, 1);
+}
+
+static K_WORK_DEFINE(rtio_sock_wake_work, rtio_sock_wake_handler);
+
+static void rtio_sock_notify(struct rtio_sock *sock)
+{
+	if (!atomic_cas(&sock->queued, 0, 1)) {
+		/* Already on the list, the reactor will look at it */
+		return;
+	}
+
+	mpsc_push(&rtio_sock_news, &sock->node);
+
+	/* The reactor goes through the list before it waits again */
+	if (k_current_get() == &rtio_sock_thread) {
+		return;
+	}
+
+	if (k_is_in_isr()) {
+		/* Writing the eventfd takes a mutex */
+		k_work_submit(&rtio_sock_wake_work);
+	} else {
+		(void)zvfs_eventfd_write(rtio_sock_efd, 1);
+	}
+}
+
+static void rtio_sock_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_sock *sock = iodev_sqe->sqe.iodev->data;
+
+	switch (iodev_sqe->sqe.op) {
+	case RTIO_OP_RX:
+	case RTIO_OP_ACCEPT:
+		mpsc_push(&sock->rx_q, &iodev_sqe->q);
+		break;
+	case RTIO_OP_TX:
+		mpsc_push(&sock->tx_q, &iodev_sqe->q);
+		break;
+	default:
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	rtio_sock_notify(sock);
+}
+
+const struct rtio_iodev_api rtio_sock_iodev_api = {
+	.submit = rtio_sock_submit,
+};
+
+static struct rtio_iodev_sqe *rtio_sock_pop(struct mpsc *q)
+{
+	struct mpsc_node *node = mpsc_pop(q);
+
+	return node == NULL ? NULL : CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+}
+
+static void rtio_sock_cancel(struct rtio_iodev_sqe *iodev_sqe)
+{
+	/* A multishot submission would be submitted again otherwise */
+	if (iodev_sqe->sqe.flags & RTIO_SQE_MULTISHOT) {
+		iodev_sqe->sqe.flags |= RTIO_SQE_CANCELED;
+	}
+
+	rtio_iodev_sqe_err(iodev_sqe, -ECANCELED);
+}
+
+/* Complete a submission with an error */
+static void rtio_sock_err(struct rtio_iodev_sqe *iodev_sqe, int err)
+{
+	/* A multishot submission would be submitted again, straight back to
+	 * the reactor, and fail the same way forever.  It is canceled instead,
+	 * and as canceled submissions complete silently the error is reported
+	 * here.  The executor releases its mempool block, if any.
+	 */
+	if (iodev_sqe->sqe.flags & RTIO_SQE_MULTISHOT) {
+		rtio_cqe_submit(iodev_sqe->r, err, iodev_sqe->sqe.userdata, 0);
+		iodev_sqe->sqe.flags |= RTIO_SQE_CANCELED;
+	}
+
+	rtio_iodev_sqe_err(iodev_sqe, err);
+}
+
+static bool rtio_sock_is_canceled(struct rtio_iodev_sqe *iodev_sqe)
+{
+	return (iodev_sqe->sqe.flags & RTIO_SQE_CANCELED) != 0;
+}
+
+/* Returns -EAGAIN if the submission has to wait, 0 once it completed */
+static int rtio_sock_rx(struct rtio_sock *sock, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	bool mempool = (sqe->flags & RTIO_SQE_MEMPOOL_BUFFER) != 0;
+	uint8_t *buf;
+	uint32_t buf_len;
+	ssize_t ret;
+
+	if (rtio_sock_is_canceled(iodev_sqe)) {
+		rtio_iodev_sqe_err(iodev_sqe, -ECANCELED);
+		return 0;
+	}
+
+	if (sqe->op == RTIO_OP_ACCEPT) {
+		ret = zsock_accept(sock->fd, NULL, NULL);
+		if (ret < 0 && errno == EAGAIN) {
+			return -EAGAIN;
+		}
+
+		if (ret < 0) {
+			rtio_sock_err(iodev_sqe, -errno);
+		} else {
+			rtio_iodev_sqe_ok(iodev_sqe, ret);
+		}
+
+		return 0;
+	}
+
+	/* Only the end of the stream is left for a multishot receive */
+	if (sock->eof && (sqe->flags & RTIO_SQE_MULTISHOT)) {
+		return -EAGAIN;
+	}
+
+	if (rtio_sqe_rx_buf(iodev_sqe, 1, rtio_mempool_block_size(iodev_sqe->r), &buf,
+			    &buf_len) < 0) {
+		if (sqe->flags & RTIO_SQE_MULTISHOT) {
+			/* Waits for the consumer to release blocks */
+			sock->starved = true;
+			return -EAGAIN;
+		}
+
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return 0;
+	}
+
+	ret = zsock_recv(sock->fd, buf, buf_len, ZSOCK_MSG_DONTWAIT);
+	if (ret < 0 && errno == EAGAIN) {
+		if (mempool) {
+			/* Do not hold on to a block while waiting */
+			rtio_release_buffer(iodev_sqe->r, buf, buf_len);
+			sqe->rx.buf = NULL;
+			sqe->rx.buf_len = 0;
+		}
+
+		return -EAGAIN;
+	}
+
+	if (ret < 0) {
+		rtio_sock_err(iodev_sqe, -errno);
+		return 0;
+	}
+
+	if (ret == 0) {
+		sock->eof = true;
+	}
+
+	rtio_iodev_sqe_ok(iodev_sqe, ret);
+
+	return 0;
+}
+
+static int rtio_sock_tx(struct rtio_sock *sock, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	ssize_t ret;
+
+	if (rtio_sock_is_canceled(iodev_sqe)) {
+		sock->tx_offset = 0;
+		rtio_iodev_sqe_err(iodev_sqe, -ECANCELED);
+		return 0;
+	}
+
+	while (sock->tx_offset < sqe->tx.buf_len) {
+		ret = zsock_send(sock->fd, sqe->tx.buf + sock->tx_offset,
+				 sqe->tx.buf_len - sock->tx_offset, ZSOCK_MSG_DONTWAIT);
+		if (ret < 0 && errno == EAGAIN) {
+			return -EAGAIN;
+		}
+
+		if (ret < 0) {
+			sock->tx_offset = 0;
+			rtio_sock_err(iodev_sqe, -errno);
+			return 0;
+		}
+
+		sock->tx_offset += ret;
+	}
+
+	sock->tx_offset = 0;
+	rtio_iodev_sqe_ok(iodev_sqe, sqe->tx.buf_len);
+
+	return 0;
+}
+
+static int rtio_sock_watch(struct rtio_sock *sock, uint32_t events)
+{
+	struct zvfs_epoll_event event = {
+		.events = events,
+		.data.ptr = sock,
+	};
+	int op;
+
+	if (events == sock->events) {
+		return 0;
+	}
+
+	if (sock->events == 0U) {
+		op = ZVFS_EPOLL_CTL_ADD;
+	} else if (events == 0U) {
+		op = ZVFS_EPOLL_CTL_DEL;
+	} else {
+		op = ZVFS_EPOLL_CTL_MOD;
+	}
+
+	if (zvfs_epoll_ctl(rtio_sock_epfd, op, sock->fd, &event) < 0) {
+		LOG_ERR("Cannot watch socket %d (%d)", sock->fd, errno);
+		return -errno;
+	}
+
+	sock->events = events;
+
+	return 0;
+}
+
+static void rtio_sock_fail(struct rtio_iodev_sqe *iodev_sqe, int err)
+{
+	if (err == -ECANCELED) {
+		rtio_sock_cancel(iodev_sqe);
+	} else {
+		rtio_sock_err(iodev_sqe, err);
+	}
+}
+
+/* Complete all the submissions of a socket with an error */
+static void rtio_sock_fail_all(struct rtio_sock *sock, int err)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+
+	if (sock->starved) {
+		(void)sys_slist_find_and_remove(&rtio_sock_starved, &sock->starved_node);
+		sock->starved = false;
+	}
+
+	if (sock->rx != NULL) {
+		rtio_sock_fail(sock->rx, err);
+		sock->rx = NULL;
+	}
+
+	if (sock->tx != NULL) {
+		rtio_sock_fail(sock->tx, err);
+		sock->tx = NULL;
+	}
+
+	while ((iodev_sqe = rtio_sock_pop(&sock->rx_q)) != NULL) {
+		rtio_sock_fail(iodev_sqe, err);
+	}
+
+	while ((iodev_sqe = rtio_sock_pop(&sock->tx_q)) != NULL) {
+		rtio_sock_fail(iodev_sqe, err);
+	}
+
+	(void)rtio_sock_watch(sock, 0);
+	sock->tx_offset = 0;
+}
+
+static void rtio_sock_detach_all(struct rtio_sock *sock)
+{
+	rtio_sock_fail_all(sock, -ECANCELED);
+	sock->detach = false;
+	k_sem_give(&sock->detached);
+}
+
+/* Make progress on the submissions of a socket */
+static void rtio_sock_process(struct rtio_sock *sock)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	uint32_t events = 0;
+	int ret;
+
+	if (sock->starved) {
+		(void)sys_slist_find_and_remove(&rtio_sock_starved, &sock->starved_node);
+		sock->starved = false;
+	}
+
+	if (sock->detach) {
+		rtio_sock_detach_all(sock);
+		return;
+	}
+
+	/* The submission is taken off the socket before it completes, as a
+	 * multishot receive is submitted again from its completion.
+	 */
+	while (true) {
+		iodev_sqe = sock->rx != NULL ? sock->rx : rtio_sock_pop(&sock->rx_q);
+		if (iodev_sqe == NULL) {
+			break;
+		}
+
+		sock->rx = NULL;
+		if (rtio_sock_rx(sock, iodev_sqe) == -EAGAIN) {
+			sock->rx = iodev_sqe;
+			break;
+		}
+	}
+
+	while (true) {
+		iodev_sqe = sock->tx != NULL ? sock->tx : rtio_sock_pop(&sock->tx_q);
+		if (iodev_sqe == NULL) {
+			break;
+		}
+
+		sock->tx = NULL;
+		if (rtio_sock_tx(sock, iodev_sqe) == -EAGAIN) {
+			sock->tx = iodev_sqe;
+			break;
+		}
+	}
+
+	if (sock->starved) {
+		/* Watching the socket would only report the data it cannot take */
+		sys_slist_append(&rtio_sock_starved, &sock->starved_node);
+	} else if (sock->rx != NULL &&
+		   !(sock->eof && (sock->rx->sqe.flags & RTIO_SQE_MULTISHOT))) {
+		events |= ZVFS_EPOLLIN;
+	}
+
+	if (sock->tx != NULL) {
+		events |= ZVFS_EPOLLOUT;
+	}
+
+	/* Nothing would complete the submissions of an unwatched socket,
+	 * for instance once all the epoll registrations are taken.
+	 */
+	ret = rtio_sock_watch(sock, events);
+	if (ret < 0) {
+		rtio_sock_fail_all(sock, ret);
+	}
+}
+
+static void rtio_sock_reactor(void *p1, void *p2, void *p3)
+{
+	struct zvfs_epoll_event events[CONFIG_RTIO_SOCKET_EVENTS];
+	struct mpsc_node *node;
+	struct rtio_sock *sock;
+	zvfs_eventfd_t value;
+	sys_slist_t starved;
+	sys_snode_t *snode;
+	int timeout;
+	int n;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		timeout = sys_slist_is_empty(&rtio_sock_starved) ?
+			  -1 : CONFIG_RTIO_SOCKET_BUFFER_RETRY_MS;
+
+		n = zvfs_epoll_wait(rtio_sock_epfd, events, ARRAY_SIZE(events), timeout);
+		if (n < 0) {
+			LOG_ERR("epoll wait failed (%d)", errno);
+			k_msleep(10);
+			continue;
+		}
+
+		/* Taken as a whole, as the sockets still starved go back */
+		starved = rtio_sock_starved;
+		sys_slist_init(&rtio_sock_starved);
+
+		while ((snode = sys_slist_get(&starved)) != NULL) {
+			sock = CONTAINER_OF(snode, struct rtio_sock, starved_node);
+			sock->starved = false;
+			rtio_sock_process(sock);
+		}
+
+		for (int i = 0; i < n; i++) {
+			sock = events[i].data.ptr;
+			if (sock == NULL) {
+				(void)zvfs_eventfd_read(rtio_sock_efd, &value);
+			} else if (sock->events != 0U) {
+				rtio_sock_process(sock);
+			}
+		}
+
+		/* Flag cleared first, so that a later submission queues the
+		 * socket again.
+		 */
+		while ((node = mpsc_pop(&rtio_sock_news)) != NULL) {
+			sock = CONTAINER_OF(node, struct rtio_sock, node);
+			atomic_clear(&sock->queued);
+			rtio_sock_process(sock);
+		}
+	}
+}
+
+int rtio_sock_attach(const struct rtio_iodev *iodev, int fd)
+{
+	struct rtio_sock *sock = iodev->data;
+
+	if (zsock_fcntl(fd, ZVFS_F_SETFL, ZVFS_O_NONBLOCK) < 0) {
+		return -errno;
+	}
+
+	*sock = (struct rtio_sock){
+		.fd = fd,
+	};
+	mpsc_init(&sock->rx_q);
+	mpsc_init(&sock->tx_q);
+	k_sem_init(&sock->detached, 0, 1);
+
+	return 0;
+}
+
+void rtio_sock_detach(const struct rtio_iodev *iodev)
+{
+	struct rtio_sock *sock = iodev->data;
+
+	__ASSERT(k_current_get() != &rtio_sock_thread, "Cannot detach from a completion");
+
+	sock->detach = true;
+	rtio_sock_notify(sock);
+	k_sem_take(&sock->detached, K_FOREVER);
+}
+
+static int rtio_sock_init(void)
+{
+	struct zvfs_epoll_event event = {
+		.events = ZVFS_EPOLLIN,
+		.data.ptr = NULL,
+	};
+
+	mpsc_init(&rtio_sock_news);
+	sys_slist_init(&rtio_sock_starved);
+
+	rtio_sock_epfd = zvfs_epoll_create(0);
+	if (rtio_sock_epfd < 0) {
+		LOG_ERR("Cannot create epoll instance (%d)", errno);
+		return -errno;
+	}
+
+	rtio_sock_efd = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+	if (rtio_sock_efd < 0) {
+		LOG_ERR("Cannot create eventfd (%d)", errno);
+		return -errno;
+	}
+
+	if (zvfs_epoll_ctl(rtio_sock_epfd, ZVFS_EPOLL_CTL_ADD, rtio_sock_efd, &event) < 0) {
+		LOG_ERR("Cannot watch eventfd (%d)", errno);
+		return -errno;
+	}
+
+	k_thread_create(&rtio_sock_thread, rtio_sock_stack, K_THREAD_STACK_SIZEOF(rtio_sock_stack),
+			rtio_sock_reactor, NULL, NULL, NULL, CONFIG_RTIO_SOCKET_THREAD_PRIORITY, 0,
+			K_NO_WAIT);
+	k_thread_name_set(&rtio_sock_thread, "rtio_socket");
+
+	return 0;
+}
+
+SYS_INIT(rtio_sock_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Time source for throughput benchmarks
+ *
+ * On native_sim the simulated clock does not advance while code runs, so
+ * the time of the host is used there instead of the cycle counter.
+ */
+
+#ifndef ZEPHYR_TESTSUITE_INCLUDE_BENCH_TIME_H_
+#define ZEPHYR_TESTSUITE_INCLUDE_BENCH_TIME_H_
+
+#include <zephyr/kernel.h>
+
+#ifdef CONFIG_BOARD_NATIVE_SIM
+#include "native_rtc.h"
+#endif
+
+/* Current time in microseconds */
+static inline uint64_t bench_time_us(void)
+{
+#ifdef CONFIG_BOARD_NATIVE_SIM
+	return native_rtc_gettime_us(RTC_CLOCK_PSEUDOHOSTREALTIME);
+#else
+	return k_cyc_to_us_floor64(k_cycle_get_64());
+#endif
+}
+
+#endif /* ZEPHYR_TESTSUITE_INCLUDE_BENCH_TIME_H_ */
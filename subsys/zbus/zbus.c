@@ -50,6 +50,16 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 }
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER_BUF_ALLOC_DYNAMIC */
 
+#if defined(CONFIG_ZBUS_LOANED_MSG)
+
+/* Clones of a loaned buffer share its data, so every message subscriber gets its own buffer
+ * header pointing to the same, reference counted, message.
+ */
+NET_BUF_POOL_VAR_DEFINE(_zbus_loaned_msg_pool, CONFIG_ZBUS_LOANED_MSG_POOL_SIZE,
+			CONFIG_ZBUS_LOANED_MSG_DATA_SIZE, sizeof(struct zbus_channel *), NULL);
+
+#endif /* CONFIG_ZBUS_LOANED_MSG */
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 int _zbus_init(void)
@@ -154,29 +164,33 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 	return 0;
 }
 
-static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t end_time)
+/* The buffer, if given, already holds the message and is consumed */
+static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t end_time,
+				  struct net_buf *buf)
 {
 	int err = 0;
 	int last_error = 0;
-	struct net_buf *buf = NULL;
 
 	/* Static observer event dispatcher logic */
 	struct zbus_channel_observation *observation;
 	struct zbus_channel_observation_mask *observation_mask;
 
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
-	struct net_buf_pool *pool =
-		COND_CODE_1(CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION,
-			    (chan->data->msg_subscriber_pool), (&_zbus_msg_subscribers_pool));
+	if (buf == NULL) {
+		struct net_buf_pool *pool =
+			COND_CODE_1(CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION,
+				    (chan->data->msg_subscriber_pool), (&_zbus_msg_subscribers_pool));
 
-	buf = _zbus_create_net_buf(pool, zbus_chan_msg_size(chan), sys_timepoint_timeout(end_time));
+		buf = _zbus_create_net_buf(pool, zbus_chan_msg_size(chan),
+					   sys_timepoint_timeout(end_time));
 
-	_ZBUS_ASSERT(buf != NULL, "net_buf zbus_msg_subscribers_pool is "
-				  "unavailable or heap is full");
+		_ZBUS_ASSERT(buf != NULL, "net_buf zbus_msg_subscribers_pool is "
+					  "unavailable or heap is full");
 
-	memcpy(net_buf_user_data(buf), &chan, sizeof(struct zbus_channel *));
+		net_buf_add_mem(buf, zbus_chan_msg(chan), zbus_chan_msg_size(chan));
+	}
 
-	net_buf_add_mem(buf, zbus_chan_msg(chan), zbus_chan_msg_size(chan));
+	memcpy(net_buf_user_data(buf), &chan, sizeof(struct zbus_channel *));
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 	LOG_DBG("Notifing %s's observers. Starting VDED:", _ZBUS_CHAN_NAME(chan));
@@ -407,13 +421,86 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 
 	memcpy(chan->message, msg, chan->message_size);
 
-	err = _zbus_vded_exec(chan, end_time);
+	err = _zbus_vded_exec(chan, end_time, NULL);
+
+	chan_unlock(chan, context_priority);
+
+	return err;
+}
+
+#if defined(CONFIG_ZBUS_LOANED_MSG)
+
+int zbus_chan_loan(const struct zbus_channel *chan, struct net_buf **loan, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(loan != NULL, "loan is required");
+	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
+		     "inside an ISR, the timeout must be K_NO_WAIT");
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	struct net_buf *buf =
+		net_buf_alloc_len(&_zbus_loaned_msg_pool, zbus_chan_msg_size(chan), timeout);
+
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	net_buf_add(buf, zbus_chan_msg_size(chan));
+
+	*loan = buf;
+
+	return 0;
+}
+
+int zbus_chan_pub_loan(const struct zbus_channel *chan, struct net_buf *loan, k_timeout_t timeout)
+{
+	int err;
+
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(loan != NULL, "loan is required");
+	_ZBUS_ASSERT(loan->len == zbus_chan_msg_size(chan), "loan must match the channel's message");
+	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
+		     "inside an ISR, the timeout must be K_NO_WAIT");
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+
+	if (chan->validator != NULL && !chan->validator(loan->data, chan->message_size)) {
+		net_buf_unref(loan);
+		return -ENOMSG;
+	}
+
+	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
+
+	err = chan_lock(chan, timeout, &context_priority);
+	if (err) {
+		net_buf_unref(loan);
+		return err;
+	}
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS)
+	chan->data->publish_timestamp = k_uptime_ticks();
+	chan->data->publish_count += 1;
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+	/* Listeners and readers still use the channel's own copy of the message */
+	memcpy(chan->message, loan->data, chan->message_size);
+
+	err = _zbus_vded_exec(chan, end_time, loan);
 
 	chan_unlock(chan, context_priority);
 
 	return err;
 }
 
+#endif /* CONFIG_ZBUS_LOANED_MSG */
+
 int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeout)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
@@ -458,7 +545,7 @@ int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 		return err;
 	}
 
-	err = _zbus_vded_exec(chan, end_time);
+	err = _zbus_vded_exec(chan, end_time, NULL);
 
 	chan_unlock(chan, context_priority);
 
@@ -533,6 +620,33 @@ int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel
 	return 0;
 }
 
+#if defined(CONFIG_ZBUS_LOANED_MSG)
+
+int zbus_sub_wait_loaned_msg(const struct zbus_observer *sub, const struct zbus_channel **chan,
+			     struct net_buf **msg, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus_sub_wait_loaned_msg cannot be used inside ISRs");
+	_ZBUS_ASSERT(sub != NULL, "sub is required");
+	_ZBUS_ASSERT(sub->type == ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE,
+		     "sub must be a MSG_SUBSCRIBER");
+	_ZBUS_ASSERT(sub->message_fifo != NULL, "sub message_fifo is required");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	struct net_buf *buf = k_fifo_get(sub->message_fifo, timeout);
+
+	if (buf == NULL) {
+		return -ENOMSG;
+	}
+
+	*chan = *((struct zbus_channel **)net_buf_user_data(buf));
+	*msg = buf;
+
+	return 0;
+}
+
+#endif /* CONFIG_ZBUS_LOANED_MSG */
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 int zbus_obs_set_chan_notification_mask(const struct zbus_observer *obs,
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Backing store benchmark.  Anonymous pages are mapped one at a time and
+ * filled with partly compressible data until the backing store is full,
+ * which gives the number of pages it holds.  All pages are then read and
+ * checked ROUNDS times, which only pages in, and written once, which also
+ * pages out.  The number of page faults, of backing store page-outs and
+ * the time per page are reported for both walks, followed by the page-in
+ * and page-out timing histograms.  Run the ram and compressed variants,
+ * which reserve the same amount of RAM, for comparison.
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#define MAX_PAGES     128
+#define ROUNDS        4
+/* Bytes of each page filled with random data, the rest is regular */
+#define RANDOM_BYTES  1024
+
+#ifdef CONFIG_BACKING_STORE_RAM_COMPRESSED
+#define STORE_SIZE    CONFIG_BACKING_STORE_RAM_COMPRESSED_SIZE
+#else
+#define STORE_SIZE    (CONFIG_BACKING_STORE_RAM_PAGES * CONFIG_MMU_PAGE_SIZE)
+#endif
+
+static uint8_t *pages[MAX_PAGES];
+static uint8_t expected[CONFIG_MMU_PAGE_SIZE];
+
+static void fill_page(uint8_t *page, uint32_t seed, uint32_t generation)
+{
+	uint32_t *words = (uint32_t *)page;
+
+	for (int i = 0; i < RANDOM_BYTES; i++) {
+		seed = seed * 1103515245U + 12345U;
+		page[i] = seed >> 16;
+	}
+
+	/* Small counters, as in tables of structures */
+	for (int i = RANDOM_BYTES / 4; i < CONFIG_MMU_PAGE_SIZE / 4; i++) {
+		words[i] = i % 16 == 0 ? generation : i % 64;
+	}
+}
+
+static unsigned long histogram_total(struct k_mem_paging_histogram_t *hist)
+{
+	unsigned long total = 0;
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM_NUM_BINS; i++) {
+		total += hist->counts[i];
+	}
+
+	return total;
+}
+
+static unsigned long page_outs(void)
+{
+	struct k_mem_paging_histogram_t hist;
+
+	k_mem_paging_histogram_backing_store_page_out_get(&hist);
+
+	return histogram_total(&hist);
+}
+
+static void print_histogram(const char *name, struct k_mem_paging_histogram_t *hist)
+{
+	printk("%s histogram:\n", name);
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM_NUM_BINS; i++) {
+		printk("  <= %llu ns: %lu\n", k_cyc_to_ns_ceil64(hist->bounds[i]),
+		       hist->counts[i]);
+	}
+}
+
+static size_t fill(void)
+{
+	size_t count;
+
+	for (count = 0; count < MAX_PAGES; count++) {
+		pages[count] = k_mem_map(CONFIG_MMU_PAGE_SIZE, K_MEM_PERM_RW);
+		if (pages[count] == NULL) {
+			break;
+		}
+
+		fill_page(pages[count], count, 0);
+	}
+
+	return count;
+}
+
+static int walk(const char *name, size_t count, uint32_t generation, bool write)
+{
+	struct k_mem_paging_stats_t before, after;
+	unsigned long outs = page_outs();
+	int rounds = write ? 1 : ROUNDS;
+	uint64_t start, elapsed;
+
+	k_mem_paging_stats_get(&before);
+	start = k_cycle_get_64();
+
+	for (int round = 0; round < rounds; round++) {
+		for (size_t i = 0; i < count; i++) {
+			if (write) {
+				/* Changes the counters, not how well the page compresses */
+				fill_page(pages[i], i, generation);
+				continue;
+			}
+
+			fill_page(expected, i, generation);
+			if (memcmp(pages[i], expected, sizeof(expected)) != 0) {
+				printk("%s: page %zu corrupted\n", name, i);
+				return -EIO;
+			}
+		}
+	}
+
+	elapsed = k_cyc_to_ns_floor64(k_cycle_get_64() - start);
+	k_mem_paging_stats_get(&after);
+
+	printk("%-6s: %lu faults, %lu page-outs, %llu ns per page\n", name,
+	       after.pagefaults.cnt - before.pagefaults.cnt, page_outs() - outs,
+	       elapsed / (rounds * count));
+
+	return 0;
+}
+
+int main(void)
+{
+	size_t free_pages = k_mem_free_get() / CONFIG_MMU_PAGE_SIZE;
+	struct k_mem_paging_histogram_t hist;
+	size_t count, stored;
+
+	printk("Backing store benchmark: %s, %u KB, %zu free pages\n",
+	       IS_ENABLED(CONFIG_BACKING_STORE_RAM_COMPRESSED) ? "compressed" : "ram",
+	       STORE_SIZE / 1024, free_pages);
+
+	count = fill();
+	stored = count > free_pages ? count - free_pages : 0;
+	printk("capacity: %zu pages mapped, %zu pages in the backing store (%zu%% of its size)\n",
+	       count, stored, stored * CONFIG_MMU_PAGE_SIZE * 100 / STORE_SIZE);
+
+	if (count == 0 ||
+	    walk("read", count, 0, false) < 0 ||
+	    walk("write", count, 1, true) < 0 ||
+	    walk("check", count, 1, false) < 0) {
+		return 0;
+	}
+
+	k_mem_paging_histogram_backing_store_page_in_get(&hist);
+	print_histogram("page-in", &hist);
+	k_mem_paging_histogram_backing_store_page_out_get(&hist);
+	print_histogram("page-out", &hist);
+
+	for (size_t i = 0; i < count; i++) {
+		k_mem_unmap(pages[i], CONFIG_MMU_PAGE_SIZE);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
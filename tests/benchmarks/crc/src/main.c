@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * CRC throughput benchmark: run each CRC over a buffer a number of
+ * times and report the rate.
+ */
+
+#include <zephyr/bench_time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/printk.h>
+
+#define BUF_SIZE 4096
+#define ROUNDS   2048
+
+static uint8_t buf[BUF_SIZE];
+static volatile uint32_t sink;
+
+static void report(const char *name, uint64_t start_us)
+{
+	uint64_t elapsed = MAX(bench_time_us() - start_us, 1);
+	uint64_t kib = (uint64_t)BUF_SIZE * ROUNDS / 1024U;
+
+	printk("%-12s %8llu KiB/s\n", name, kib * USEC_PER_SEC / elapsed);
+}
+
+int main(void)
+{
+	uint64_t start;
+	uint32_t crc;
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i * 31U + 7U);
+	}
+
+	printk("CRC benchmark, %u byte buffer x %u rounds (%s%s)\n", BUF_SIZE, ROUNDS,
+	       IS_ENABLED(CONFIG_CRC32_SLICE_BY_8)   ? "slice-by-8"
+	       : IS_ENABLED(CONFIG_CRC32_SLICE_BY_4) ? "slice-by-4"
+						     : "nibble table",
+	       IS_ENABLED(CONFIG_CRC32_HW) ? ", hw if available" : "");
+
+	crc = 0;
+	start = bench_time_us();
+	for (int i = 0; i < ROUNDS; i++) {
+		crc = crc32_ieee_update(crc, buf, sizeof(buf));
+	}
+	sink = crc;
+	report("crc32_ieee", start);
+
+	crc = 0;
+	start = bench_time_us();
+	for (int i = 0; i < ROUNDS; i++) {
+		crc = crc32_c(crc, buf, sizeof(buf), i == 0, i == ROUNDS - 1);
+	}
+	sink = crc;
+	report("crc32_c", start);
+
+	crc = 0;
+	start = bench_time_us();
+	for (int i = 0; i < ROUNDS; i++) {
+		crc = crc16_ccitt(crc, buf, sizeof(buf));
+	}
+	sink = crc;
+	report("crc16_ccitt", start);
+
+	crc = 0;
+	start = bench_time_us();
+	for (int i = 0; i < ROUNDS; i++) {
+		crc = crc8_ccitt(crc, buf, sizeof(buf));
+	}
+	sink = crc;
+	report("crc8_ccitt", start);
+
+	printk("fin\n");
+
+	return 0;
+}
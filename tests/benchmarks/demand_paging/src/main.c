@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Demand paging benchmark.  An anonymous region EXTRA_PAGES pages larger
+ * than the free RAM is mapped and written, so that part of it is paged out,
+ * then read sequentially ROUNDS times.  Each round pages the whole region
+ * through the page frames, and the number of page faults, the pages paged
+ * in ahead of their access (CONFIG_DEMAND_PAGING_FAULT_AROUND) and the time
+ * per page are reported.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/sys/printk.h>
+
+#define EXTRA_PAGES 8
+#define ROUNDS      4
+
+static unsigned long readahead_pages(const struct k_mem_paging_stats_t *stats)
+{
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+	return stats->readahead.pages;
+#else
+	ARG_UNUSED(stats);
+
+	return 0;
+#endif
+}
+
+int main(void)
+{
+	size_t size = k_mem_free_get() + EXTRA_PAGES * CONFIG_MMU_PAGE_SIZE;
+	size_t pages = size / CONFIG_MMU_PAGE_SIZE;
+	struct k_mem_paging_stats_t before, after;
+	volatile uint32_t *word;
+	uint64_t start, elapsed;
+	uint32_t sum = 0;
+	uint8_t *region;
+
+	region = k_mem_map(size, K_MEM_PERM_RW);
+	if (region == NULL) {
+		printk("failed to map %zu bytes\n", size);
+		return 0;
+	}
+
+	printk("Demand paging benchmark: %zu pages, %u rounds, fault-around %s\n", pages, ROUNDS,
+	       IS_ENABLED(CONFIG_DEMAND_PAGING_FAULT_AROUND) ? "enabled" : "disabled");
+
+	for (size_t i = 0; i < pages; i++) {
+		word = (uint32_t *)(region + i * CONFIG_MMU_PAGE_SIZE);
+		*word = i;
+	}
+
+	k_mem_paging_stats_get(&before);
+	start = k_cycle_get_64();
+
+	for (int round = 0; round < ROUNDS; round++) {
+		for (size_t i = 0; i < pages; i++) {
+			word = (uint32_t *)(region + i * CONFIG_MMU_PAGE_SIZE);
+			sum += *word;
+		}
+	}
+
+	elapsed = k_cyc_to_ns_floor64(k_cycle_get_64() - start);
+	k_mem_paging_stats_get(&after);
+
+	if (sum != (uint32_t)(ROUNDS * (pages * (pages - 1) / 2))) {
+		printk("walk: region corrupted\n");
+		return 0;
+	}
+
+	printk("walk  : %lu faults, %lu pages ahead, %llu ns per page\n",
+	       after.pagefaults.cnt - before.pagefaults.cnt,
+	       readahead_pages(&after) - readahead_pages(&before),
+	       elapsed / (ROUNDS * pages));
+
+	k_mem_unmap(region, size);
+
+	printk("fin\n");
+
+	return 0;
+}
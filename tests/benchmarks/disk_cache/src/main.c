@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Disk cache benchmark.  A FAT file system is created on a RAM disk that
+ * counts the requests it receives, and FILES small files are created,
+ * looked up, read, appended to with a sync after each append, and deleted.
+ * The operations per second and the number of read and write requests
+ * reaching the disk driver are reported for each phase.  Run the
+ * write_through and uncached variants for comparison.
+ */
+
+#include <string.h>
+
+#include <zephyr/bench_time.h>
+#include <zephyr/drivers/disk.h>
+#include <zephyr/fs/fs.h>
+#include <ff.h>
+#include <zephyr/kernel.h>
+#include <zephyr/storage/disk_access.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#define SECTOR_SIZE   512
+#define SECTOR_COUNT  512
+#define FILES         32
+#define FILE_SIZE     1024
+#define APPENDS       8
+#define APPEND_SIZE   64
+#define STAT_ROUNDS   8
+
+#define MNT_POINT     "/RAM:"
+
+static uint8_t medium[SECTOR_COUNT * SECTOR_SIZE];
+static uint8_t data[FILE_SIZE];
+
+static struct {
+	uint32_t reads;
+	uint32_t writes;
+} io;
+
+static int ram_init(struct disk_info *disk)
+{
+	return 0;
+}
+
+static int ram_status(struct disk_info *disk)
+{
+	return DISK_STATUS_OK;
+}
+
+static int ram_read(struct disk_info *disk, uint8_t *buf, uint32_t sector, uint32_t count)
+{
+	if (sector + count > SECTOR_COUNT) {
+		return -EIO;
+	}
+
+	io.reads++;
+	memcpy(buf, &medium[sector * SECTOR_SIZE], count * SECTOR_SIZE);
+
+	return 0;
+}
+
+static int ram_write(struct disk_info *disk, const uint8_t *buf, uint32_t sector, uint32_t count)
+{
+	if (sector + count > SECTOR_COUNT) {
+		return -EIO;
+	}
+
+	io.writes++;
+	memcpy(&medium[sector * SECTOR_SIZE], buf, count * SECTOR_SIZE);
+
+	return 0;
+}
+
+static int ram_ioctl(struct disk_info *disk, uint8_t cmd, void *buf)
+{
+	switch (cmd) {
+	case DISK_IOCTL_GET_SECTOR_COUNT:
+		*(uint32_t *)buf = SECTOR_COUNT;
+		break;
+	case DISK_IOCTL_GET_SECTOR_SIZE:
+		*(uint32_t *)buf = SECTOR_SIZE;
+		break;
+	case DISK_IOCTL_GET_ERASE_BLOCK_SZ:
+		*(uint32_t *)buf = 1;
+		break;
+	case DISK_IOCTL_CTRL_SYNC:
+	case DISK_IOCTL_CTRL_INIT:
+	case DISK_IOCTL_CTRL_DEINIT:
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static const struct disk_operations ram_ops = {
+	.init = ram_init,
+	.status = ram_status,
+	.read = ram_read,
+	.write = ram_write,
+	.ioctl = ram_ioctl,
+};
+
+static struct disk_info ram_disk = {
+	.name = "RAM",
+	.ops = &ram_ops,
+};
+
+static FATFS fat_fs;
+
+static struct fs_mount_t mnt = {
+	.type = FS_FATFS,
+	.mnt_point = MNT_POINT,
+	.fs_data = &fat_fs,
+};
+
+static void file_path(char *path, size_t size, int i)
+{
+	snprintk(path, size, MNT_POINT "/F%03d.DAT", i);
+}
+
+static int do_create(int i)
+{
+	char path[32];
+	struct fs_file_t file;
+	int ret;
+
+	file_path(path, sizeof(path), i);
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, path, FS_O_CREATE | FS_O_WRITE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = fs_write(&file, data, sizeof(data));
+	fs_close(&file);
+
+	return ret == sizeof(data) ? 0 : -EIO;
+}
+
+static int do_stat(int i)
+{
+	struct fs_dirent entry;
+	char path[32];
+	int ret;
+
+	file_path(path, sizeof(path), i % FILES);
+
+	ret = fs_stat(path, &entry);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return entry.size >= sizeof(data) ? 0 : -EIO;
+}
+
+static int do_read(int i)
+{
+	static uint8_t buf[FILE_SIZE];
+	struct fs_file_t file;
+	char path[32];
+	int ret;
+
+	file_path(path, sizeof(path), i);
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, path, FS_O_READ);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = fs_read(&file, buf, sizeof(buf));
+	fs_close(&file);
+
+	return ret == sizeof(buf) && memcmp(buf, data, sizeof(buf)) == 0 ? 0 : -EIO;
+}
+
+static int do_append(int i)
+{
+	struct fs_file_t file;
+	char path[32];
+	int ret;
+
+	file_path(path, sizeof(path), i % FILES);
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, path, FS_O_WRITE | FS_O_APPEND);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = fs_write(&file, data, APPEND_SIZE);
+	if (ret == APPEND_SIZE) {
+		ret = fs_sync(&file);
+	} else {
+		ret = -EIO;
+	}
+	fs_close(&file);
+
+	return ret;
+}
+
+static int do_unlink(int i)
+{
+	char path[32];
+
+	file_path(path, sizeof(path), i);
+
+	return fs_unlink(path);
+}
+
+static int run(const char *name, int (*op)(int i), int ops)
+{
+	uint64_t start, elapsed_us;
+	int ret;
+
+	memset(&io, 0, sizeof(io));
+	start = bench_time_us();
+
+	for (int i = 0; i < ops; i++) {
+		ret = op(i);
+		if (ret < 0) {
+			printk("%s: operation %d failed (%d)\n", name, i, ret);
+			return ret;
+		}
+	}
+
+	elapsed_us = bench_time_us() - start;
+
+	printk("%-6s: %6llu ops/s, %u reads, %u writes\n", name,
+	       (uint64_t)ops * USEC_PER_SEC / MAX(elapsed_us, 1), io.reads, io.writes);
+
+	return 0;
+}
+
+int main(void)
+{
+	int ret;
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	ret = disk_access_register(&ram_disk);
+	if (ret == 0) {
+		/* The medium is blank, so the volume is formatted at mount */
+		ret = fs_mount(&mnt);
+	}
+	if (ret < 0) {
+		printk("failed to mount %s (%d)\n", MNT_POINT, ret);
+		return 0;
+	}
+
+	printk("Disk cache benchmark: %u files, cache %s\n", FILES,
+	       !IS_ENABLED(CONFIG_DISK_CACHE) ? "disabled" :
+	       IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) ? "write-back" : "write-through");
+
+	if (run("create", do_create, FILES) < 0 ||
+	    run("stat", do_stat, FILES * STAT_ROUNDS) < 0 ||
+	    run("read", do_read, FILES) < 0 ||
+	    run("append", do_append, FILES * APPENDS) < 0 ||
+	    run("unlink", do_unlink, FILES) < 0) {
+		return 0;
+	}
+
+	fs_unmount(&mnt);
+
+	printk("fin\n");
+
+	return 0;
+}
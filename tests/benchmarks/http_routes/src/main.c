@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * HTTP resource lookup benchmark.  Three services expose 10, 100 and 1000
+ * REST style resources plus one wildcard resource each, and random ones of
+ * their paths are looked up the way the server does for every request.
+ * Without CONFIG_HTTP_SERVER_RESOURCE_TRIE the lookup compares the path
+ * against every resource in turn, so its cost grows with the number of
+ * resources; with the trie it should depend on the number of path segments
+ * only.
+ */
+
+#include <zephyr/bench_time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/http/server.h>
+#include <zephyr/net/http/service.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#include "server_internal.h"
+
+#define LOOKUPS 20000
+
+static struct http_resource_detail detail = {
+	.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+	.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+};
+
+#define ROUTE_DEFINE(n, svc)                                                                      \
+	HTTP_RESOURCE_DEFINE(svc##_dev_##n, svc, "/api/v1/dev" STRINGIFY(n) "/value", &detail)
+
+#define ROUTES_DEFINE(svc, count)                                                                 \
+	static uint16_t svc##_port = 8000 + count;                                                \
+	HTTP_SERVICE_DEFINE(svc, NULL, &svc##_port, 1, 1, NULL, NULL);                            \
+	LISTIFY(count, ROUTE_DEFINE, (;), svc);                                                   \
+	HTTP_RESOURCE_DEFINE(svc##_static, svc, "/static/*", &detail)
+
+ROUTES_DEFINE(routes_10, 10);
+ROUTES_DEFINE(routes_100, 100);
+ROUTES_DEFINE(routes_1000, 1000);
+
+static const char *paths[1000 + 1];
+
+static int run(const struct http_service_desc *svc)
+{
+	struct http_resource_detail *found;
+	uint64_t start, elapsed;
+	size_t count = 0;
+	int path_len;
+
+	HTTP_SERVICE_FOREACH_RESOURCE(svc, resource) {
+		paths[count++] = resource->resource;
+	}
+
+	start = bench_time_us();
+
+	for (uint32_t i = 0; i < LOOKUPS; i++) {
+		found = get_resource_detail(svc, paths[sys_rand32_get() % count], &path_len,
+					    false);
+		if (found != &detail) {
+			printk("lookup failed\n");
+			return -ENOENT;
+		}
+	}
+
+	elapsed = bench_time_us() - start;
+
+	/* The wildcard resource is not counted */
+	printk("resources %4zu: %6llu ns/lookup\n", count - 1, elapsed * 1000U / LOOKUPS);
+
+	return 0;
+}
+
+int main(void)
+{
+	printk("HTTP resource lookup benchmark: %u lookups per run, trie %s\n", LOOKUPS,
+	       IS_ENABLED(CONFIG_HTTP_SERVER_RESOURCE_TRIE) ? "on" : "off");
+
+	if (run(&routes_10) < 0 || run(&routes_100) < 0 || run(&routes_1000) < 0) {
+		return 0;
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
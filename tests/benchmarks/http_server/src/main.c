@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * HTTP server throughput benchmark.  A number of loopback clients issue
+ * keep-alive GET requests for a small static resource while one more
+ * client keeps hitting a dynamic resource whose handler blocks for a few
+ * milliseconds, standing in for a slow backend.  With a single event loop
+ * every fast request that arrives while the slow handler runs has to wait
+ * for it; with CONFIG_HTTP_SERVER_NUM_WORKERS > 1 only the clients sharing
+ * a worker with the slow one are held up, which shows in both the request
+ * rate and the 99th percentile latency.  The stall is kernel time, so the
+ * kernel clock is used for the measurement, also on native_sim.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/http/server.h>
+#include <zephyr/net/http/service.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/printk.h>
+
+#define SERVER_IPV4_ADDR "127.0.0.1"
+#define SERVER_PORT      8080
+
+#define FAST_CLIENTS (CONFIG_HTTP_SERVER_MAX_CLIENTS - 2)
+#define REQUESTS     200
+#define SLOW_MS      5
+
+#define CLIENT_STACK_SIZE 2048
+#define CLIENT_PRIORITY   K_PRIO_PREEMPT(8)
+
+static const char static_payload[] = "Hello, World!";
+
+static const char fast_request[] = "GET / HTTP/1.1\r\n"
+				   "Host: " SERVER_IPV4_ADDR "\r\n\r\n";
+static const char slow_request[] = "GET /slow HTTP/1.1\r\n"
+				   "Host: " SERVER_IPV4_ADDR "\r\n\r\n";
+
+static uint16_t bench_service_port = SERVER_PORT;
+HTTP_SERVICE_DEFINE(bench_service, SERVER_IPV4_ADDR, &bench_service_port,
+		    CONFIG_HTTP_SERVER_MAX_CLIENTS, 10, NULL, NULL);
+
+static struct http_resource_detail_static static_detail = {
+	.common = {
+		.type = HTTP_RESOURCE_TYPE_STATIC,
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+	},
+	.static_data = static_payload,
+	.static_data_len = sizeof(static_payload) - 1,
+};
+
+HTTP_RESOURCE_DEFINE(static_resource, bench_service, "/", &static_detail);
+
+static int slow_cb(struct http_client_ctx *client, enum http_data_status status,
+		   const struct http_request_ctx *request_ctx,
+		   struct http_response_ctx *response_ctx, void *user_data)
+{
+	ARG_UNUSED(client);
+	ARG_UNUSED(request_ctx);
+	ARG_UNUSED(user_data);
+
+	if (status == HTTP_SERVER_DATA_ABORTED) {
+		return 0;
+	}
+
+	k_msleep(SLOW_MS);
+
+	response_ctx->body = (const uint8_t *)static_payload;
+	response_ctx->body_len = sizeof(static_payload) - 1;
+	response_ctx->final_chunk = true;
+
+	return 0;
+}
+
+static struct http_resource_detail_dynamic slow_detail = {
+	.common = {
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+		.content_type = "text/plain",
+	},
+	.cb = slow_cb,
+};
+
+HTTP_RESOURCE_DEFINE(slow_resource, bench_service, "/slow", &slow_detail);
+
+K_THREAD_STACK_ARRAY_DEFINE(client_stacks, FAST_CLIENTS + 1, CLIENT_STACK_SIZE);
+static struct k_thread client_threads[FAST_CLIENTS + 1];
+
+static K_SEM_DEFINE(clients_done, 0, FAST_CLIENTS);
+static uint32_t latencies_us[FAST_CLIENTS * REQUESTS];
+static bool fast_done;
+
+static int client_connect(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+	};
+	int sock;
+
+	zsock_inet_pton(AF_INET, SERVER_IPV4_ADDR, &addr.sin_addr);
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	if (zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		zsock_close(sock);
+		return -errno;
+	}
+
+	return sock;
+}
+
+/* Static responses carry a Content-Length, dynamic ones are chunked */
+static bool response_complete(const char *buf, size_t len)
+{
+	const char *body;
+	const char *clen;
+
+	body = strstr(buf, "\r\n\r\n");
+	if (body == NULL) {
+		return false;
+	}
+
+	body += 4;
+
+	clen = strstr(buf, "Content-Length: ");
+	if (clen != NULL && clen < body) {
+		return len - (body - buf) >= strtoul(clen + 16, NULL, 10);
+	}
+
+	return len >= 5 && memcmp(buf + len - 5, "0\r\n\r\n", 5) == 0;
+}
+
+static int request(int sock, const char *req, size_t req_len)
+{
+	char buf[256];
+	size_t len = 0;
+	ssize_t ret;
+
+	if (zsock_send(sock, req, req_len, 0) != req_len) {
+		return -EIO;
+	}
+
+	do {
+		ret = zsock_recv(sock, buf + len, sizeof(buf) - 1 - len, 0);
+		if (ret <= 0) {
+			return -EIO;
+		}
+
+		len += ret;
+		buf[len] = '\0';
+	} while (!response_complete(buf, len) && len < sizeof(buf) - 1);
+
+	return 0;
+}
+
+static void fast_client(void *p1, void *p2, void *p3)
+{
+	uint32_t *lat = p1;
+	uint64_t start;
+	int sock;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	sock = client_connect();
+	if (sock < 0) {
+		printk("connect failed (%d)\n", sock);
+		goto out;
+	}
+
+	for (int i = 0; i < REQUESTS; i++) {
+		start = k_cycle_get_64();
+
+		if (request(sock, fast_request, sizeof(fast_request) - 1) < 0) {
+			printk("request failed\n");
+			break;
+		}
+
+		lat[i] = (uint32_t)k_cyc_to_us_floor64(k_cycle_get_64() - start);
+	}
+
+	zsock_close(sock);
+out:
+	k_sem_give(&clients_done);
+}
+
+static void slow_client(void *p1, void *p2, void *p3)
+{
+	int sock;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	sock = client_connect();
+	if (sock < 0) {
+		printk("connect failed (%d)\n", sock);
+		return;
+	}
+
+	while (!fast_done) {
+		if (request(sock, slow_request, sizeof(slow_request) - 1) < 0) {
+			break;
+		}
+	}
+
+	zsock_close(sock);
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+int main(void)
+{
+	uint64_t start, elapsed_us;
+	size_t total = ARRAY_SIZE(latencies_us);
+
+	if (http_server_start() < 0) {
+		printk("server start failed\n");
+		return 0;
+	}
+
+	/* Let the server thread open its listening socket */
+	k_msleep(100);
+
+	/* Connect the slow client first so the fast ones are spread around it */
+	k_thread_create(&client_threads[FAST_CLIENTS], client_stacks[FAST_CLIENTS],
+			CLIENT_STACK_SIZE, slow_client, NULL, NULL, NULL,
+			CLIENT_PRIORITY, 0, K_NO_WAIT);
+	k_msleep(10);
+
+	start = k_cycle_get_64();
+
+	for (int c = 0; c < FAST_CLIENTS; c++) {
+		k_thread_create(&client_threads[c], client_stacks[c], CLIENT_STACK_SIZE,
+				fast_client, &latencies_us[c * REQUESTS], NULL, NULL,
+				CLIENT_PRIORITY, 0, K_NO_WAIT);
+	}
+
+	for (int c = 0; c < FAST_CLIENTS; c++) {
+		k_sem_take(&clients_done, K_FOREVER);
+	}
+
+	elapsed_us = k_cyc_to_us_floor64(k_cycle_get_64() - start);
+	fast_done = true;
+	k_thread_join(&client_threads[FAST_CLIENTS], K_SECONDS(1));
+
+	qsort(latencies_us, total, sizeof(latencies_us[0]), cmp_u32);
+
+	printk("workers %2d: %u req/s, p99 %6u us\n", CONFIG_HTTP_SERVER_NUM_WORKERS,
+	       (uint32_t)(total * USEC_PER_SEC / MAX(elapsed_us, 1)),
+	       latencies_us[total * 99 / 100]);
+
+	http_server_stop();
+
+	printk("fin\n");
+
+	return 0;
+}
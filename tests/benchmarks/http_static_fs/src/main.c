@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * HTTP static filesystem benchmark.  A small web UI is written to LittleFS
+ * on the flash simulator and a loopback client fetches its files over one
+ * keep-alive connection, first with plain GET requests and then with
+ * conditional ones carrying the entity tag of the previous response.
+ * Without CONFIG_HTTP_SERVER_FS_CACHE every request opens and reads the
+ * file; with the cache small files are sent from RAM and the conditional
+ * requests are answered with 304 Not Modified.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/bench_time.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/littlefs.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/http/server.h>
+#include <zephyr/net/http/service.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/printk.h>
+
+#define SERVER_IPV4_ADDR "127.0.0.1"
+#define SERVER_PORT      8080
+
+#define MNT_POINT "/lfs"
+#define WWW_DIR   MNT_POINT "/www"
+
+#define ROUNDS 200
+
+struct web_file {
+	const char *name;
+	size_t size;
+	char etag[HTTP_SERVER_ETAG_LEN];
+};
+
+static struct web_file web_ui[] = {
+	{ .name = "/index.html", .size = 1400 },
+	{ .name = "/style.css", .size = 900 },
+	{ .name = "/app.js", .size = 6000 },
+	{ .name = "/favicon.ico", .size = 318 },
+};
+
+FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(storage);
+
+static struct fs_mount_t lfs_mnt = {
+	.type = FS_LITTLEFS,
+	.fs_data = &storage,
+	.storage_dev = (void *)FIXED_PARTITION_ID(storage_partition),
+	.mnt_point = MNT_POINT,
+};
+
+static uint16_t bench_service_port = SERVER_PORT;
+HTTP_SERVICE_DEFINE(bench_service, SERVER_IPV4_ADDR, &bench_service_port, 1, 10, NULL, NULL);
+
+static struct http_resource_detail_static_fs www_detail = {
+	.common = {
+		.type = HTTP_RESOURCE_TYPE_STATIC_FS,
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+	},
+	.fs_path = WWW_DIR,
+};
+
+HTTP_RESOURCE_DEFINE(index_resource, bench_service, "/index.html", &www_detail);
+HTTP_RESOURCE_DEFINE(style_resource, bench_service, "/style.css", &www_detail);
+HTTP_RESOURCE_DEFINE(app_resource, bench_service, "/app.js", &www_detail);
+HTTP_RESOURCE_DEFINE(favicon_resource, bench_service, "/favicon.ico", &www_detail);
+
+static char response[8192];
+
+static int write_file(const struct web_file *wf)
+{
+	static const char filler[] = "<div class=\"row\"><span>zephyr</span></div>\n";
+	char path[64];
+	struct fs_file_t file;
+	size_t written = 0;
+	ssize_t len;
+	int ret;
+
+	snprintk(path, sizeof(path), "%s%s", WWW_DIR, wf->name);
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, path, FS_O_CREATE | FS_O_WRITE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	while (written < wf->size) {
+		len = fs_write(&file, filler, MIN(sizeof(filler) - 1, wf->size - written));
+		if (len <= 0) {
+			ret = len < 0 ? len : -ENOSPC;
+			break;
+		}
+
+		written += len;
+	}
+
+	fs_close(&file);
+
+	return ret;
+}
+
+static int setup_fs(void)
+{
+	const struct flash_area *fa;
+	int ret;
+
+	ret = flash_area_open(FIXED_PARTITION_ID(storage_partition), &fa);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = flash_area_flatten(fa, 0, fa->fa_size);
+	flash_area_close(fa);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = fs_mount(&lfs_mnt);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = fs_mkdir(WWW_DIR);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ARRAY_FOR_EACH_PTR(web_ui, wf) {
+		ret = write_file(wf);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int client_connect(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+	};
+	int sock;
+
+	zsock_inet_pton(AF_INET, SERVER_IPV4_ADDR, &addr.sin_addr);
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	if (zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		zsock_close(sock);
+		return -errno;
+	}
+
+	return sock;
+}
+
+/* A response is complete once its headers and Content-Length bytes are in */
+static bool response_complete(size_t len)
+{
+	const char *body;
+	const char *clen;
+
+	body = strstr(response, "\r\n\r\n");
+	if (body == NULL) {
+		return false;
+	}
+
+	body += 4;
+
+	clen = strstr(response, "Content-Length: ");
+	if (clen == NULL || clen > body) {
+		return true;
+	}
+
+	return len - (body - response) >= strtoul(clen + 16, NULL, 10);
+}
+
+/* Fetches a file and remembers its entity tag, returns the status code */
+static int request(int sock, struct web_file *wf, bool conditional)
+{
+	char req[128];
+	const char *etag;
+	size_t len = 0;
+	ssize_t ret;
+	int req_len;
+
+	if (conditional && wf->etag[0] != '\0') {
+		req_len = snprintk(req, sizeof(req),
+				   "GET %s HTTP/1.1\r\nHost: " SERVER_IPV4_ADDR "\r\n"
+				   "If-None-Match: %s\r\n\r\n",
+				   wf->name, wf->etag);
+	} else {
+		req_len = snprintk(req, sizeof(req),
+				   "GET %s HTTP/1.1\r\nHost: " SERVER_IPV4_ADDR "\r\n\r\n",
+				   wf->name);
+	}
+
+	if (zsock_send(sock, req, req_len, 0) != req_len) {
+		return -EIO;
+	}
+
+	do {
+		ret = zsock_recv(sock, response + len, sizeof(response) - 1 - len, 0);
+		if (ret <= 0) {
+			return -EIO;
+		}
+
+		len += ret;
+		response[len] = '\0';
+	} while (!response_complete(len) && len < sizeof(response) - 1);
+
+	etag = strstr(response, "ETag: ");
+	if (etag != NULL) {
+		etag += sizeof("ETag: ") - 1;
+		len = strcspn(etag, "\r");
+		if (len < sizeof(wf->etag)) {
+			memcpy(wf->etag, etag, len);
+			wf->etag[len] = '\0';
+		}
+	}
+
+	return strtol(response + sizeof("HTTP/1.1 ") - 1, NULL, 10);
+}
+
+static int run(int sock, const char *name, bool conditional)
+{
+	uint64_t start, elapsed_us;
+	uint32_t not_modified = 0;
+	int status;
+
+	start = bench_time_us();
+
+	for (int i = 0; i < ROUNDS; i++) {
+		ARRAY_FOR_EACH_PTR(web_ui, wf) {
+			status = request(sock, wf, conditional);
+			if (status == HTTP_304_NOT_MODIFIED) {
+				not_modified++;
+			} else if (status != HTTP_200_OK) {
+				printk("request for %s failed (%d)\n", wf->name, status);
+				return -EIO;
+			}
+		}
+	}
+
+	elapsed_us = bench_time_us() - start;
+
+	printk("cache %s, %s GET: %6u req/s, %u not modified\n",
+	       IS_ENABLED(CONFIG_HTTP_SERVER_FS_CACHE) ? "on" : "off", name,
+	       (uint32_t)(ROUNDS * ARRAY_SIZE(web_ui) * USEC_PER_SEC / MAX(elapsed_us, 1)),
+	       not_modified);
+
+	return 0;
+}
+
+int main(void)
+{
+	int sock;
+	int ret;
+
+	ret = setup_fs();
+	if (ret < 0) {
+		printk("filesystem setup failed (%d)\n", ret);
+		return 0;
+	}
+
+	if (http_server_start() < 0) {
+		printk("server start failed\n");
+		return 0;
+	}
+
+	/* Let the server thread open its listening socket */
+	k_msleep(100);
+
+	sock = client_connect();
+	if (sock < 0) {
+		printk("connect failed (%d)\n", sock);
+		return 0;
+	}
+
+	if (run(sock, "full", false) == 0 && run(sock, "conditional", true) == 0) {
+		printk("fin\n");
+	}
+
+	zsock_close(sock);
+	http_server_stop();
+
+	return 0;
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * JSON decoding throughput for three classes of documents: long strings
+ * (such as base64 encoded certificates or firmware chunks), pretty printed
+ * objects with indentation, and arrays of numbers.  Run the bytewise
+ * variant, which disables CONFIG_JSON_LIBRARY_BULK_SCAN, for comparison.
+ */
+
+#include <string.h>
+
+#include <zephyr/bench_time.h>
+#include <zephyr/data/json.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#define ITERATIONS  500
+#define BLOB_SIZE   4096
+#define ITEMS       32
+#define NUMBERS     256
+#define BUF_SIZE    (2 * BLOB_SIZE + 64)
+
+struct blobs {
+	const char *certificate;
+	const char *firmware;
+};
+
+struct item {
+	const char *name;
+	int value;
+	bool enabled;
+};
+
+struct items {
+	struct item items[ITEMS];
+	size_t items_len;
+};
+
+struct numbers {
+	int values[NUMBERS];
+	size_t values_len;
+};
+
+static const struct json_obj_descr blobs_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct blobs, certificate, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct blobs, firmware, JSON_TOK_STRING),
+};
+
+static const struct json_obj_descr item_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct item, name, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct item, value, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct item, enabled, JSON_TOK_TRUE),
+};
+
+static const struct json_obj_descr items_descr[] = {
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct items, items, ITEMS, items_len, item_descr,
+				 ARRAY_SIZE(item_descr)),
+};
+
+static const struct json_obj_descr numbers_descr[] = {
+	JSON_OBJ_DESCR_ARRAY(struct numbers, values, NUMBERS, values_len, JSON_TOK_NUMBER),
+};
+
+static const char base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static char payload[BUF_SIZE];
+static char work[BUF_SIZE];
+
+static union {
+	struct blobs blobs;
+	struct items items;
+	struct numbers numbers;
+} decoded;
+
+static size_t append_blob(size_t len, uint32_t seed)
+{
+	for (int i = 0; i < BLOB_SIZE; i++) {
+		seed = seed * 1103515245U + 12345U;
+		payload[len++] = base64[(seed >> 16) % (sizeof(base64) - 1)];
+	}
+
+	return len;
+}
+
+static size_t make_strings(void)
+{
+	size_t len;
+
+	len = snprintk(payload, sizeof(payload), "{\"certificate\":\"");
+	len = append_blob(len, 1);
+	len += snprintk(payload + len, sizeof(payload) - len, "\",\"firmware\":\"");
+	len = append_blob(len, 2);
+	len += snprintk(payload + len, sizeof(payload) - len, "\"}");
+
+	return len;
+}
+
+static size_t make_pretty(void)
+{
+	size_t len;
+
+	len = snprintk(payload, sizeof(payload), "{\n    \"items\": [\n");
+
+	for (int i = 0; i < ITEMS; i++) {
+		len += snprintk(payload + len, sizeof(payload) - len,
+				"        {\n"
+				"            \"name\": \"item-%d\",\n"
+				"            \"value\": %d,\n"
+				"            \"enabled\": %s\n"
+				"        }%s\n",
+				i, i * 37, i % 2 ? "true" : "false", i < ITEMS - 1 ? "," : "");
+	}
+
+	len += snprintk(payload + len, sizeof(payload) - len, "    ]\n}\n");
+
+	return len;
+}
+
+static size_t make_numbers(void)
+{
+	size_t len;
+
+	len = snprintk(payload, sizeof(payload), "{\"values\":[");
+
+	for (int i = 0; i < NUMBERS; i++) {
+		len += snprintk(payload + len, sizeof(payload) - len, "%s%d", i > 0 ? "," : "",
+				(i * 7919) % 100000 - 50000);
+	}
+
+	len += snprintk(payload + len, sizeof(payload) - len, "]}");
+
+	return len;
+}
+
+static int run(const char *name, size_t (*make)(void), const struct json_obj_descr *descr,
+	       size_t descr_len)
+{
+	uint64_t start, elapsed_us;
+	size_t len = make();
+	int64_t ret = 0;
+
+	start = bench_time_us();
+	for (int i = 0; i < ITERATIONS && ret >= 0; i++) {
+		/* Decoding terminates strings in place */
+		memcpy(work, payload, len);
+		ret = json_obj_parse(work, len, descr, descr_len, &decoded);
+	}
+	elapsed_us = bench_time_us() - start;
+
+	if (ret != BIT_MASK(descr_len)) {
+		printk("%s: decoding failed (%lld)\n", name, ret);
+		return -EINVAL;
+	}
+
+	printk("%-7s: %6llu KB/s (%zu bytes)\n", name,
+	       (uint64_t)len * ITERATIONS * USEC_PER_SEC / 1024 / MAX(elapsed_us, 1), len);
+
+	return 0;
+}
+
+int main(void)
+{
+	printk("JSON lexing benchmark: %u iterations, bulk scan %s\n", ITERATIONS,
+	       IS_ENABLED(CONFIG_JSON_LIBRARY_BULK_SCAN) ? "enabled" : "disabled");
+
+	if (run("strings", make_strings, blobs_descr, ARRAY_SIZE(blobs_descr)) < 0 ||
+	    run("pretty", make_pretty, items_descr, ARRAY_SIZE(items_descr)) < 0 ||
+	    run("numbers", make_numbers, numbers_descr, ARRAY_SIZE(numbers_descr)) < 0) {
+		return 0;
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
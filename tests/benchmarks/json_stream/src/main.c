@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * JSON benchmark.  A document of RECORDS records is encoded, then decoded
+ * ITERATIONS times with json_obj_parse(), which needs the whole document in
+ * a writable buffer, and with json_stream_parse() fed CHUNK_SIZE bytes at a
+ * time, as they would arrive from a socket.  Throughput, the buffer needed
+ * for the document and the stack used by the decoder thread are reported.
+ */
+
+#include <string.h>
+
+#include <zephyr/bench_time.h>
+#include <zephyr/data/json.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#define RECORDS     64
+#define ITERATIONS  200
+#define CHUNK_SIZE  64
+#define BUF_SIZE    16384
+#define STACK_SIZE  4096
+
+struct record {
+	char name[16];
+	int32_t id;
+	int64_t timestamp;
+	uint32_t flags;
+	bool valid;
+	int32_t values[4];
+	size_t values_len;
+};
+
+struct document {
+	char source[16];
+	struct record records[RECORDS];
+	size_t records_len;
+};
+
+static const struct json_obj_descr record_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct record, name, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct record, id, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct record, timestamp, JSON_TOK_INT64),
+	JSON_OBJ_DESCR_PRIM(struct record, flags, JSON_TOK_UINT),
+	JSON_OBJ_DESCR_PRIM(struct record, valid, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_ARRAY(struct record, values, 4, values_len, JSON_TOK_NUMBER),
+};
+
+static const struct json_obj_descr document_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct document, source, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct document, records, RECORDS, records_len, record_descr,
+				 ARRAY_SIZE(record_descr)),
+};
+
+K_THREAD_STACK_DEFINE(bench_stack, STACK_SIZE);
+static struct k_thread bench_thread;
+
+static struct document doc, decoded;
+static char payload[BUF_SIZE];
+static char work[BUF_SIZE];
+static size_t payload_len;
+
+static void fill_document(void)
+{
+	strcpy(doc.source, "bench");
+	doc.records_len = RECORDS;
+
+	for (int i = 0; i < RECORDS; i++) {
+		struct record *rec = &doc.records[i];
+
+		snprintk(rec->name, sizeof(rec->name), "sensor-%d", i);
+		rec->id = i * 7919 - 100000;
+		rec->timestamp = 1700000000000LL + i * 1000003LL;
+		rec->flags = 0xdead0000U | i;
+		rec->valid = (i % 3) != 0;
+		rec->values_len = 1 + i % 4;
+		for (int j = 0; j < rec->values_len; j++) {
+			rec->values[j] = (i + 1) * (j - 2) * 31;
+		}
+	}
+}
+
+static int64_t parse_whole(void)
+{
+	memcpy(work, payload, payload_len);
+
+	return json_obj_parse(work, payload_len, document_descr, ARRAY_SIZE(document_descr),
+			      &decoded);
+}
+
+static int64_t parse_stream(void)
+{
+	struct json_stream stream;
+	char chunk[CHUNK_SIZE];
+	int64_t ret = -EAGAIN;
+	size_t len;
+
+	json_stream_obj_init(&stream, document_descr, ARRAY_SIZE(document_descr), &decoded);
+
+	for (size_t offset = 0; offset < payload_len && ret == -EAGAIN; offset += len) {
+		len = MIN(sizeof(chunk), payload_len - offset);
+		memcpy(chunk, payload + offset, len);
+		ret = json_stream_parse(&stream, chunk, len);
+	}
+
+	return ret;
+}
+
+static void bench(void *p1, void *p2, void *p3)
+{
+	int64_t (*parse)(void) = p1;
+	int64_t *result = p2;
+
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		*result = parse();
+		if (*result < 0) {
+			return;
+		}
+	}
+}
+
+static int run(const char *name, int64_t (*parse)(void), size_t buffer)
+{
+	uint64_t start, elapsed_us;
+	size_t unused = 0;
+	int64_t result;
+
+	memset(&decoded, 0, sizeof(decoded));
+
+	start = bench_time_us();
+	k_thread_create(&bench_thread, bench_stack, K_THREAD_STACK_SIZEOF(bench_stack), bench,
+			parse, &result, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	k_thread_join(&bench_thread, K_FOREVER);
+	elapsed_us = bench_time_us() - start;
+
+	if (result != BIT_MASK(ARRAY_SIZE(document_descr)) ||
+	    memcmp(&decoded, &doc, sizeof(doc)) != 0) {
+		printk("%s: decoding failed (%lld)\n", name, result);
+		return -EINVAL;
+	}
+
+	k_thread_stack_space_get(&bench_thread, &unused);
+
+	printk("%-6s: %6llu KB/s, buffer %5zu B, stack %4zu B\n", name,
+	       (uint64_t)payload_len * ITERATIONS * USEC_PER_SEC / 1024 / MAX(elapsed_us, 1),
+	       buffer, K_THREAD_STACK_SIZEOF(bench_stack) - unused);
+
+	return 0;
+}
+
+static int run_encode(void)
+{
+	uint64_t start, elapsed_us;
+	int ret = 0;
+
+	start = bench_time_us();
+	for (int i = 0; i < ITERATIONS && ret == 0; i++) {
+		ret = json_obj_encode_buf(document_descr, ARRAY_SIZE(document_descr), &doc, payload,
+					  sizeof(payload));
+	}
+	elapsed_us = bench_time_us() - start;
+
+	if (ret < 0) {
+		printk("encode: failed (%d)\n", ret);
+		return ret;
+	}
+
+	payload_len = strlen(payload);
+	printk("encode: %6llu KB/s\n",
+	       (uint64_t)payload_len * ITERATIONS * USEC_PER_SEC / 1024 / MAX(elapsed_us, 1));
+
+	return 0;
+}
+
+int main(void)
+{
+	fill_document();
+
+	if (run_encode() < 0) {
+		return 0;
+	}
+
+	printk("JSON benchmark: %u records, %zu bytes, %u iterations, %u byte chunks\n", RECORDS,
+	       payload_len, ITERATIONS, CHUNK_SIZE);
+
+	if (run("parse", parse_whole, payload_len) < 0 ||
+	    run("stream", parse_stream, sizeof(struct json_stream) + CHUNK_SIZE) < 0) {
+		return 0;
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BENCH_SYMS_H_
+#define BENCH_SYMS_H_
+
+#include <zephyr/sys/util.h>
+
+/* Number of bench_sym_<n>() functions exported by the application */
+#define BENCH_SYMS 256
+
+#define BENCH_SYM_DECLARE(n, _) int bench_sym_##n(void)
+#define BENCH_SYM_CALL(n, _)    bench_sym_##n()
+
+LISTIFY(BENCH_SYMS, BENCH_SYM_DECLARE, (;));
+
+/* Each bench_sym_<n>() returns n */
+#define BENCH_SYMS_SUM(count) ((count) * ((count) - 1) / 2)
+
+#endif /* BENCH_SYMS_H_ */
@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Calls the first 16 symbols exported by the application once each. */
+
+#include <zephyr/llext/symbol.h>
+
+#include "bench_syms.h"
+
+int test_entry(void)
+{
+	return LISTIFY(16, BENCH_SYM_CALL, (+));
+}
+EXPORT_SYMBOL(test_entry);
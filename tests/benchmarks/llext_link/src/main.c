@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Extension linking benchmark.  The application exports BENCH_SYMS
+ * functions, and extensions calling 16 or all of them once, or all of them
+ * four times, are loaded and unloaded ITERATIONS times.  The time per load
+ * is dominated by the resolution of each relocation against the built-in
+ * symbol table.  Lookups by name in the built-in table are also timed.
+ * Run the linear variant, which disables CONFIG_LLEXT_SYMBOL_INDEX, for
+ * comparison.
+ */
+
+#include <zephyr/bench_time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/llext/buf_loader.h>
+#include <zephyr/llext/llext.h>
+#include <zephyr/llext/symbol.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#include "bench_syms.h"
+
+#define ITERATIONS 20
+#define LOOKUPS    16
+
+#define ELF_ALIGN __aligned(4096)
+
+#define BENCH_SYM_DEFINE(n, _)		\
+	int bench_sym_##n(void)		\
+	{				\
+		return n;		\
+	}				\
+	EXPORT_SYMBOL(bench_sym_##n)
+
+LISTIFY(BENCH_SYMS, BENCH_SYM_DEFINE, (;));
+
+static const uint8_t imports_16_ext[] ELF_ALIGN = {
+	#include "imports_16.inc"
+};
+
+static const uint8_t imports_256_ext[] ELF_ALIGN = {
+	#include "imports_256.inc"
+};
+
+static const uint8_t repeated_256_ext[] ELF_ALIGN = {
+	#include "repeated_256.inc"
+};
+
+#ifndef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+static void lookup_builtins(void)
+{
+	static char names[BENCH_SYMS][sizeof("bench_sym_000")];
+	uint64_t start, elapsed_us;
+
+	for (int i = 0; i < BENCH_SYMS; i++) {
+		snprintk(names[i], sizeof(names[i]), "bench_sym_%d", i);
+	}
+
+	start = bench_time_us();
+	for (int i = 0; i < LOOKUPS; i++) {
+		for (int j = 0; j < BENCH_SYMS; j++) {
+			if (llext_find_sym(NULL, names[j]) == NULL) {
+				printk("builtin: %s not found\n", names[j]);
+				return;
+			}
+		}
+	}
+	elapsed_us = bench_time_us() - start;
+
+	printk("%-12s: %u symbols, %llu ns per lookup\n", "builtin", BENCH_SYMS,
+	       elapsed_us * NSEC_PER_USEC / (LOOKUPS * BENCH_SYMS));
+}
+#endif
+
+static int run(const char *name, const uint8_t *buf, size_t len, int relocations, int expected)
+{
+	struct llext_load_param ldr_parm = LLEXT_LOAD_PARAM_DEFAULT;
+	uint64_t start, elapsed_us = 0;
+	int (*test_entry)(void);
+	struct llext *ext;
+	int ret;
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		struct llext_buf_loader buf_loader = LLEXT_BUF_LOADER(buf, len);
+
+		ext = NULL;
+		start = bench_time_us();
+		ret = llext_load(&buf_loader.loader, name, &ext, &ldr_parm);
+		elapsed_us += bench_time_us() - start;
+
+		if (ret != 0) {
+			printk("%s: load failed (%d)\n", name, ret);
+			return ret;
+		}
+
+		test_entry = llext_find_sym(&ext->exp_tab, "test_entry");
+		ret = test_entry == NULL ? -ENOENT : test_entry();
+		llext_unload(&ext);
+
+		if (ret != expected) {
+			printk("%s: test_entry returned %d instead of %d\n", name, ret, expected);
+			return -EINVAL;
+		}
+	}
+
+	printk("%-12s: %d relocations, %llu us per load\n", name, relocations,
+	       elapsed_us / ITERATIONS);
+
+	return 0;
+}
+
+int main(void)
+{
+	printk("llext link benchmark: %u symbols, %u iterations, symbol index %s\n",
+	       BENCH_SYMS, ITERATIONS,
+	       IS_ENABLED(CONFIG_LLEXT_SYMBOL_INDEX) ? "enabled" : "disabled");
+
+#ifndef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+	lookup_builtins();
+#endif
+
+	if (run("imports_16", imports_16_ext, sizeof(imports_16_ext), 16,
+		BENCH_SYMS_SUM(16)) < 0 ||
+	    run("imports_256", imports_256_ext, sizeof(imports_256_ext), BENCH_SYMS,
+		BENCH_SYMS_SUM(BENCH_SYMS)) < 0 ||
+	    run("repeated_256", repeated_256_ext, sizeof(repeated_256_ext), 4 * BENCH_SYMS,
+		BENCH_SYMS_SUM(BENCH_SYMS)) < 0) {
+		return 0;
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
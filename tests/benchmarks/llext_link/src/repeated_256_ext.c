@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Calls all symbols exported by the application from four functions, so
+ * each symbol is the target of four relocations.
+ */
+
+#include <zephyr/llext/symbol.h>
+
+#include "bench_syms.h"
+
+static int part_0(void)
+{
+	return LISTIFY(BENCH_SYMS, BENCH_SYM_CALL, (+));
+}
+
+static int part_1(void)
+{
+	return LISTIFY(BENCH_SYMS, BENCH_SYM_CALL, (+));
+}
+
+static int part_2(void)
+{
+	return LISTIFY(BENCH_SYMS, BENCH_SYM_CALL, (+));
+}
+
+static int part_3(void)
+{
+	return LISTIFY(BENCH_SYMS, BENCH_SYM_CALL, (+));
+}
+
+int test_entry(void)
+{
+	return (part_0() + part_1() + part_2() + part_3()) / 4;
+}
+EXPORT_SYMBOL(test_entry);
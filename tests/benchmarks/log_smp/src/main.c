@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * SMP deferred logging benchmark.
+ *
+ * Each worker thread logs a message with two arguments in a tight loop
+ * and measures how many cycles every call takes.  The number of workers
+ * is stepped from one up to the number of CPUs.  A counting backend
+ * reports how many messages made it to the backend and how many were
+ * dropped because the buffer was full, so the cost of contention on the
+ * log buffer shows up both as call latency and as drop rate.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+
+#if CONFIG_MP_MAX_NUM_CPUS == 1
+#error "Test requires a system with more than 1 CPU"
+#endif
+
+LOG_MODULE_REGISTER(bench, LOG_LEVEL_INF);
+
+#define INTERVAL_MS 5000
+
+#define MAX_WORKERS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO K_PRIO_PREEMPT(1)
+
+struct worker_stats {
+	uint64_t cycles;
+	uint32_t max_cycles;
+	uint32_t calls;
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_WORKERS, STACK_SIZE);
+static struct k_thread threads[MAX_WORKERS];
+static struct worker_stats stats[MAX_WORKERS];
+static volatile bool stop;
+
+static uint32_t processed;
+static uint32_t dropped;
+
+static void process(const struct log_backend *const backend,
+		    union log_msg_generic *msg)
+{
+	processed++;
+}
+
+static void drop(const struct log_backend *const backend, uint32_t cnt)
+{
+	dropped += cnt;
+}
+
+static const struct log_backend_api counting_backend_api = {
+	.process = process,
+	.dropped = drop,
+};
+
+LOG_BACKEND_DEFINE(counting_backend, counting_backend_api, true);
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	struct worker_stats *st = p1;
+	uint32_t id = POINTER_TO_UINT(p2);
+
+	ARG_UNUSED(p3);
+
+	while (!stop) {
+		uint32_t start = k_cycle_get_32();
+		uint32_t cycles;
+
+		LOG_INF("worker %u message %u", id, st->calls);
+
+		cycles = k_cycle_get_32() - start;
+		st->cycles += cycles;
+		st->max_cycles = MAX(st->max_cycles, cycles);
+		st->calls++;
+	}
+}
+
+static void run(unsigned int num_workers)
+{
+	uint64_t cycles = 0;
+	uint32_t max_cycles = 0;
+	uint32_t calls = 0;
+	uint32_t total;
+
+	stop = false;
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		stats[i] = (struct worker_stats){0};
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				worker, &stats[i], UINT_TO_POINTER(i), NULL,
+				WORKER_PRIO, 0, K_NO_WAIT);
+	}
+
+	k_msleep(INTERVAL_MS);
+	stop = true;
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		cycles += stats[i].cycles;
+		max_cycles = MAX(max_cycles, stats[i].max_cycles);
+		calls += stats[i].calls;
+	}
+
+	/* Let the processing thread drain what is still buffered */
+	while (log_buffered_cnt() > 0) {
+		k_msleep(10);
+	}
+	k_msleep(10);
+
+	total = processed + dropped;
+
+	printk("threads %u: %llu cycles/call (max %u), %u calls, "
+	       "%u processed, %u dropped (%u.%u%%)\n",
+	       num_workers, cycles / MAX(calls, 1U), max_cycles, calls,
+	       processed, dropped,
+	       (uint32_t)((uint64_t)dropped * 100U / MAX(total, 1U)),
+	       (uint32_t)((uint64_t)dropped * 1000U / MAX(total, 1U) % 10U));
+
+	processed = 0;
+	dropped = 0;
+}
+
+int main(void)
+{
+	printk("SMP logging benchmark, %u CPUs, %s\n", arch_num_cpus(),
+	       IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS) ?
+	       "per-CPU buffers" : "shared buffer");
+
+	for (unsigned int n = 1; n <= arch_num_cpus(); n++) {
+		run(n);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * SMP memory slab throughput benchmark.
+ *
+ * Each worker thread repeatedly allocates a short burst of blocks from
+ * a single shared slab and frees them again.  The number of workers is
+ * stepped from one up to the number of CPUs, so that every worker can
+ * keep a CPU busy, and the aggregate rate of alloc/free pairs is
+ * reported.  With a
+ * scalable allocator the rate should grow with the number of workers.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#if CONFIG_MP_MAX_NUM_CPUS == 1
+#error "Test requires a system with more than 1 CPU"
+#endif
+
+#define INTERVAL_MS 5000
+
+#define MAX_WORKERS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO K_PRIO_PREEMPT(1)
+
+#define BURST      4
+#define BLOCK_SIZE 64
+#define NUM_BLOCKS (MAX_WORKERS * BURST * 4)
+
+K_MEM_SLAB_DEFINE_STATIC(slab, BLOCK_SIZE, NUM_BLOCKS, sizeof(void *));
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_WORKERS, STACK_SIZE);
+static struct k_thread threads[MAX_WORKERS];
+static unsigned long ops[MAX_WORKERS];
+static volatile bool stop;
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	unsigned long *count = p1;
+	void *blocks[BURST];
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!stop) {
+		for (int i = 0; i < BURST; i++) {
+			if (k_mem_slab_alloc(&slab, &blocks[i], K_NO_WAIT) != 0) {
+				printk("alloc failed\n");
+				k_oops();
+			}
+		}
+		for (int i = 0; i < BURST; i++) {
+			k_mem_slab_free(&slab, blocks[i]);
+		}
+		*count += BURST;
+	}
+}
+
+static void run(unsigned int num_workers)
+{
+	unsigned long total = 0;
+	int64_t start;
+	int64_t elapsed;
+
+	stop = false;
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		ops[i] = 0;
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				worker, &ops[i], NULL, NULL,
+				WORKER_PRIO, 0, K_NO_WAIT);
+	}
+
+	start = k_uptime_get();
+	k_msleep(INTERVAL_MS);
+
+	stop = true;
+	elapsed = k_uptime_get() - start;
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		total += ops[i];
+	}
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	printk("threads %u: %llu ops/s (%lu alloc/free pairs in %lld ms)\n",
+	       num_workers, (uint64_t)total * 1000U / (uint64_t)elapsed, total,
+	       elapsed);
+}
+
+int main(void)
+{
+	printk("SMP memory slab benchmark, %u CPUs, %s\n", arch_num_cpus(),
+	       IS_ENABLED(CONFIG_MEM_SLAB_PER_CPU_CACHE) ?
+	       "per-CPU cache" : "shared free list");
+
+	for (unsigned int n = 1; n <= arch_num_cpus(); n++) {
+		run(n);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
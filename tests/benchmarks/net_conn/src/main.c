@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Connection demultiplexing benchmark.  Registers a growing number of
+ * UDP handlers, each bound to its own port, and feeds packets for
+ * random ones of them through a dummy interface.  Received packets are
+ * processed in the sender's context (CONFIG_NET_TC_RX_COUNT=0), so
+ * the time per packet covers building it and the whole input path up
+ * to the handler.  With the linear handler list that time grows with the
+ * number of handlers; with CONFIG_NET_CONN_HASH it should stay flat.
+ */
+
+#include <zephyr/bench_time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/printk.h>
+
+#include "ipv4.h"
+#include "udp_internal.h"
+
+#define BASE_PORT 1000
+#define PACKETS   20000
+
+static const uint16_t conn_counts[] = {8, 64, 256};
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 9 } } };
+
+static struct net_conn_handle *handles[CONFIG_NET_MAX_CONN];
+static uint32_t received;
+
+static int bench_dev_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return 0;
+}
+
+static void bench_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static int bench_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static struct dummy_api bench_if_api = {
+	.iface_api.init = bench_iface_init,
+	.send = bench_send,
+};
+
+NET_DEVICE_INIT(net_conn_bench, "net_conn_bench", bench_dev_init, NULL,
+		NULL, NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+		&bench_if_api, DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+static enum net_verdict bench_recv(struct net_conn *conn, struct net_pkt *pkt,
+				   union net_ip_header *ip_hdr,
+				   union net_proto_header *proto_hdr,
+				   void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+	ARG_UNUSED(user_data);
+
+	received++;
+	net_pkt_unref(pkt);
+
+	return NET_OK;
+}
+
+static struct net_pkt *make_pkt(struct net_if *iface, uint16_t dst_port)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(iface, 0, AF_INET, IPPROTO_UDP,
+					K_SECONDS(1));
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	if (net_ipv4_create(pkt, &peer_addr, &my_addr) ||
+	    net_udp_create(pkt, htons(5000), htons(dst_port))) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_ipv4_finalize(pkt, IPPROTO_UDP);
+
+	return pkt;
+}
+
+static int run(struct net_if *iface, uint16_t count)
+{
+	struct sockaddr_in local = {
+		.sin_family = AF_INET,
+		.sin_addr = my_addr,
+	};
+	uint64_t start, elapsed;
+	int ret = 0;
+
+	for (uint16_t i = 0; i < count; i++) {
+		local.sin_port = htons(BASE_PORT + i);
+
+		ret = net_udp_register(AF_INET, NULL, (struct sockaddr *)&local,
+				       0, BASE_PORT + i, NULL, bench_recv, NULL,
+				       &handles[i]);
+		if (ret < 0) {
+			printk("net_udp_register failed: %d\n", ret);
+			count = i;
+			goto out;
+		}
+	}
+
+	received = 0;
+	start = bench_time_us();
+
+	for (uint32_t i = 0; i < PACKETS; i++) {
+		struct net_pkt *pkt;
+
+		pkt = make_pkt(iface, BASE_PORT + sys_rand32_get() % count);
+		if (pkt == NULL) {
+			printk("cannot create packet\n");
+			ret = -ENOMEM;
+			goto out;
+		}
+
+		ret = net_recv_data(iface, pkt);
+		if (ret < 0) {
+			printk("net_recv_data failed: %d\n", ret);
+			net_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
+	elapsed = bench_time_us() - start;
+
+	if (received != PACKETS) {
+		printk("%u of %u packets delivered\n", received, PACKETS);
+		ret = -EIO;
+		goto out;
+	}
+
+	printk("conns %3u: %6llu ns/pkt\n", count, elapsed * 1000U / PACKETS);
+
+out:
+	for (uint16_t i = 0; i < count; i++) {
+		net_udp_unregister(handles[i]);
+	}
+
+	return ret;
+}
+
+int main(void)
+{
+	struct net_if *iface;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	if (iface == NULL) {
+		printk("no dummy interface\n");
+		return 0;
+	}
+
+	if (net_if_ipv4_addr_add(iface, &my_addr, NET_ADDR_MANUAL, 0) == NULL) {
+		printk("cannot add address\n");
+		return 0;
+	}
+
+	printk("UDP demultiplexing benchmark: %u packets per run\n", PACKETS);
+
+	for (size_t i = 0; i < ARRAY_SIZE(conn_counts); i++) {
+		if (run(iface, conn_counts[i]) < 0) {
+			return 0;
+		}
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
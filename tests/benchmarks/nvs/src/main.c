@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * NVS read benchmark.  Fills a file system with a growing number of
+ * IDs and then reads every one of them back in a scrambled order,
+ * reporting the number of flash reads and the time spent per
+ * nvs_read().  The mount time is reported too, since that is where
+ * the lookup cache and the lookup index are built.  The flash read
+ * count comes from the flash simulator statistics.
+ */
+
+#include <zephyr/bench_time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/fs/nvs.h>
+#include <zephyr/stats/stats.h>
+#include <zephyr/sys/printk.h>
+#include <string.h>
+
+#define BENCH_PARTITION        slot1_partition
+#define BENCH_PARTITION_OFFSET FIXED_PARTITION_OFFSET(BENCH_PARTITION)
+#define BENCH_PARTITION_DEVICE FIXED_PARTITION_DEVICE(BENCH_PARTITION)
+#define BENCH_SECTOR_COUNT     16
+
+static const uint16_t id_counts[] = {100, 500, 2000};
+
+static struct nvs_fs fs;
+static struct stats_hdr *sim_stats;
+
+static int read_calls_cb(struct stats_hdr *hdr, void *arg, const char *name, uint16_t off)
+{
+	if (strcmp(name, "flash_read_calls") == 0) {
+		*(uint32_t *)arg = *(uint32_t *)((uint8_t *)hdr + off);
+		return 1;
+	}
+
+	return 0;
+}
+
+static uint32_t flash_read_calls(void)
+{
+	uint32_t calls = 0;
+
+	stats_walk(sim_stats, read_calls_cb, &calls);
+
+	return calls;
+}
+
+/* Visit every ID in [0, count) exactly once, in a scrambled order */
+static uint16_t scramble(uint32_t i, uint16_t count)
+{
+	return (uint16_t)((i * 7919U + 13U) % count);
+}
+
+static int run(uint16_t count)
+{
+	uint32_t reads, value;
+	uint64_t start, mount_us, read_us;
+	int rc;
+
+	rc = nvs_mount(&fs);
+	if (rc == 0) {
+		rc = nvs_clear(&fs);
+	}
+	if (rc != 0) {
+		printk("nvs reset failed: %d\n", rc);
+		return rc;
+	}
+
+	rc = nvs_mount(&fs);
+	if (rc != 0) {
+		printk("nvs_mount failed: %d\n", rc);
+		return rc;
+	}
+
+	for (uint16_t id = 0; id < count; id++) {
+		value = id;
+		rc = nvs_write(&fs, id, &value, sizeof(value));
+		if (rc < 0) {
+			printk("nvs_write(%u) failed: %d\n", id, rc);
+			return rc;
+		}
+	}
+
+	reads = flash_read_calls();
+	start = bench_time_us();
+	rc = nvs_mount(&fs);
+	mount_us = bench_time_us() - start;
+	if (rc != 0) {
+		printk("nvs_mount failed: %d\n", rc);
+		return rc;
+	}
+	printk("ids %5u: mount %6u reads %8llu us\n", count,
+	       flash_read_calls() - reads, mount_us);
+
+	reads = flash_read_calls();
+	start = bench_time_us();
+	for (uint32_t i = 0; i < count; i++) {
+		uint16_t id = scramble(i, count);
+
+		rc = nvs_read(&fs, id, &value, sizeof(value));
+		if (rc != sizeof(value) || value != id) {
+			printk("nvs_read(%u) failed: %d\n", id, rc);
+			return -EIO;
+		}
+	}
+	read_us = bench_time_us() - start;
+	reads = flash_read_calls() - reads;
+
+	printk("ids %5u: read  %6u.%02u reads/op %6llu.%02llu us/op\n", count,
+	       reads / count, (reads % count) * 100U / count,
+	       read_us / count, (read_us % count) * 100U / count);
+
+	return 0;
+}
+
+int main(void)
+{
+	struct flash_pages_info info;
+	int rc;
+
+	fs.flash_device = BENCH_PARTITION_DEVICE;
+	fs.offset = BENCH_PARTITION_OFFSET;
+	if (!device_is_ready(fs.flash_device)) {
+		printk("flash device not ready\n");
+		return 0;
+	}
+
+	rc = flash_get_page_info_by_offs(fs.flash_device, fs.offset, &info);
+	if (rc != 0) {
+		printk("flash_get_page_info_by_offs failed: %d\n", rc);
+		return 0;
+	}
+	fs.sector_size = info.size;
+	fs.sector_count = BENCH_SECTOR_COUNT;
+
+	sim_stats = stats_group_find("flash_sim_stats");
+	if (sim_stats == NULL) {
+		printk("flash simulator statistics not found\n");
+		return 0;
+	}
+
+	printk("NVS read benchmark: %u sectors of %u bytes\n", fs.sector_count,
+	       fs.sector_size);
+
+	for (size_t i = 0; i < ARRAY_SIZE(id_counts); i++) {
+		if (run(id_counts[i]) != 0) {
+			return 0;
+		}
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Echo server benchmark over loopback TCP.  CLIENTS client threads each
+ * send MESSAGES messages and wait for their echo, first against a server
+ * with one blocking thread per connection, then against a server that
+ * accepts and echoes all connections from a single thread through RTIO
+ * socket operations (multishot accept, multishot receive into mempool
+ * blocks and sends straight from these blocks).  Throughput and round trip
+ * latency are reported for both.
+ */
+
+#include <string.h>
+
+#include <zephyr/bench_time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/socket.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#define CLIENTS      4
+#define MESSAGES     1000
+#define MSG_SIZE     64
+#define BLOCK_SIZE   128
+#define STACK_SIZE   2048
+#define THREAD_PORT  5000
+#define RTIO_PORT    5001
+
+struct client_stats {
+	uint64_t total_us;
+	uint32_t max_us;
+	int err;
+};
+
+struct echo_conn {
+	struct rtio_iodev iodev;
+	struct rtio_sock sock;
+	int fd;
+};
+
+K_THREAD_STACK_ARRAY_DEFINE(client_stacks, CLIENTS, STACK_SIZE);
+K_THREAD_STACK_ARRAY_DEFINE(server_stacks, CLIENTS, STACK_SIZE);
+static struct k_thread client_threads[CLIENTS];
+static struct k_thread server_threads[CLIENTS];
+static struct client_stats stats[CLIENTS];
+
+/* Each connection has a receive pending and at most one block being sent */
+RTIO_DEFINE_WITH_MEMPOOL(r_echo, 2 * CLIENTS + 2, 2 * CLIENTS + 2, 2 * CLIENTS + 2, BLOCK_SIZE,
+			 4);
+RTIO_SOCK_IODEV_DEFINE(listen_iodev);
+static struct echo_conn conns[CLIENTS];
+
+static void loopback_addr(struct sockaddr_in *addr, uint16_t port)
+{
+	*addr = (struct sockaddr_in){
+		.sin_family = AF_INET,
+		.sin_port = htons(port),
+	};
+	zsock_inet_pton(AF_INET, "127.0.0.1", &addr->sin_addr);
+}
+
+static int listen_on(uint16_t port)
+{
+	struct sockaddr_in addr;
+	int fd;
+
+	loopback_addr(&addr, port);
+
+	fd = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (fd < 0) {
+		return -errno;
+	}
+
+	if (zsock_bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+	    zsock_listen(fd, CLIENTS) < 0) {
+		zsock_close(fd);
+		return -errno;
+	}
+
+	return fd;
+}
+
+static void client(void *p1, void *p2, void *p3)
+{
+	struct client_stats *s = p1;
+	uint16_t port = POINTER_TO_UINT(p2);
+	uint8_t msg[MSG_SIZE], echo[MSG_SIZE];
+	struct sockaddr_in addr;
+	uint64_t start;
+	uint32_t rtt;
+	size_t got;
+	ssize_t ret;
+	int fd;
+
+	ARG_UNUSED(p3);
+
+	*s = (struct client_stats){0};
+	memset(msg, 'a' + (s - stats), sizeof(msg));
+	loopback_addr(&addr, port);
+
+	fd = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (fd < 0 || zsock_connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		s->err = -errno;
+		goto out;
+	}
+
+	for (int i = 0; i < MESSAGES; i++) {
+		start = bench_time_us();
+
+		if (zsock_send(fd, msg, sizeof(msg), 0) != sizeof(msg)) {
+			s->err = -EIO;
+			goto out;
+		}
+
+		for (got = 0; got < sizeof(echo); got += ret) {
+			ret = zsock_recv(fd, echo + got, sizeof(echo) - got, 0);
+			if (ret <= 0) {
+				s->err = -EIO;
+				goto out;
+			}
+		}
+
+		if (memcmp(msg, echo, sizeof(msg)) != 0) {
+			s->err = -EBADMSG;
+			goto out;
+		}
+
+		rtt = bench_time_us() - start;
+		s->total_us += rtt;
+		s->max_us = MAX(s->max_us, rtt);
+	}
+
+out:
+	if (fd >= 0) {
+		zsock_close(fd);
+	}
+}
+
+static void start_clients(uint16_t port)
+{
+	for (int i = 0; i < CLIENTS; i++) {
+		k_thread_create(&client_threads[i], client_stacks[i], STACK_SIZE, client, &stats[i],
+				UINT_TO_POINTER(port), NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+}
+
+static int report(const char *name, uint64_t start)
+{
+	uint64_t elapsed_us, total_us = 0;
+	uint32_t max_us = 0;
+
+	for (int i = 0; i < CLIENTS; i++) {
+		k_thread_join(&client_threads[i], K_FOREVER);
+
+		if (stats[i].err < 0) {
+			printk("%s: client %d failed (%d)\n", name, i, stats[i].err);
+			return stats[i].err;
+		}
+
+		total_us += stats[i].total_us;
+		max_us = MAX(max_us, stats[i].max_us);
+	}
+
+	elapsed_us = bench_time_us() - start;
+	printk("%-6s: %6llu msgs/s, latency avg %5u us, max %5u us\n", name,
+	       (uint64_t)CLIENTS * MESSAGES * USEC_PER_SEC / MAX(elapsed_us, 1),
+	       (uint32_t)(total_us / (CLIENTS * MESSAGES)), max_us);
+
+	return 0;
+}
+
+static void server(void *p1, void *p2, void *p3)
+{
+	int fd = POINTER_TO_INT(p1);
+	uint8_t buf[BLOCK_SIZE];
+	ssize_t len;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while ((len = zsock_recv(fd, buf, sizeof(buf), 0)) > 0) {
+		if (zsock_send(fd, buf, len, 0) != len) {
+			break;
+		}
+	}
+
+	zsock_close(fd);
+}
+
+static int run_threads(void)
+{
+	uint64_t start;
+	int listen_fd, fd;
+	int ret;
+
+	listen_fd = listen_on(THREAD_PORT);
+	if (listen_fd < 0) {
+		return listen_fd;
+	}
+
+	start = bench_time_us();
+	start_clients(THREAD_PORT);
+
+	for (int i = 0; i < CLIENTS; i++) {
+		fd = zsock_accept(listen_fd, NULL, NULL);
+		if (fd < 0) {
+			zsock_close(listen_fd);
+			return -errno;
+		}
+
+		k_thread_create(&server_threads[i], server_stacks[i], STACK_SIZE, server,
+				INT_TO_POINTER(fd), NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	ret = report("thread", start);
+	for (int i = 0; i < CLIENTS; i++) {
+		k_thread_join(&server_threads[i], K_FOREVER);
+	}
+
+	zsock_close(listen_fd);
+
+	return ret;
+}
+
+static int submit_one(void (*prep)(struct rtio_sqe *sqe, void *arg), void *arg)
+{
+	struct rtio_sqe *sqe = rtio_sqe_acquire(&r_echo);
+
+	if (sqe == NULL) {
+		return -ENOMEM;
+	}
+
+	prep(sqe, arg);
+
+	return rtio_submit(&r_echo, 0);
+}
+
+static void prep_accept(struct rtio_sqe *sqe, void *arg)
+{
+	rtio_sqe_prep_accept(sqe, &listen_iodev, RTIO_PRIO_NORM, NULL);
+	sqe->flags |= RTIO_SQE_MULTISHOT;
+}
+
+static void prep_recv(struct rtio_sqe *sqe, void *arg)
+{
+	struct echo_conn *conn = arg;
+
+	rtio_sqe_prep_read_multishot(sqe, &conn->iodev, RTIO_PRIO_NORM, conn);
+}
+
+static int rtio_accepted(int fd, int *accepted)
+{
+	struct echo_conn *conn;
+
+	if (fd < 0 || *accepted == CLIENTS) {
+		return fd < 0 ? fd : -ENOSPC;
+	}
+
+	conn = &conns[(*accepted)++];
+	conn->fd = fd;
+	rtio_sock_iodev_init(&conn->iodev, &conn->sock);
+	if (rtio_sock_attach(&conn->iodev, fd) < 0) {
+		return -EIO;
+	}
+
+	return submit_one(prep_recv, conn);
+}
+
+/* Send the received block back, it is released once sent */
+static int rtio_received(struct echo_conn *conn, struct rtio_cqe *cqe, int *closed)
+{
+	struct rtio_sqe *sqe;
+	uint8_t *buf;
+	uint32_t buf_len;
+
+	if (rtio_cqe_get_mempool_buffer(&r_echo, cqe, &buf, &buf_len) < 0) {
+		return -EIO;
+	}
+
+	if (cqe->result <= 0) {
+		rtio_release_buffer(&r_echo, buf, buf_len);
+		rtio_sock_detach(&conn->iodev);
+		zsock_close(conn->fd);
+		(*closed)++;
+		return 0;
+	}
+
+	sqe = rtio_sqe_acquire(&r_echo);
+	if (sqe == NULL) {
+		rtio_release_buffer(&r_echo, buf, buf_len);
+		return -ENOMEM;
+	}
+
+	rtio_sqe_prep_write(sqe, &conn->iodev, RTIO_PRIO_NORM, buf, cqe->result, buf);
+
+	return rtio_submit(&r_echo, 0);
+}
+
+static int run_rtio(void)
+{
+	int accepted = 0, closed = 0;
+	struct rtio_cqe *cqe;
+	uint64_t start;
+	int listen_fd;
+	int ret;
+
+	listen_fd = listen_on(RTIO_PORT);
+	if (listen_fd < 0) {
+		return listen_fd;
+	}
+
+	ret = rtio_sock_attach(&listen_iodev, listen_fd);
+	if (ret == 0) {
+		ret = submit_one(prep_accept, NULL);
+	}
+
+	start = bench_time_us();
+	start_clients(RTIO_PORT);
+
+	while (ret == 0 && closed < CLIENTS) {
+		cqe = rtio_cqe_consume_block(&r_echo);
+
+		if (cqe->userdata == NULL) {
+			ret = rtio_accepted(cqe->result, &accepted);
+		} else if (PART_OF_ARRAY(conns, (struct echo_conn *)cqe->userdata)) {
+			ret = rtio_received(cqe->userdata, cqe, &closed);
+		} else {
+			/* A send completed, userdata is its block */
+			rtio_release_buffer(&r_echo, cqe->userdata, BLOCK_SIZE);
+			ret = cqe->result < 0 ? cqe->result : 0;
+		}
+
+		rtio_cqe_release(&r_echo, cqe);
+	}
+
+	if (ret == 0) {
+		ret = report("rtio", start);
+	} else {
+		printk("rtio: server failed (%d)\n", ret);
+	}
+
+	rtio_sock_detach(&listen_iodev);
+	zsock_close(listen_fd);
+
+	return ret;
+}
+
+int main(void)
+{
+	printk("Echo benchmark: %u clients, %u messages of %u bytes each\n", CLIENTS, MESSAGES,
+	       MSG_SIZE);
+
+	if (run_threads() < 0 || run_rtio() < 0) {
+		return 0;
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * SMP context switch throughput benchmark.
+ *
+ * Pairs of threads ping-pong through a pair of semaphores, so that
+ * every round trip costs two wakeups and two context switches.  The
+ * number of concurrently running pairs is stepped from one up to the
+ * number of CPUs, and the aggregate switch rate of each step is
+ * reported.  With a scalable scheduler the rate should grow with the
+ * number of pairs, as each pair can keep a CPU of its own busy.  The
+ * per-CPU run queues only change thread placement and IPI targets, the
+ * scheduler spinlock is still shared by all CPUs.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#if CONFIG_MP_MAX_NUM_CPUS == 1
+#error "Test requires a system with more than 1 CPU"
+#endif
+
+#define INTERVAL_MS 5000
+
+#define MAX_PAIRS  CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PAIR_PRIO  K_PRIO_PREEMPT(1)
+
+struct pair {
+	struct k_sem ping;
+	struct k_sem pong;
+	unsigned long round_trips;
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2 * MAX_PAIRS, STACK_SIZE);
+static struct k_thread threads[2 * MAX_PAIRS];
+static struct pair pairs[MAX_PAIRS];
+static volatile bool stop;
+
+static atomic_t ipi_counter;
+
+void z_trace_sched_ipi(void)
+{
+	atomic_inc(&ipi_counter);
+}
+
+static void pinger(void *p1, void *p2, void *p3)
+{
+	struct pair *pair = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!stop) {
+		k_sem_give(&pair->ping);
+		k_sem_take(&pair->pong, K_FOREVER);
+		pair->round_trips++;
+	}
+
+	/* Let the ponger observe the stop flag too */
+	k_sem_give(&pair->ping);
+}
+
+static void ponger(void *p1, void *p2, void *p3)
+{
+	struct pair *pair = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!stop) {
+		k_sem_take(&pair->ping, K_FOREVER);
+		k_sem_give(&pair->pong);
+	}
+}
+
+static void run(unsigned int num_pairs)
+{
+	unsigned long round_trips = 0;
+	unsigned int ipis;
+	uint64_t switches;
+	int64_t start;
+	int64_t elapsed;
+
+	stop = false;
+
+	for (unsigned int i = 0; i < num_pairs; i++) {
+		k_sem_init(&pairs[i].ping, 0, 1);
+		k_sem_init(&pairs[i].pong, 0, 1);
+		pairs[i].round_trips = 0;
+
+		k_thread_create(&threads[2 * i], stacks[2 * i], STACK_SIZE,
+				ponger, &pairs[i], NULL, NULL,
+				PAIR_PRIO, 0, K_NO_WAIT);
+		k_thread_create(&threads[2 * i + 1], stacks[2 * i + 1], STACK_SIZE,
+				pinger, &pairs[i], NULL, NULL,
+				PAIR_PRIO, 0, K_NO_WAIT);
+	}
+
+	atomic_set(&ipi_counter, 0);
+	start = k_uptime_get();
+	k_msleep(INTERVAL_MS);
+
+	stop = true;
+	elapsed = k_uptime_get() - start;
+	ipis = (unsigned int)atomic_get(&ipi_counter);
+
+	for (unsigned int i = 0; i < num_pairs; i++) {
+		round_trips += pairs[i].round_trips;
+	}
+
+	for (unsigned int i = 0; i < num_pairs; i++) {
+		/* Unblock a pinger stuck waiting for a pong */
+		k_sem_give(&pairs[i].pong);
+		k_thread_join(&threads[2 * i + 1], K_FOREVER);
+		k_thread_join(&threads[2 * i], K_FOREVER);
+	}
+
+	switches = (uint64_t)round_trips * 2U;
+
+	printk("pairs %u: %llu switches/s (%lu round trips, %u IPIs in %lld ms)\n",
+	       num_pairs, switches * 1000U / (uint64_t)elapsed, round_trips, ipis,
+	       elapsed);
+}
+
+int main(void)
+{
+	printk("SMP context switch benchmark, %u CPUs, %s run queues\n",
+	       arch_num_cpus(),
+	       IS_ENABLED(CONFIG_SCHED_PER_CPU_RUNQ) ? "per-CPU" : "global");
+
+	for (unsigned int n = 1; n <= arch_num_cpus(); n++) {
+		run(n);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
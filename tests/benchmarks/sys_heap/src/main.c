@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * sys_heap throughput benchmark.  Runs the sys_heap_stress() rig,
+ * which mostly allocates small blocks, at a few fill levels and
+ * reports the rate of alloc/free operations.  The blocks still live at
+ * the end of each run are left in place to measure fragmentation: the
+ * share of the free memory that cannot be handed out as a single
+ * block.
+ */
+
+#include <zephyr/bench_time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/printk.h>
+
+#define HEAP_SIZE (32 * 1024)
+#define OPS       200000
+
+static uint8_t heapmem[HEAP_SIZE] __aligned(8);
+static uint8_t scratchmem[HEAP_SIZE / 2] __aligned(8);
+static struct sys_heap heap;
+
+static void *bench_alloc(void *arg, size_t bytes)
+{
+	return sys_heap_alloc(arg, bytes);
+}
+
+static void bench_free(void *arg, void *p)
+{
+	sys_heap_free(arg, p);
+}
+
+/* Largest block that can currently be allocated, by bisection */
+static size_t largest_free_block(void)
+{
+	size_t lo = 0;
+	size_t hi = HEAP_SIZE;
+
+	while (lo < hi) {
+		size_t mid = (lo + hi + 1) / 2;
+		void *p = sys_heap_alloc(&heap, mid);
+
+		if (p != NULL) {
+			sys_heap_free(&heap, p);
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return lo;
+}
+
+static void run(int target_percent)
+{
+	struct z_heap_stress_result result;
+	struct sys_memory_stats stats;
+	uint64_t start, elapsed;
+	uint32_t ops;
+	size_t largest;
+
+	sys_heap_init(&heap, heapmem, sizeof(heapmem));
+
+	start = bench_time_us();
+	sys_heap_stress(bench_alloc, bench_free, &heap, sizeof(heapmem), OPS,
+			scratchmem, sizeof(scratchmem), target_percent, &result);
+	elapsed = MAX(bench_time_us() - start, 1);
+
+	largest = largest_free_block();
+	sys_heap_runtime_stats_get(&heap, &stats);
+	largest = MIN(largest, stats.free_bytes);
+
+	ops = result.total_allocs + result.total_frees;
+	printk("fill %3d%% %10llu ops/s, %u%% allocs ok, %zu free bytes, "
+	       "largest block %zu, fragmentation %u%%\n",
+	       target_percent, (uint64_t)ops * USEC_PER_SEC / elapsed,
+	       result.successful_allocs * 100U / MAX(result.total_allocs, 1U),
+	       stats.free_bytes, largest,
+	       stats.free_bytes ?
+	       (unsigned int)(100U - largest * 100U / stats.free_bytes) : 0U);
+}
+
+int main(void)
+{
+	printk("sys_heap benchmark, %u byte heap, %u ops per run (%s)\n",
+	       HEAP_SIZE, OPS,
+	       IS_ENABLED(CONFIG_SYS_HEAP_SIZE_CLASSES) ? "size classes" : "default");
+
+	run(10);
+	run(50);
+	run(90);
+
+	printk("fin\n");
+
+	return 0;
+}
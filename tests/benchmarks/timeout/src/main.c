@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Timeout queue microbenchmark.  With a given number of timeouts
+ * already armed at pseudo-random points in the future, measure the
+ * average cost of z_add_timeout() and z_abort_timeout() on one more
+ * timeout.  The armed timeouts are far enough out that none of them
+ * expires during the measurement.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <timeout_q.h>
+
+#define MAX_ARMED 10000
+#define N_RUNS    1000
+
+/* Keep every armed timeout beyond the measurement window */
+#define MIN_DELAY_TICKS k_ms_to_ticks_ceil32(60 * MSEC_PER_SEC)
+
+static struct _timeout armed[MAX_ARMED];
+static struct _timeout probe[N_RUNS];
+static uint32_t seed = 0x12345678;
+
+static void dummy_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+}
+
+static uint32_t next_rand(void)
+{
+	/* Deterministic LCG so every backend sees the same sequence */
+	seed = seed * 1103515245U + 12345U;
+	return seed >> 8;
+}
+
+static k_timeout_t rand_timeout(void)
+{
+	return K_TICKS(MIN_DELAY_TICKS + (next_rand() % (1U << 20)));
+}
+
+static void run(unsigned int num_armed)
+{
+	timing_t start, end;
+	uint64_t add_cycles = 0;
+	uint64_t abort_cycles = 0;
+
+	for (unsigned int i = 0; i < num_armed; i++) {
+		z_init_timeout(&armed[i]);
+		z_add_timeout(&armed[i], dummy_fn, rand_timeout());
+	}
+
+	for (unsigned int i = 0; i < N_RUNS; i++) {
+		k_timeout_t timeout = rand_timeout();
+
+		z_init_timeout(&probe[i]);
+
+		start = timing_counter_get();
+		z_add_timeout(&probe[i], dummy_fn, timeout);
+		end = timing_counter_get();
+		add_cycles += timing_cycles_get(&start, &end);
+	}
+
+	for (unsigned int i = 0; i < N_RUNS; i++) {
+		start = timing_counter_get();
+		z_abort_timeout(&probe[i]);
+		end = timing_counter_get();
+		abort_cycles += timing_cycles_get(&start, &end);
+	}
+
+	for (unsigned int i = 0; i < num_armed; i++) {
+		z_abort_timeout(&armed[i]);
+	}
+
+	printk("armed %5u: add %6llu ns abort %6llu ns\n", num_armed,
+	       timing_cycles_to_ns_avg(add_cycles, N_RUNS),
+	       timing_cycles_to_ns_avg(abort_cycles, N_RUNS));
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	printk("Timeout queue benchmark (%s)\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_WHEEL) ? "timing wheel" : "delta list");
+
+	run(10);
+	run(1000);
+	run(MAX_ARMED);
+
+	timing_stop();
+
+	printk("fin\n");
+
+	return 0;
+}
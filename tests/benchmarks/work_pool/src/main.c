@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * SMP work queue pool benchmark.
+ *
+ * Bursts of work items are submitted every millisecond, either from a
+ * thread or from a timer ISR, first to a single work queue and then to a
+ * work queue pool with one queue per CPU.  Every item keeps its CPU busy
+ * for a while, so a burst takes several times longer than the interval
+ * on one CPU.  The rate of completed items and the latency from
+ * submission to the start of the handler are reported.  With the pool
+ * all submissions land on the queue of the submitting CPU, so the rate
+ * and latency show how well the other queues take work from it.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#if CONFIG_MP_MAX_NUM_CPUS == 1
+#error "Test requires a system with more than 1 CPU"
+#endif
+
+#define INTERVAL_MS 5000
+
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO K_PRIO_PREEMPT(1)
+
+/* Items submitted every millisecond, and the time each one takes */
+#define BURST   8
+#define WORK_US 250
+
+#define NUM_ITEMS (BURST * 8)
+
+struct item {
+	struct k_work work;
+	uint32_t submitted;
+};
+
+static K_THREAD_STACK_DEFINE(single_stack, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, CONFIG_MP_MAX_NUM_CPUS, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+
+static struct k_work_q single;
+static struct k_work_pool pool;
+static struct k_thread producer;
+static struct k_timer burst_timer;
+
+static struct item items[NUM_ITEMS];
+static unsigned int next_item;
+static bool use_pool;
+static volatile bool stop;
+
+static struct k_spinlock stats_lock;
+static uint32_t completed;
+static uint64_t latency_sum;
+static uint32_t latency_max;
+
+static void handler(struct k_work *work)
+{
+	struct item *item = CONTAINER_OF(work, struct item, work);
+	uint32_t latency = k_cycle_get_32() - item->submitted;
+
+	K_SPINLOCK(&stats_lock) {
+		completed++;
+		latency_sum += latency;
+		latency_max = MAX(latency_max, latency);
+	}
+
+	k_busy_wait(WORK_US);
+}
+
+static void submit_burst(void)
+{
+	struct item *item;
+
+	for (int i = 0; i < BURST; i++) {
+		item = &items[next_item++ % NUM_ITEMS];
+
+		/* An item still pending from an earlier burst is skipped */
+		if (k_work_is_pending(&item->work)) {
+			continue;
+		}
+
+		item->submitted = k_cycle_get_32();
+		if (use_pool) {
+			(void)k_work_pool_submit(&pool, &item->work);
+		} else {
+			(void)k_work_submit_to_queue(&single, &item->work);
+		}
+	}
+}
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!stop) {
+		submit_burst();
+		k_msleep(1);
+	}
+}
+
+static void burst_timer_expiry(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	submit_burst();
+}
+
+static void run(const char *queue, bool isr)
+{
+	uint32_t count, avg_us, max_us;
+	int64_t start;
+	int64_t elapsed;
+
+	stop = false;
+
+	K_SPINLOCK(&stats_lock) {
+		completed = 0;
+		latency_sum = 0;
+		latency_max = 0;
+	}
+
+	start = k_uptime_get();
+
+	if (isr) {
+		k_timer_start(&burst_timer, K_MSEC(1), K_MSEC(1));
+		k_msleep(INTERVAL_MS);
+		k_timer_stop(&burst_timer);
+	} else {
+		k_thread_create(&producer, producer_stack, STACK_SIZE, producer_entry, NULL, NULL,
+				NULL, WORKER_PRIO - 1, 0, K_NO_WAIT);
+		k_msleep(INTERVAL_MS);
+		stop = true;
+		k_thread_join(&producer, K_FOREVER);
+	}
+
+	elapsed = k_uptime_get() - start;
+
+	K_SPINLOCK(&stats_lock) {
+		count = completed;
+		avg_us = k_cyc_to_us_floor32(latency_sum / MAX(completed, 1U));
+		max_us = k_cyc_to_us_floor32(latency_max);
+	}
+
+	printk("%-6s %s: %6llu items/s, latency avg %6u us, max %6u us\n", queue,
+	       isr ? "isr" : "thread", (uint64_t)count * 1000U / (uint64_t)elapsed, avg_us,
+	       max_us);
+
+	/* Let the queues run dry before the next run */
+	if (use_pool) {
+		(void)k_work_pool_drain(&pool, false);
+	} else {
+		(void)k_work_queue_drain(&single, false);
+	}
+}
+
+int main(void)
+{
+	printk("SMP work queue pool benchmark, %u CPUs, %s\n", arch_num_cpus(),
+	       IS_ENABLED(CONFIG_SCHED_CPU_MASK) ? "pinned" : "not pinned");
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i].work, handler);
+	}
+
+	k_timer_init(&burst_timer, burst_timer_expiry, NULL);
+
+	k_work_queue_start(&single, single_stack, STACK_SIZE, WORKER_PRIO, NULL);
+	k_work_pool_start(&pool, &pool_stacks[0][0], STACK_SIZE, WORKER_PRIO, NULL);
+
+	use_pool = false;
+	run("single", false);
+	run("single", true);
+
+	use_pool = true;
+	run("pool", false);
+	run("pool", true);
+
+	printk("fin\n");
+
+	return 0;
+}
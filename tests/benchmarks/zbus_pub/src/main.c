@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * zbus publish benchmark.  Messages of 16 to 1024 bytes are published to
+ * 1 to 8 message subscribers, once with zbus_chan_pub() and once by
+ * writing them into a buffer from zbus_chan_loan() and publishing that
+ * with zbus_chan_pub_loan().  The former gives every subscriber its own
+ * buffer (and, with the static buffer pool, its own copy of the message),
+ * the latter lets all subscribers share the loaned one.  The subscribers
+ * run at a lower priority, so only the publishing itself is timed; they
+ * drain their queues between batches.
+ */
+
+#include <string.h>
+
+#include <zephyr/bench_time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/zbus/zbus.h>
+
+#define SUBSCRIBERS 8
+#define BATCH       16
+#define ROUNDS      64
+
+#define SUB_STACK_SIZE 1024
+#define SUB_PRIORITY   K_PRIO_PREEMPT(10)
+
+#define SUB_DEFINE(n, _) ZBUS_MSG_SUBSCRIBER_DEFINE(sub##n)
+
+LISTIFY(SUBSCRIBERS, SUB_DEFINE, (;));
+
+#define MSG_CHAN_DEFINE(size)                                                                     \
+	struct msg_##size {                                                                        \
+		uint8_t data[size];                                                                \
+	};                                                                                         \
+	ZBUS_CHAN_DEFINE(chan_##size, struct msg_##size, NULL, NULL,                               \
+			 ZBUS_OBSERVERS(sub0, sub1, sub2, sub3, sub4, sub5, sub6, sub7),           \
+			 ZBUS_MSG_INIT(0))
+
+MSG_CHAN_DEFINE(16);
+MSG_CHAN_DEFINE(64);
+MSG_CHAN_DEFINE(256);
+MSG_CHAN_DEFINE(1024);
+
+static const struct zbus_observer *const subs[SUBSCRIBERS] = {
+	&sub0, &sub1, &sub2, &sub3, &sub4, &sub5, &sub6, &sub7,
+};
+
+static const struct zbus_channel *const chans[] = {
+	&chan_16, &chan_64, &chan_256, &chan_1024,
+};
+
+static uint8_t source[1024];
+
+static K_SEM_DEFINE(drained, 0, K_SEM_MAX_LIMIT);
+static bool loaned;
+
+K_THREAD_STACK_ARRAY_DEFINE(sub_stacks, SUBSCRIBERS, SUB_STACK_SIZE);
+static struct k_thread sub_threads[SUBSCRIBERS];
+
+static void subscriber(void *p1, void *p2, void *p3)
+{
+	const struct zbus_observer *sub = p1;
+	const struct zbus_channel *chan;
+	static uint8_t msg[SUBSCRIBERS][1024];
+	struct net_buf *buf;
+	int idx = POINTER_TO_INT(p2);
+
+	ARG_UNUSED(p3);
+
+	while (true) {
+		/* Each side uses the API that goes with the way it was published */
+		if (loaned) {
+			if (zbus_sub_wait_loaned_msg(sub, &chan, &buf, K_FOREVER) == 0) {
+				net_buf_unref(buf);
+			}
+		} else {
+			(void)zbus_sub_wait_msg(sub, &chan, msg[idx], K_FOREVER);
+		}
+
+		k_sem_give(&drained);
+	}
+}
+
+static int publish(const struct zbus_channel *chan)
+{
+	struct net_buf *loan;
+	int err;
+
+	if (!loaned) {
+		return zbus_chan_pub(chan, source, K_FOREVER);
+	}
+
+	err = zbus_chan_loan(chan, &loan, K_FOREVER);
+	if (err) {
+		return err;
+	}
+
+	memcpy(loan->data, source, loan->len);
+
+	return zbus_chan_pub_loan(chan, loan, K_FOREVER);
+}
+
+/* Average time of one publication, in nanoseconds */
+static int64_t run(const struct zbus_channel *chan, int count, bool loan)
+{
+	uint64_t elapsed = 0;
+	uint64_t start;
+
+	loaned = loan;
+
+	for (int r = 0; r < ROUNDS; r++) {
+		start = bench_time_us();
+
+		for (int i = 0; i < BATCH; i++) {
+			if (publish(chan) != 0) {
+				return -1;
+			}
+		}
+
+		elapsed += bench_time_us() - start;
+
+		for (int i = 0; i < BATCH * count; i++) {
+			k_sem_take(&drained, K_FOREVER);
+		}
+	}
+
+	return elapsed * NSEC_PER_USEC / (ROUNDS * BATCH);
+}
+
+int main(void)
+{
+	int64_t pub_ns, loan_ns;
+
+	printk("zbus publish benchmark: %u publications per run, %s message subscriber pool\n",
+	       ROUNDS * BATCH,
+	       IS_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER_BUF_ALLOC_STATIC) ? "static" : "heap");
+
+	for (int i = 0; i < SUBSCRIBERS; i++) {
+		k_thread_create(&sub_threads[i], sub_stacks[i], SUB_STACK_SIZE, subscriber,
+				(void *)subs[i], INT_TO_POINTER(i), NULL, SUB_PRIORITY, 0,
+				K_NO_WAIT);
+	}
+
+	for (int count = 1; count <= SUBSCRIBERS; count *= 2) {
+		for (int i = 0; i < SUBSCRIBERS; i++) {
+			zbus_obs_set_enable(subs[i], i < count);
+		}
+
+		ARRAY_FOR_EACH(chans, c) {
+			pub_ns = run(chans[c], count, false);
+			loan_ns = run(chans[c], count, true);
+			if (pub_ns < 0 || loan_ns < 0) {
+				printk("publication failed\n");
+				return 0;
+			}
+
+			printk("subscribers %d, size %4u: pub %6lld ns, loan %6lld ns\n", count,
+			       zbus_chan_msg_size(chans[c]), pub_ns, loan_ns);
+		}
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
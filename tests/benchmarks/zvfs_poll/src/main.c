@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Readiness polling benchmark.  Opens a growing number of eventfds, makes
+ * a random one of them readable and measures how long it takes to find it
+ * with zvfs_poll(), which registers and checks every descriptor on each
+ * call, and with zvfs_epoll_wait(), which keeps the descriptors registered
+ * and only visits the ready ones.  The time per wait includes the write
+ * and read of the eventfd.
+ */
+
+#include <errno.h>
+
+#include <zephyr/bench_time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/zvfs/epoll.h>
+#include <zephyr/zvfs/eventfd.h>
+
+#define WAITS 2000
+
+static const int fd_counts[] = {16, 128, 512};
+
+static int fds[CONFIG_ZVFS_EVENTFD_MAX];
+static struct zvfs_pollfd pfds[CONFIG_ZVFS_EVENTFD_MAX];
+
+static int bench_poll(int count, uint64_t *elapsed)
+{
+	zvfs_eventfd_t value;
+	uint64_t start;
+	int ret;
+
+	for (int i = 0; i < count; i++) {
+		pfds[i].fd = fds[i];
+		pfds[i].events = ZVFS_POLLIN;
+	}
+
+	start = bench_time_us();
+
+	for (int i = 0; i < WAITS; i++) {
+		int ready = sys_rand32_get() % count;
+
+		(void)zvfs_eventfd_write(fds[ready], 1);
+
+		ret = zvfs_poll(pfds, count, 0);
+		if (ret != 1 || pfds[ready].revents != ZVFS_POLLIN) {
+			printk("zvfs_poll failed: %d (errno %d)\n", ret, errno);
+			return -EIO;
+		}
+
+		(void)zvfs_eventfd_read(fds[ready], &value);
+	}
+
+	*elapsed = bench_time_us() - start;
+
+	return 0;
+}
+
+static int bench_epoll(int epfd, int count, uint64_t *elapsed)
+{
+	struct zvfs_epoll_event events[8];
+	zvfs_eventfd_t value;
+	uint64_t start;
+	int ret = 0;
+
+	for (int i = 0; i < count; i++) {
+		struct zvfs_epoll_event event = {
+			.events = ZVFS_EPOLLIN,
+			.data.u32 = i,
+		};
+
+		if (zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fds[i], &event) < 0) {
+			printk("zvfs_epoll_ctl failed: %d\n", errno);
+			ret = -errno;
+			goto out;
+		}
+	}
+
+	start = bench_time_us();
+
+	for (int i = 0; i < WAITS; i++) {
+		int ready = sys_rand32_get() % count;
+
+		(void)zvfs_eventfd_write(fds[ready], 1);
+
+		ret = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+		if (ret != 1 || events[0].data.u32 != ready) {
+			printk("zvfs_epoll_wait failed: %d (errno %d)\n", ret, errno);
+			ret = -EIO;
+			goto out;
+		}
+
+		(void)zvfs_eventfd_read(fds[ready], &value);
+	}
+
+	*elapsed = bench_time_us() - start;
+	ret = 0;
+
+out:
+	for (int i = 0; i < count; i++) {
+		(void)zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, fds[i], NULL);
+	}
+
+	return ret;
+}
+
+int main(void)
+{
+	uint64_t poll_us, epoll_us;
+	int epfd;
+
+	for (int i = 0; i < ARRAY_SIZE(fds); i++) {
+		fds[i] = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+		if (fds[i] < 0) {
+			printk("zvfs_eventfd failed: %d\n", errno);
+			return 0;
+		}
+	}
+
+	epfd = zvfs_epoll_create(0);
+	if (epfd < 0) {
+		printk("zvfs_epoll_create failed: %d\n", errno);
+		return 0;
+	}
+
+	printk("Readiness polling benchmark: %u waits per run\n", WAITS);
+
+	for (int i = 0; i < ARRAY_SIZE(fd_counts); i++) {
+		if (bench_poll(fd_counts[i], &poll_us) < 0 ||
+		    bench_epoll(epfd, fd_counts[i], &epoll_us) < 0) {
+			return 0;
+		}
+
+		printk("fds %3d: poll %6llu ns/wait, epoll %6llu ns/wait\n", fd_counts[i],
+		       poll_us * 1000U / WAITS, epoll_us * 1000U / WAITS);
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -11,8 +11,11 @@
 #include <mmu.h>
 #include <zephyr/linker/sections.h>
 
-#ifdef CONFIG_BACKING_STORE_RAM_PAGES
+#if defined(CONFIG_BACKING_STORE_RAM_PAGES)
 #define EXTRA_PAGES	(CONFIG_BACKING_STORE_RAM_PAGES - 1)
+#elif defined(CONFIG_BACKING_STORE_RAM_COMPRESSED_PAGES)
+/* The pool is sized for uncompressed pages, so descriptors run out first */
+#define EXTRA_PAGES	(CONFIG_BACKING_STORE_RAM_COMPRESSED_PAGES - 1)
 #else
 #error "Unsupported configuration"
 #endif
@@ -113,6 +116,13 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+	printk("* Readahead (%s):\n", scope);
+	printk("    - Sequential page faults: %lu\n", stats->readahead.hits);
+	printk("    - Other page faults: %lu\n", stats->readahead.misses);
+	printk("    - Pages paged in ahead: %lu\n", stats->readahead.pages);
+#endif
 }
 
 static void touch_anon_pages(bool zig, bool zag)
@@ -185,6 +195,13 @@ static void touch_anon_pages(bool zig, bool zag)
 	zassert_not_equal(stats.eviction.clean, 0UL,
 			  "there should be clean pages being evicted.");
 
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+	if (!zag) {
+		zassert_not_equal(stats.readahead.hits, 0UL,
+				  "sequential page faults not detected.");
+	}
+#endif
+
 	/* per-thread statistics */
 	printk("\nPaging stats for current thread (%p):\n", tid);
 	k_mem_paging_thread_stats_get(tid, &stats);
@@ -217,6 +234,54 @@ ZTEST(demand_paging, test_touch_anon_pages_zigzag2)
 	touch_anon_pages(false, true);
 }
 
+/* Page faults in the middle of the pages, paging in the pages after them */
+ZTEST(demand_paging, test_touch_anon_pages_unaligned)
+{
+	size_t offset = CONFIG_MMU_PAGE_SIZE / 2 + 1;
+	struct k_mem_paging_stats_t stats;
+	unsigned long hits;
+	int ret;
+
+	for (size_t i = 0; i < HALF_BYTES; i++) {
+		arena[i] = nums[i % 10];
+	}
+
+	k_mem_paging_stats_get(&stats);
+	hits = stats.readahead.hits;
+
+	ret = k_mem_page_out(arena, HALF_BYTES);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	for (size_t i = offset; i < HALF_BYTES; i += CONFIG_MMU_PAGE_SIZE) {
+		zassert_equal(arena[i], nums[i % 10], "arena corrupted at index %zu", i);
+	}
+
+	k_mem_paging_stats_get(&stats);
+	print_paging_stats(&stats, "kernel");
+
+#ifdef CONFIG_DEMAND_PAGING_FAULT_AROUND
+	zassert_not_equal(stats.readahead.hits, hits,
+			  "sequential page faults not detected.");
+#else
+	ARG_UNUSED(hits);
+#endif
+
+	/* The pages paged in ahead must have been mapped where they belong,
+	 * so evict them again and check all of their content.
+	 */
+	ret = k_mem_page_out(arena, HALF_BYTES);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	for (size_t i = 0; i < HALF_BYTES; i++) {
+		zassert_equal(arena[i], nums[i % 10], "arena corrupted at index %zu", i);
+	}
+
+	/* Reset arena to zero */
+	for (size_t i = 0; i < HALF_BYTES; i++) {
+		arena[i] = 0;
+	}
+}
+
 ZTEST(demand_paging, test_unmap_anon_pages)
 {
 	 k_mem_unmap(arena, arena_size);
@@ -337,8 +402,7 @@ ZTEST(demand_paging_stat, test_backing_store_capacity)
 	char *mem, *ret;
 	unsigned int key;
 	unsigned long faults;
-	size_t size = (((CONFIG_BACKING_STORE_RAM_PAGES - 1) - HALF_PAGES) *
-		       CONFIG_MMU_PAGE_SIZE);
+	size_t size = ((EXTRA_PAGES - HALF_PAGES) * CONFIG_MMU_PAGE_SIZE);
 
 	/* Consume the rest of memory */
 	mem = k_mem_map(size, K_MEM_PERM_RW);
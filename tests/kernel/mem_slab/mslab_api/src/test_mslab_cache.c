@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include "test_mslab.h"
+
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+
+/* More blocks than a CPU cache holds, so that frees overflow to the slab */
+#define CACHE_BLK_NUM (2 * CONFIG_MEM_SLAB_PER_CPU_CACHE_SIZE + 1)
+
+K_MEM_SLAB_DEFINE_STATIC(cslab, BLK_SIZE, CACHE_BLK_NUM, BLK_ALIGN);
+static void *cblock[CACHE_BLK_NUM];
+
+static void cslab_alloc_all(void)
+{
+	for (int i = 0; i < CACHE_BLK_NUM; i++) {
+		zassert_ok(k_mem_slab_alloc(&cslab, &cblock[i], K_NO_WAIT),
+			   "block %d not allocated", i);
+	}
+
+	zassert_equal(k_mem_slab_num_used_get(&cslab), CACHE_BLK_NUM);
+	zassert_equal(k_mem_slab_num_free_get(&cslab), 0);
+}
+
+static void cslab_free_all(void)
+{
+	for (int i = 0; i < CACHE_BLK_NUM; i++) {
+		k_mem_slab_free(&cslab, cblock[i]);
+	}
+}
+
+/**
+ * @brief Verify that blocks cached by a CPU count as free
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_cache_used_get)
+{
+	cslab_alloc_all();
+	cslab_free_all();
+
+	zassert_equal(k_mem_slab_num_used_get(&cslab), 0);
+	zassert_equal(k_mem_slab_num_free_get(&cslab), CACHE_BLK_NUM);
+
+	/* The cached blocks are allocated again */
+	cslab_alloc_all();
+	cslab_free_all();
+}
+
+#if (CONFIG_MP_MAX_NUM_CPUS > 1) && defined(CONFIG_SCHED_CPU_MASK)
+static K_THREAD_STACK_DEFINE(alloc_stack, STACKSIZE);
+static K_THREAD_STACK_DEFINE(free_stack, STACKSIZE);
+static struct k_thread alloc_thread;
+static struct k_thread free_thread;
+static K_SEM_DEFINE(free_start, 0, 1);
+static K_SEM_DEFINE(free_done, 0, 1);
+static int free_count;
+
+/* Frees the first free_count blocks on CPU 1 when asked to */
+static void free_entry(void *p1, void *p2, void *p3)
+{
+	for (int round = 0; round < 2; round++) {
+		k_sem_take(&free_start, K_FOREVER);
+
+		/* Let the other CPU wait for the block */
+		k_msleep(10);
+
+		for (int i = 0; i < free_count; i++) {
+			k_mem_slab_free(&cslab, cblock[i]);
+		}
+
+		k_sem_give(&free_done);
+	}
+}
+
+/* Allocates on CPU 0 the blocks freed on CPU 1 */
+static void alloc_entry(void *p1, void *p2, void *p3)
+{
+	void *b;
+
+	cslab_alloc_all();
+
+	free_count = CACHE_BLK_NUM;
+	k_sem_give(&free_start);
+	k_sem_take(&free_done, K_FOREVER);
+
+	/* Part of the blocks is left in the cache of CPU 1 */
+	zassert_equal(k_mem_slab_num_used_get(&cslab), 0);
+	zassert_equal(k_mem_slab_num_free_get(&cslab), CACHE_BLK_NUM);
+
+	/* Which is flushed when CPU 0 runs out of blocks */
+	cslab_alloc_all();
+
+	/* A block freed on CPU 1 is handed to a waiter on CPU 0 */
+	free_count = 1;
+	k_sem_give(&free_start);
+	zassert_ok(k_mem_slab_alloc(&cslab, &b, K_MSEC(TIMEOUT)));
+	k_sem_take(&free_done, K_FOREVER);
+
+	zassert_equal(b, cblock[0]);
+	zassert_equal(k_mem_slab_num_used_get(&cslab), CACHE_BLK_NUM);
+
+	cslab_free_all();
+	zassert_equal(k_mem_slab_num_used_get(&cslab), 0);
+}
+#endif /* (CONFIG_MP_MAX_NUM_CPUS > 1) && defined(CONFIG_SCHED_CPU_MASK) */
+
+/**
+ * @brief Verify blocks freed on a CPU are allocated on another one
+ *
+ * @details A thread on CPU 0 allocates all blocks and a thread on CPU 1
+ * frees them, partly into its CPU cache. The thread on CPU 0 gets all
+ * blocks again, then waits for a block freed on CPU 1. The used and free
+ * block counts are checked on the way.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_cache_cross_cpu)
+{
+#if (CONFIG_MP_MAX_NUM_CPUS > 1) && defined(CONFIG_SCHED_CPU_MASK)
+	if (arch_num_cpus() < 2) {
+		ztest_test_skip();
+	}
+
+	k_thread_create(&alloc_thread, alloc_stack, STACKSIZE, alloc_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(1), 0, K_FOREVER);
+	k_thread_create(&free_thread, free_stack, STACKSIZE, free_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(1), 0, K_FOREVER);
+
+	zassert_ok(k_thread_cpu_pin(&alloc_thread, 0));
+	zassert_ok(k_thread_cpu_pin(&free_thread, 1));
+
+	k_thread_start(&free_thread);
+	k_thread_start(&alloc_thread);
+
+	zassert_ok(k_thread_join(&alloc_thread, K_MSEC(TIMEOUT)));
+	zassert_ok(k_thread_join(&free_thread, K_MSEC(TIMEOUT)));
+#else
+	ztest_test_skip();
+#endif
+}
+
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
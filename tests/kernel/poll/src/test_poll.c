@@ -876,3 +876,60 @@ ZTEST(poll_api_1cpu, test_poll_zero_events)
 
 	zassert_equal(k_poll(&event, 0, K_MSEC(50)), -EAGAIN);
 }
+
+static struct k_sem set_sems[3];
+
+/**
+ * @brief Test persistent poll sets
+ *
+ * @details Events stay registered between waits and only the ones whose
+ * object became available are returned, in the order they became ready.
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST(poll_api_1cpu, test_poll_set)
+{
+	struct k_poll_event events[ARRAY_SIZE(set_sems)];
+	struct k_poll_set set;
+	struct k_poll_event *pev;
+
+	k_poll_set_init(&set);
+
+	for (int i = 0; i < ARRAY_SIZE(set_sems); i++) {
+		k_sem_init(&set_sems[i], 0, 1);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &set_sems[i]);
+		k_poll_set_add(&set, &events[i]);
+	}
+
+	zassert_equal(k_poll_set_wait(&set, K_MSEC(10)), -EAGAIN);
+	zassert_is_null(k_poll_set_get(&set));
+
+	k_sem_give(&set_sems[2]);
+	k_sem_give(&set_sems[0]);
+
+	zassert_equal(k_poll_set_wait(&set, K_NO_WAIT), 0);
+	pev = k_poll_set_get(&set);
+	zassert_equal_ptr(pev, &events[2]);
+	zassert_equal(pev->state, K_POLL_STATE_SEM_AVAILABLE);
+	zassert_equal_ptr(k_poll_set_get(&set), &events[0]);
+	zassert_is_null(k_poll_set_get(&set));
+
+	/* An available object is reported as soon as it is added again */
+	events[2].state = K_POLL_STATE_NOT_READY;
+	k_poll_set_add(&set, &events[2]);
+	zassert_equal_ptr(k_poll_set_get(&set), &events[2]);
+
+	/* Removed events are neither signaled nor queued */
+	k_poll_set_remove(&set, &events[1]);
+	k_sem_give(&set_sems[1]);
+	zassert_equal(k_poll_set_wait(&set, K_NO_WAIT), -EAGAIN);
+
+	/* Removing a ready event takes it off the ready list */
+	k_sem_take(&set_sems[1], K_NO_WAIT);
+	events[1].state = K_POLL_STATE_NOT_READY;
+	k_poll_set_add(&set, &events[1]);
+	k_sem_give(&set_sems[1]);
+	k_poll_set_remove(&set, &events[1]);
+	zassert_is_null(k_poll_set_get(&set));
+}
@@ -572,6 +572,66 @@ ZTEST(smp, test_wakeup_threads)
 	cleanup_resources();
 }
 
+static atomic_t woken_count;
+
+static void thread_wakeup_spin_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+	int thread_num = POINTER_TO_INT(p1);
+	int tnum = arch_num_cpus() - 1;
+
+	thread_started[thread_num] = 1;
+
+	k_sleep(K_FOREVER);
+
+	atomic_inc(&woken_count);
+
+	/* Only succeeds if every woken thread runs at the same time */
+	for (int i = 0; (i < TIMEOUT) && (atomic_get(&woken_count) < tnum); i++) {
+		k_busy_wait(1000);
+	}
+
+	tinfo[thread_num].executed = atomic_get(&woken_count) == tnum;
+}
+
+/**
+ * @brief Test that threads woken in a row run on different CPUs
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details Spawn as many cooperative threads as there are
+ * remaining cores and let them sleep.  Wake them all up back to
+ * back, each spinning until all of them run, and check that none
+ * had to wait for another one to finish on the same CPU while a
+ * CPU was left idle.
+ */
+ZTEST(smp, test_wakeup_threads_spread)
+{
+	unsigned int num_threads = arch_num_cpus();
+
+	for (int i = 0; i < num_threads - 1; i++) {
+		thread_started[i] = 0;
+	}
+	atomic_set(&woken_count, 0);
+
+	spawn_threads(K_PRIO_COOP(10), num_threads - 1, EQUAL_PRIORITY,
+		      &thread_wakeup_spin_entry, !THREAD_DELAY);
+
+	wakeup_on_start_thread(num_threads - 1);
+
+	/* Keep this CPU busy, so it does not pick up a thread left behind */
+	k_busy_wait((TIMEOUT + DELAY_US / USEC_PER_MSEC) * USEC_PER_MSEC);
+
+	for (int i = 0; i < num_threads - 1; i++) {
+		zassert_true(tinfo[i].executed == 1,
+			     "thread %d did not run alongside the others", i);
+	}
+
+	abort_threads(num_threads - 1);
+	cleanup_resources();
+}
+
 /* a thread for testing get current cpu */
 static void thread_get_cpu_entry(void *p1, void *p2, void *p3)
 {
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define POOL_PRIO  K_PRIO_PREEMPT(1)
+
+#define NUM_ITEMS 32
+#define WORK_US   1000
+
+struct item {
+	struct k_work work;
+	atomic_t runs;
+	k_tid_t thread;
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, CONFIG_MP_MAX_NUM_CPUS, STACK_SIZE);
+static struct k_work_pool pool;
+
+static struct item items[NUM_ITEMS];
+static K_SEM_DEFINE(release, 0, NUM_ITEMS);
+
+static void busy_handler(struct k_work *work)
+{
+	struct item *item = CONTAINER_OF(work, struct item, work);
+
+	item->thread = k_current_get();
+	k_busy_wait(WORK_US);
+	atomic_inc(&item->runs);
+}
+
+static void blocking_handler(struct k_work *work)
+{
+	struct item *item = CONTAINER_OF(work, struct item, work);
+
+	k_sem_take(&release, K_FOREVER);
+	atomic_inc(&item->runs);
+}
+
+static atomic_t active;
+static atomic_t overlaps;
+
+static void exclusive_handler(struct k_work *work)
+{
+	struct item *item = CONTAINER_OF(work, struct item, work);
+
+	if (atomic_inc(&active) != 0) {
+		atomic_inc(&overlaps);
+	}
+
+	k_busy_wait(10 * WORK_US);
+	atomic_dec(&active);
+	atomic_inc(&item->runs);
+}
+
+static void init_items(k_work_handler_t handler)
+{
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i].work, handler);
+		atomic_set(&items[i].runs, 0);
+		items[i].thread = NULL;
+	}
+}
+
+static void wait_running(struct k_work *work)
+{
+	for (int i = 0; i < 100 && (k_work_busy_get(work) & K_WORK_RUNNING) == 0; i++) {
+		k_msleep(1);
+	}
+
+	zassert_true(k_work_busy_get(work) & K_WORK_RUNNING, "work not running");
+}
+
+ZTEST(work_pool, test_submit)
+{
+	k_tid_t threads[CONFIG_MP_MAX_NUM_CPUS];
+	unsigned int num_threads = 0;
+	unsigned int t;
+
+	init_items(busy_handler);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_pool_submit(&pool, &items[i].work), 1);
+	}
+
+	zassert_true(k_work_pool_drain(&pool, false) >= 0);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(atomic_get(&items[i].runs), 1, "item %d ran %ld times", i,
+			      atomic_get(&items[i].runs));
+		zassert_equal(k_work_busy_get(&items[i].work), 0);
+	}
+
+	/* All items went to one queue, the others must have taken some */
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		t = 0;
+		while (t < num_threads && threads[t] != items[i].thread) {
+			t++;
+		}
+
+		if (t == num_threads) {
+			zassert_true(num_threads < arch_num_cpus(), "too many work threads");
+			threads[num_threads++] = items[i].thread;
+		}
+	}
+
+	if (arch_num_cpus() > 1) {
+		zassert_true(num_threads > 1, "work ran on %u queue(s) only", num_threads);
+	} else {
+		zassert_equal(num_threads, 1);
+	}
+}
+
+ZTEST(work_pool, test_resubmit_running)
+{
+	init_items(exclusive_handler);
+	atomic_set(&active, 0);
+	atomic_set(&overlaps, 0);
+
+	zassert_equal(k_work_pool_submit(&pool, &items[0].work), 1);
+	wait_running(&items[0].work);
+
+	/* A running item is queued again to the queue running it, and the
+	 * idle queues woken up by the submission must leave it there.
+	 */
+	zassert_equal(k_work_pool_submit(&pool, &items[0].work), 2);
+	zassert_equal(k_work_pool_submit(&pool, &items[0].work), 0);
+	zassert_equal(k_work_busy_get(&items[0].work), K_WORK_RUNNING | K_WORK_QUEUED);
+
+	zassert_true(k_work_pool_drain(&pool, false) >= 0);
+	zassert_equal(atomic_get(&items[0].runs), 2);
+	zassert_equal(atomic_get(&overlaps), 0, "handler ran on two queues at once");
+}
+
+ZTEST(work_pool, test_cancel)
+{
+	struct k_work_sync sync;
+	int busy;
+
+	init_items(blocking_handler);
+
+	/* Keep every queue busy, so that the last item stays queued */
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		zassert_equal(k_work_pool_submit(&pool, &items[i].work), 1);
+	}
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		wait_running(&items[i].work);
+	}
+
+	zassert_equal(k_work_pool_submit(&pool, &items[NUM_ITEMS - 1].work), 1);
+	zassert_equal(k_work_cancel(&items[NUM_ITEMS - 1].work), 0);
+
+	/* A running item can only be flagged */
+	busy = k_work_cancel(&items[0].work);
+	zassert_equal(busy, K_WORK_RUNNING | K_WORK_CANCELING);
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		k_sem_give(&release);
+	}
+
+	(void)k_work_cancel_sync(&items[0].work, &sync);
+	zassert_equal(k_work_busy_get(&items[0].work), 0);
+	zassert_true(k_work_pool_drain(&pool, false) >= 0);
+
+	zassert_equal(atomic_get(&items[NUM_ITEMS - 1].runs), 0);
+	zassert_equal(atomic_get(&items[0].runs), 1);
+}
+
+ZTEST(work_pool, test_flush)
+{
+	struct k_work_sync sync;
+
+	init_items(busy_handler);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_pool_submit(&pool, &items[i].work), 1);
+	}
+
+	/* Flushing waits for the item, wherever it ends up running */
+	for (int i = NUM_ITEMS - 1; i >= 0; i--) {
+		(void)k_work_flush(&items[i].work, &sync);
+		zassert_equal(atomic_get(&items[i].runs), 1, "item %d not done", i);
+	}
+}
+
+ZTEST(work_pool, test_drain_plug)
+{
+	init_items(busy_handler);
+
+	zassert_equal(k_work_pool_submit(&pool, &items[0].work), 1);
+	zassert_true(k_work_pool_drain(&pool, true) >= 0);
+	zassert_equal(atomic_get(&items[0].runs), 1);
+
+	zassert_equal(k_work_pool_submit(&pool, &items[1].work), -EBUSY);
+	zassert_equal(k_work_pool_unplug(&pool), 0);
+	zassert_equal(k_work_pool_unplug(&pool), -EALREADY);
+
+	zassert_equal(k_work_pool_submit(&pool, &items[1].work), 1);
+	zassert_true(k_work_pool_drain(&pool, false) >= 0);
+	zassert_equal(atomic_get(&items[1].runs), 1);
+}
+
+static atomic_t delayed_runs;
+
+static void delayed_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	atomic_inc(&delayed_runs);
+}
+
+ZTEST(work_pool, test_schedule)
+{
+	struct k_work_delayable dwork;
+	struct k_work_sync sync;
+
+	atomic_set(&delayed_runs, 0);
+	k_work_init_delayable(&dwork, delayed_handler);
+
+	zassert_equal(k_work_pool_schedule(&pool, &dwork, K_MSEC(10)), 1);
+	zassert_equal(k_work_pool_schedule(&pool, &dwork, K_MSEC(10)), 0);
+	zassert_equal(k_work_pool_reschedule(&pool, &dwork, K_MSEC(20)), 1);
+	zassert_equal(k_work_delayable_busy_get(&dwork), K_WORK_DELAYED);
+
+	k_msleep(50);
+	zassert_false(k_work_flush_delayable(&dwork, &sync));
+	zassert_equal(atomic_get(&delayed_runs), 1);
+
+	zassert_equal(k_work_pool_schedule(&pool, &dwork, K_MSEC(10)), 1);
+	zassert_true(k_work_cancel_delayable_sync(&dwork, &sync));
+	k_msleep(20);
+	zassert_equal(atomic_get(&delayed_runs), 1);
+}
+
+static void *work_pool_setup(void)
+{
+	k_work_pool_start(&pool, &pool_stacks[0][0], STACK_SIZE, POOL_PRIO, NULL);
+
+	return NULL;
+}
+
+ZTEST_SUITE(work_pool, NULL, work_pool_setup, NULL, NULL, NULL);
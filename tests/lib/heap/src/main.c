@@ -259,6 +259,11 @@ ZTEST(lib_heap, test_solo_free_header)
 
 	TC_PRINT("Testing solo free header in a heap\n");
 
+	/* The size class list heads do not fit in such a small heap */
+	if (IS_ENABLED(CONFIG_SYS_HEAP_SIZE_CLASSES)) {
+		ztest_test_skip();
+	}
+
 	sys_heap_init(&heap, heapmem, SOLO_FREE_HEADER_HEAP_SZ);
 	if (sizeof(void *) > 4U) {
 		sys_heap_alloc(&heap, 1);
@@ -1762,6 +1762,40 @@ ZTEST(lib_json_test, test_json_invalid_string)
 	parse_harness(encoded, ARRAY_SIZE(encoded));
 }
 
+ZTEST(lib_json_test, test_json_long_string)
+{
+	static const char nul_string[] = "{\"some_string\":\"0123456789abcdef\0\"}";
+	struct test_struct ts;
+	char encoded[128];
+	char expected[64];
+	int64_t ret;
+	int len;
+
+	/* Escapes and padding land at every offset within the scanned words */
+	for (int pos = 0; pos < 39; pos++) {
+		for (int pad = 0; pad < 20; pad += 3) {
+			memset(expected, 'x', 40);
+			memcpy(expected + pos, "\\\"", 2);
+			expected[40] = '\0';
+
+			len = snprintk(encoded, sizeof(encoded), "{%*s\"some_string\":\"%s\",%*s"
+				       "\"some_int\":%d}", pad, "", expected, pad, "", pos);
+
+			ret = json_obj_parse(encoded, len, test_descr, ARRAY_SIZE(test_descr),
+					     &ts);
+			zassert_equal(ret, BIT(0) | BIT(2), "Decoding failed at %d", pos);
+			zassert_str_equal(ts.some_string, expected, "Wrong string at %d", pos);
+			zassert_equal(ts.some_int, pos, "Wrong int at %d", pos);
+		}
+	}
+
+	/* A NUL ends the input, even within a string */
+	len = sizeof(nul_string) - 1;
+	memcpy(encoded, nul_string, len);
+	ret = json_obj_parse(encoded, len, test_descr, ARRAY_SIZE(test_descr), &ts);
+	zassert_equal(ret, -EINVAL, "Embedded NUL not rejected");
+}
+
 ZTEST(lib_json_test, test_json_invalid_bool)
 {
 	struct encoding_test encoded[] = {
@@ -2178,4 +2212,155 @@ ZTEST(lib_json_test, test_json_enums)
 		     "Enums not decoded correctly");
 }
 
+struct test_stream_elt {
+	char name[10];
+	int height;
+};
+
+struct test_stream {
+	char label[16];
+	int count;
+	bool enabled;
+	int64_t total;
+	uint8_t level;
+	struct test_stream_elt owner;
+	int values[8];
+	size_t values_len;
+	struct test_stream_elt people[3];
+	size_t people_len;
+};
+
+static const struct json_obj_descr stream_elt_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct test_stream_elt, name, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct test_stream_elt, height, JSON_TOK_NUMBER),
+};
+
+static const struct json_obj_descr stream_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct test_stream, label, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct test_stream, count, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_stream, enabled, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct test_stream, total, JSON_TOK_INT64),
+	JSON_OBJ_DESCR_PRIM(struct test_stream, level, JSON_TOK_UINT),
+	JSON_OBJ_DESCR_OBJECT(struct test_stream, owner, stream_elt_descr),
+	JSON_OBJ_DESCR_ARRAY(struct test_stream, values, 8, values_len, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct test_stream, people, 3, people_len, stream_elt_descr,
+				 ARRAY_SIZE(stream_elt_descr)),
+};
+
+static const struct json_obj_descr stream_people_descr[] = {
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct test_stream, people, 3, people_len, stream_elt_descr,
+				 ARRAY_SIZE(stream_elt_descr)),
+};
+
+static const char stream_encoded[] =
+	"{ \"label\" : \"a \\\"b\\\" \\u00e9\",\n"
+	"\"unknown\": {\"x\": [1, {\"y\": \"]}\"}, null], \"z\": -1.5e3},"
+	"\"count\":\t-1234,\"enabled\":true,\"total\":-9223372036854775807,"
+	"\"level\":200,\"owner\":{\"height\":180,\"name\":\"Alex\"},"
+	"\"values\":[1, 22,333 ,4444],"
+	"\"people\":[{\"name\":\"Hazel\",\"height\":157},{\"name\":\"Daila\"}],"
+	"\"count\":42}";
+
+ZTEST(lib_json_test, test_json_stream_chunks)
+{
+	char encoded[sizeof(stream_encoded)];
+	struct test_stream expected, ts;
+	struct json_stream stream;
+	int64_t expected_ret, ret;
+	size_t len = sizeof(stream_encoded) - 1;
+
+	memcpy(encoded, stream_encoded, sizeof(encoded));
+	memset(&expected, 0, sizeof(expected));
+	expected_ret = json_obj_parse(encoded, len, stream_descr, ARRAY_SIZE(stream_descr),
+				      &expected);
+	zassert_equal(expected_ret, BIT_MASK(ARRAY_SIZE(stream_descr)),
+		      "Not all fields decoded correctly");
+
+	/* Every chunk size splits tokens at different places */
+	for (size_t chunk = 1; chunk <= len; chunk++) {
+		memset(&ts, 0, sizeof(ts));
+		json_stream_obj_init(&stream, stream_descr, ARRAY_SIZE(stream_descr), &ts);
+
+		for (size_t offset = 0; offset < len; offset += chunk) {
+			ret = json_stream_parse(&stream, stream_encoded + offset,
+						MIN(chunk, len - offset));
+			if (offset + chunk < len) {
+				zassert_equal(ret, -EAGAIN, "Chunk %zu: early result %lld", chunk,
+					      ret);
+			}
+		}
+
+		zassert_equal(ret, expected_ret, "Chunk %zu: result %lld", chunk, ret);
+		zassert_mem_equal(&ts, &expected, sizeof(ts), "Chunk %zu: decoded differently",
+				  chunk);
+	}
+
+	zassert_str_equal(ts.label, "a \\\"b\\\" \\u00e9");
+	zassert_equal(ts.count, -1234);
+	zassert_equal(ts.owner.height, 180);
+	zassert_equal(ts.values_len, 4);
+	zassert_equal(ts.values[3], 4444);
+	zassert_equal(ts.people_len, 2);
+	zassert_str_equal(ts.people[1].name, "Daila");
+}
+
+ZTEST(lib_json_test, test_json_stream_array)
+{
+	static const char encoded[] = "[{\"name\":\"Muggsy\",\"height\":160},"
+				      "{\"name\":\"Hakeem\",\"height\":213}] trailing data";
+	struct json_stream stream;
+	struct test_stream ts;
+
+	json_stream_arr_init(&stream, stream_people_descr, &ts);
+	zassert_equal(json_stream_parse(&stream, encoded, 10), -EAGAIN);
+	zassert_equal(json_stream_parse(&stream, encoded + 10, sizeof(encoded) - 11), 0);
+
+	zassert_equal(ts.people_len, 2);
+	zassert_str_equal(ts.people[0].name, "Muggsy");
+	zassert_equal(ts.people[1].height, 213);
+
+	/* Data after the document is ignored */
+	zassert_equal(json_stream_parse(&stream, "[", 1), 0);
+}
+
+ZTEST(lib_json_test, test_json_stream_invalid)
+{
+	struct encoding_test encoded[] = {
+		{ "{\"label\":\"0123456789abcdef\"}", -EINVAL },
+		{ "{\"label\":\"\\X\"}", -EINVAL },
+		{ "{\"label\":\"\\uABC@\"}", -EINVAL },
+		{ "{\"count\":null}", -EINVAL },
+		{ "{\"count\":12x}", -EINVAL },
+		{ "{\"count\":\"12\"}", -EINVAL },
+		{ "{\"level\":256}", -EINVAL },
+		{ "{\"enabled\":truffle}", -EINVAL },
+		{ "{\"count\" 1}", -EINVAL },
+		{ "{\"count\":1,}", -EINVAL },
+		{ "{\"values\":[1,]}", -EINVAL },
+		{ "{\"values\":[1,2,3,4,5,6,7,8,9]}", -ENOSPC },
+		{ "[]", -EINVAL },
+		{ "{\"count\":1", -EAGAIN },
+	};
+	struct json_stream stream;
+	struct test_stream ts;
+	int64_t ret;
+
+	for (int i = 0; i < ARRAY_SIZE(encoded); i++) {
+		json_stream_obj_init(&stream, stream_descr, ARRAY_SIZE(stream_descr), &ts);
+		ret = json_stream_parse(&stream, encoded[i].str, strlen(encoded[i].str));
+		zassert_equal(ret, encoded[i].result, "Decoding '%s' result %lld, expected %d",
+			      encoded[i].str, ret, encoded[i].result);
+	}
+
+	/* The truncated document can still be completed, errors stick */
+	zassert_equal(json_stream_parse(&stream, "}", 1), BIT(1));
+	json_stream_obj_init(&stream, stream_descr, ARRAY_SIZE(stream_descr), &ts);
+	zassert_equal(json_stream_parse(&stream, "{\"count\":1,}", 12), -EINVAL);
+	zassert_equal(json_stream_parse(&stream, "}", 1), -EINVAL);
+
+	/* Strings cannot point into the document */
+	json_stream_obj_init(&stream, test_descr, ARRAY_SIZE(test_descr), &ts);
+	zassert_equal(json_stream_parse(&stream, "{\"some_string\":\"x\"}", 19), -EINVAL);
+}
+
 ZTEST_SUITE(lib_json_test, NULL, NULL, NULL, NULL, NULL);
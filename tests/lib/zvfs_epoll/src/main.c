@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/zvfs/epoll.h>
+#include <zephyr/zvfs/eventfd.h>
+
+#define NUM_FDS     4
+#define WAIT_MS     1000
+#define DELAY_MS    50
+
+static int epfd;
+static int fds[NUM_FDS];
+
+static struct k_work_delayable write_work;
+static int write_fd;
+
+static void write_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)zvfs_eventfd_write(write_fd, 1);
+}
+
+static void write_later(int fd)
+{
+	write_fd = fd;
+	(void)k_work_schedule(&write_work, K_MSEC(DELAY_MS));
+}
+
+static void drain(int fd)
+{
+	zvfs_eventfd_t value;
+
+	(void)zvfs_eventfd_read(fd, &value);
+}
+
+ZTEST(zvfs_epoll, test_ready)
+{
+	struct zvfs_epoll_event events[NUM_FDS];
+	int ret;
+
+	zassert_ok(zvfs_eventfd_write(fds[2], 1));
+
+	ret = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(ret, 1);
+	zassert_equal(events[0].events, ZVFS_EPOLLIN);
+	zassert_equal(events[0].data.u32, 2);
+
+	drain(fds[2]);
+
+	zassert_equal(zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 0);
+}
+
+ZTEST(zvfs_epoll, test_timeout)
+{
+	struct zvfs_epoll_event events[NUM_FDS];
+	int64_t start = k_uptime_get();
+
+	zassert_equal(zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), DELAY_MS), 0);
+	zassert_true(k_uptime_get() - start >= DELAY_MS, "returned too early");
+}
+
+ZTEST(zvfs_epoll, test_not_ready_then_ready)
+{
+	struct zvfs_epoll_event events[NUM_FDS];
+	int ret;
+
+	write_later(fds[1]);
+
+	ret = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(ret, 1);
+	zassert_equal(events[0].data.u32, 1);
+
+	drain(fds[1]);
+}
+
+ZTEST(zvfs_epoll, test_fired_then_drained)
+{
+	struct zvfs_epoll_event events[NUM_FDS];
+	int ret;
+
+	/* The event fires, but the descriptor is no longer ready when the
+	 * wait checks it: the wait has to keep watching it while blocked.
+	 */
+	zassert_ok(zvfs_eventfd_write(fds[3], 1));
+	drain(fds[3]);
+
+	write_later(fds[3]);
+
+	ret = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(ret, 1, "wakeup lost");
+	zassert_equal(events[0].data.u32, 3);
+
+	drain(fds[3]);
+}
+
+ZTEST(zvfs_epoll, test_level_triggered)
+{
+	struct zvfs_epoll_event events[NUM_FDS];
+
+	zassert_ok(zvfs_eventfd_write(fds[0], 1));
+	zassert_ok(zvfs_eventfd_write(fds[3], 1));
+
+	/* Still ready descriptors are reported again */
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 2);
+	}
+
+	/* A single slot reports them in turn */
+	zassert_equal(zvfs_epoll_wait(epfd, events, 1, 0), 1);
+
+	drain(fds[0]);
+
+	zassert_equal(zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 1);
+	zassert_equal(events[0].data.u32, 3);
+
+	drain(fds[3]);
+
+	zassert_equal(zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 0);
+}
+
+ZTEST(zvfs_epoll, test_ctl)
+{
+	struct zvfs_epoll_event event = {
+		.events = ZVFS_EPOLLIN,
+		.data.u32 = 0,
+	};
+	struct zvfs_epoll_event events[NUM_FDS];
+
+	zassert_equal(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fds[0], &event), -1);
+	zassert_equal(errno, EEXIST);
+	zassert_equal(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, epfd, &event), -1);
+	zassert_equal(errno, EINVAL);
+
+	/* A removed descriptor is no longer reported */
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, fds[0], NULL));
+	zassert_equal(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, fds[0], NULL), -1);
+	zassert_equal(errno, ENOENT);
+
+	zassert_ok(zvfs_eventfd_write(fds[0], 1));
+	zassert_equal(zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 0);
+
+	/* Added back, it is reported with its new data */
+	event.data.u32 = 42;
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fds[0], &event));
+	zassert_equal(zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 1);
+	zassert_equal(events[0].data.u32, 42);
+
+	/* Modified to watch for something else, it is not */
+	event.events = ZVFS_EPOLLOUT;
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_MOD, fds[0], &event));
+	zassert_equal(zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 1);
+	zassert_equal(events[0].events, ZVFS_EPOLLOUT);
+
+	drain(fds[0]);
+	event.events = ZVFS_EPOLLIN;
+	event.data.u32 = 0;
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_MOD, fds[0], &event));
+}
+
+static void before(void *fixture)
+{
+	struct zvfs_epoll_event events[NUM_FDS];
+
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < NUM_FDS; i++) {
+		drain(fds[i]);
+	}
+
+	/* Every descriptor is armed again once nothing is ready */
+	zassert_equal(zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 0);
+}
+
+static void *setup(void)
+{
+	k_work_init_delayable(&write_work, write_handler);
+
+	epfd = zvfs_epoll_create(0);
+	zassert_true(epfd >= 0, "zvfs_epoll_create failed (%d)", errno);
+
+	for (int i = 0; i < NUM_FDS; i++) {
+		struct zvfs_epoll_event event = {
+			.events = ZVFS_EPOLLIN,
+			.data.u32 = i,
+		};
+
+		fds[i] = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+		zassert_true(fds[i] >= 0, "zvfs_eventfd failed (%d)", errno);
+		zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fds[i], &event));
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(zvfs_epoll, NULL, setup, before, NULL, NULL);
@@ -18,6 +18,7 @@
 #define BUFFER_SIZE                    1024
 #define SERVER_IPV4_ADDR               "127.0.0.1"
 #define SERVER_PORT                    8080
+#define SERVER_PORT_2                  8081
 #define TIMEOUT_S                      1
 
 #define UPGRADE_STREAM_ID              1
@@ -250,6 +251,14 @@ struct http_resource_detail_static static_resource_detail = {
 HTTP_RESOURCE_DEFINE(static_resource, test_http_service, "/",
 		     &static_resource_detail);
 
+/* A service taking two clients, to fill it up while the test client is connected */
+static uint16_t test_http_service_2_port = SERVER_PORT_2;
+HTTP_SERVICE_DEFINE(test_http_service_2, SERVER_IPV4_ADDR,
+		    &test_http_service_2_port, 2, 10, NULL, NULL);
+
+HTTP_RESOURCE_DEFINE(static_resource_2, test_http_service_2, "/",
+		     &static_resource_detail);
+
 static uint8_t dynamic_payload[32];
 static size_t dynamic_payload_len = sizeof(dynamic_payload);
 static bool dynamic_error;
@@ -1242,6 +1251,96 @@ ZTEST(server_function_tests, test_http1_connection_close)
 	zassert_equal(ret, 0, "Connection should've been closed");
 }
 
+static int connect_service_2(void)
+{
+	struct sockaddr_in sa = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT_2),
+	};
+	struct timeval optval = {
+		.tv_sec = TIMEOUT_S,
+		.tv_usec = 0,
+	};
+	int fd;
+
+	zassert_equal(zsock_inet_pton(AF_INET, SERVER_IPV4_ADDR, &sa.sin_addr.s_addr), 1);
+
+	fd = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_not_equal(fd, -1, "failed to create client socket (%d)", errno);
+	zassert_ok(zsock_setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &optval, sizeof(optval)));
+	zassert_ok(zsock_connect(fd, (struct sockaddr *)&sa, sizeof(sa)),
+		   "failed to connect to the server (%d)", errno);
+
+	return fd;
+}
+
+static const char service_2_request[] =
+	"GET / HTTP/1.1\r\n"
+	"Host: 127.0.0.1:8081\r\n"
+	"\r\n";
+
+static void send_service_2_request(int fd)
+{
+	int ret;
+
+	ret = zsock_send(fd, service_2_request, strlen(service_2_request), 0);
+	zassert_equal(ret, strlen(service_2_request), "send() failed (%d)", errno);
+}
+
+static void expect_service_2_response(int fd)
+{
+	static const char expected_response[] =
+		"HTTP/1.1 200 OK\r\n"
+		"Content-Type: text/html\r\n"
+		"Content-Length: 13\r\n"
+		"\r\n"
+		TEST_STATIC_PAYLOAD;
+	char response[sizeof(expected_response)];
+	size_t offset = 0;
+	int ret;
+
+	while (offset < sizeof(expected_response) - 1) {
+		ret = zsock_recv(fd, response + offset, sizeof(expected_response) - 1 - offset, 0);
+		zassert_true(ret > 0, "recv() failed (%d)", ret < 0 ? errno : 0);
+		offset += ret;
+	}
+
+	zassert_mem_equal(response, expected_response, sizeof(expected_response) - 1,
+			  "Received data doesn't match expected response");
+}
+
+ZTEST(server_function_tests, test_listener_resumed)
+{
+	char byte;
+	int fds[3];
+	int ret;
+
+	/* With more than one event loop the first client goes to a worker, as
+	 * the test client is served by the server thread, so the listener
+	 * paused by the server thread is resumed by the worker.
+	 */
+	ARRAY_FOR_EACH(fds, i) {
+		fds[i] = connect_service_2();
+		send_service_2_request(fds[i]);
+	}
+
+	expect_service_2_response(fds[0]);
+	expect_service_2_response(fds[1]);
+
+	/* The service is full, so the third client is left in the backlog */
+	k_msleep(100);
+	ret = zsock_recv(fds[2], &byte, 1, ZSOCK_MSG_DONTWAIT);
+	zassert_true(ret < 0 && errno == EAGAIN, "client served beyond the service limit");
+
+	zassert_ok(zsock_close(fds[0]), "close() failed (%d)", errno);
+
+	/* The pending request is answered once the client is accepted */
+	expect_service_2_response(fds[2]);
+
+	zassert_ok(zsock_close(fds[1]), "close() failed (%d)", errno);
+	zassert_ok(zsock_close(fds[2]), "close() failed (%d)", errno);
+}
+
 ZTEST(server_function_tests, test_http2_post_data_with_padding)
 {
 	static const uint8_t request_post_dynamic[] = {
@@ -2495,6 +2594,7 @@ ZTEST(server_function_tests_no_init, test_parse_http_frames)
 
 #include <zephyr/fs/fs.h>
 #include <zephyr/fs/littlefs.h>
+#include <zephyr/sys/crc.h>
 
 FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(storage);
 
@@ -2662,6 +2762,29 @@ int test_mkdir(const char *dir_path, const char *file)
 	return res;
 }
 
+#if defined(CONFIG_HTTP_SERVER_FS_CACHE)
+#define STATIC_FS_ETAG_HEADER "ETag: %s\r\n"
+
+/* The entity tag of the static file, a CRC of its contents */
+static const char *static_fs_etag(void)
+{
+	static char etag[HTTP_SERVER_ETAG_LEN];
+	uint32_t crc = crc32_ieee(TEST_STATIC_FS_PAYLOAD, strlen(TEST_STATIC_FS_PAYLOAD));
+
+	snprintk(etag, sizeof(etag), "\"%08x-%zx\"", (unsigned int)crc,
+		 strlen(TEST_STATIC_FS_PAYLOAD));
+
+	return etag;
+}
+#else
+#define STATIC_FS_ETAG_HEADER "%s"
+
+static const char *static_fs_etag(void)
+{
+	return "";
+}
+#endif /* CONFIG_HTTP_SERVER_FS_CACHE */
+
 static int setup_fs(const char *file_ending)
 {
 	char filename_buf[sizeof(TEST_FILE)+5] = TEST_FILE;
@@ -2669,6 +2792,10 @@ static int setup_fs(const char *file_ending)
 	strcat(filename_buf, file_ending);
 	test_clear_flash();
 
+#if defined(CONFIG_HTTP_SERVER_FS_CACHE)
+	http_server_fs_cache_invalidate();
+#endif
+
 	zassert_equal(test_unmount(), TC_PASS, "Failed to unmount fs");
 	zassert_equal(test_mount(), TC_PASS, "Failed to mount fs");
 
@@ -2683,15 +2810,20 @@ ZTEST(server_function_tests, test_http1_static_fs)
 		"User-Agent: curl/7.68.0\r\n"
 		"Accept: */*\r\n"
 		"\r\n";
-	static const char expected_response[] =
-		"HTTP/1.1 200 OK\r\n"
-		"Content-Length: 30\r\n"
-		"Content-Type: text/html\r\n"
-		"\r\n"
-		TEST_STATIC_FS_PAYLOAD;
+#define HTTP1_STATIC_FS_RESPONSE                                                                   \
+	"HTTP/1.1 200 OK\r\n"                                                                      \
+	"Content-Length: 30\r\n"                                                                   \
+	"Content-Type: text/html\r\n"                                                              \
+	STATIC_FS_ETAG_HEADER                                                                      \
+	"\r\n" TEST_STATIC_FS_PAYLOAD
+	static char expected_response[sizeof(HTTP1_STATIC_FS_RESPONSE) + HTTP_SERVER_ETAG_LEN];
+	int expected_response_size;
 	size_t offset = 0;
 	int ret;
 
+	expected_response_size = sprintf(expected_response, HTTP1_STATIC_FS_RESPONSE,
+					 static_fs_etag());
+
 	ret = setup_fs("");
 	zassert_equal(ret, TC_PASS, "Failed to mount fs");
 
@@ -2700,11 +2832,175 @@ ZTEST(server_function_tests, test_http1_static_fs)
 
 	memset(buf, 0, sizeof(buf));
 
-	test_read_data(&offset, sizeof(expected_response) - 1);
-	zassert_mem_equal(buf, expected_response, sizeof(expected_response) - 1,
+	test_read_data(&offset, expected_response_size);
+	zassert_mem_equal(buf, expected_response, expected_response_size,
 			  "Received data doesn't match expected response");
 }
 
+#if defined(CONFIG_HTTP_SERVER_FS_CACHE)
+ZTEST(server_function_tests, test_http1_static_fs_not_modified)
+{
+#define HTTP1_CONDITIONAL_REQUEST                                                                  \
+	"GET /static_file.html HTTP/1.1\r\n"                                                       \
+	"Host: 127.0.0.1:8080\r\n"                                                                 \
+	"User-Agent: curl/7.68.0\r\n"                                                              \
+	"Accept: */*\r\n"                                                                          \
+	"If-None-Match: %s\r\n"                                                                    \
+	"\r\n"
+#define HTTP1_NOT_MODIFIED_RESPONSE                                                                \
+	"HTTP/1.1 304 Not Modified\r\n"                                                            \
+	STATIC_FS_ETAG_HEADER                                                                      \
+	"\r\n"
+	static char http1_request[sizeof(HTTP1_CONDITIONAL_REQUEST) + HTTP_SERVER_ETAG_LEN];
+	static char expected_response[sizeof(HTTP1_NOT_MODIFIED_RESPONSE) + HTTP_SERVER_ETAG_LEN];
+	int expected_response_size;
+	size_t offset = 0;
+	int ret;
+
+	sprintf(http1_request, HTTP1_CONDITIONAL_REQUEST, static_fs_etag());
+	expected_response_size = sprintf(expected_response, HTTP1_NOT_MODIFIED_RESPONSE,
+					 static_fs_etag());
+
+	ret = setup_fs("");
+	zassert_equal(ret, TC_PASS, "Failed to mount fs");
+
+	ret = zsock_send(client_fd, http1_request, strlen(http1_request), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+
+	memset(buf, 0, sizeof(buf));
+
+	test_read_data(&offset, expected_response_size);
+	zassert_mem_equal(buf, expected_response, expected_response_size,
+			  "Received data doesn't match expected response");
+}
+
+/* Appends a HEADERS frame requesting the static file, with an If-None-Match
+ * header unless if_none_match is NULL.
+ */
+static size_t http2_static_fs_headers_frame(uint8_t *frame, size_t size, int stream_id,
+					    const char *if_none_match)
+{
+	const struct http_header headers[] = {
+		{ .name = ":method", .value = "GET" },
+		{ .name = ":scheme", .value = "http" },
+		{ .name = ":path", .value = "/static_file.html" },
+		{ .name = ":authority", .value = "127.0.0.1:8080" },
+		{ .name = "if-none-match", .value = if_none_match },
+	};
+	size_t count = ARRAY_SIZE(headers) - (if_none_match == NULL ? 1 : 0);
+	struct http_hpack_header_buf header;
+	size_t len = HTTP2_FRAME_HEADER_SIZE;
+	int ret;
+
+	for (size_t i = 0; i < count; i++) {
+		header.name = headers[i].name;
+		header.name_len = strlen(headers[i].name);
+		header.value = headers[i].value;
+		header.value_len = strlen(headers[i].value);
+
+		ret = http_hpack_encode_header(frame + len, size - len, &header);
+		zassert_true(ret > 0, "Failed to encode header");
+		len += ret;
+	}
+
+	sys_put_be24(len - HTTP2_FRAME_HEADER_SIZE, &frame[HTTP2_FRAME_LENGTH_OFFSET]);
+	frame[HTTP2_FRAME_TYPE_OFFSET] = HTTP2_HEADERS_FRAME;
+	frame[HTTP2_FRAME_FLAGS_OFFSET] = HTTP2_FLAG_END_HEADERS | HTTP2_FLAG_END_STREAM;
+	sys_put_be32(stream_id, &frame[HTTP2_FRAME_STREAM_ID_OFFSET]);
+
+	return len;
+}
+
+/* Requests the static file on stream_count streams of a new connection */
+static void send_http2_static_fs_request(const char *if_none_match, int stream_count)
+{
+	static const uint8_t preface[] = {
+		TEST_HTTP2_MAGIC,
+		TEST_HTTP2_SETTINGS,
+		TEST_HTTP2_SETTINGS_ACK,
+	};
+	static const uint8_t goaway[] = {
+		TEST_HTTP2_GOAWAY,
+	};
+	static uint8_t request[256];
+	size_t len = sizeof(preface);
+	int ret;
+
+	memcpy(request, preface, sizeof(preface));
+
+	for (int i = 0; i < stream_count; i++) {
+		len += http2_static_fs_headers_frame(request + len, sizeof(request) - len,
+						     TEST_STREAM_ID_1 + 2 * i, if_none_match);
+	}
+
+	zassert_true(len + sizeof(goaway) <= sizeof(request), "Request too long");
+	memcpy(request + len, goaway, sizeof(goaway));
+	len += sizeof(goaway);
+
+	ret = zsock_send(client_fd, request, len, 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+}
+
+ZTEST(server_function_tests, test_http2_static_fs_cached)
+{
+	const struct http_header expected_headers[] = {
+		{ .name = ":status", .value = "200" },
+		{ .name = "etag", .value = static_fs_etag() },
+	};
+	size_t offset = 0;
+	int ret;
+
+	ret = setup_fs("");
+	zassert_equal(ret, TC_PASS, "Failed to mount fs");
+
+	/* The first stream fills the cache, the second one is served from it */
+	send_http2_static_fs_request(NULL, 2);
+
+	memset(buf, 0, sizeof(buf));
+
+	expect_http2_settings_frame(&offset, false);
+	expect_http2_settings_frame(&offset, true);
+
+	for (int i = 0; i < 2; i++) {
+		expect_http2_headers_frame(&offset, TEST_STREAM_ID_1 + 2 * i,
+					   HTTP2_FLAG_END_HEADERS, expected_headers,
+					   ARRAY_SIZE(expected_headers));
+		expect_http2_data_frame(&offset, TEST_STREAM_ID_1 + 2 * i,
+					TEST_STATIC_FS_PAYLOAD, strlen(TEST_STATIC_FS_PAYLOAD),
+					HTTP2_FLAG_END_STREAM);
+	}
+}
+
+ZTEST(server_function_tests, test_http2_static_fs_not_modified)
+{
+	const struct http_header expected_headers[] = {
+		{ .name = ":status", .value = "304" },
+		{ .name = "etag", .value = static_fs_etag() },
+	};
+	size_t offset = 0;
+	int ret;
+
+	ret = setup_fs("");
+	zassert_equal(ret, TC_PASS, "Failed to mount fs");
+
+	send_http2_static_fs_request(static_fs_etag(), 2);
+
+	memset(buf, 0, sizeof(buf));
+
+	expect_http2_settings_frame(&offset, false);
+	expect_http2_settings_frame(&offset, true);
+
+	/* Both on a cache miss and on a hit only the headers are sent, so the
+	 * headers of the second stream directly follow those of the first one.
+	 */
+	for (int i = 0; i < 2; i++) {
+		expect_http2_headers_frame(&offset, TEST_STREAM_ID_1 + 2 * i,
+					   HTTP2_FLAG_END_HEADERS | HTTP2_FLAG_END_STREAM,
+					   expected_headers, ARRAY_SIZE(expected_headers));
+	}
+}
+#endif /* CONFIG_HTTP_SERVER_FS_CACHE */
+
 ZTEST(server_function_tests, test_http1_static_fs_compression)
 {
 #define HTTP1_COMPRESSION_REQUEST                                                                  \
@@ -2719,13 +3015,14 @@ ZTEST(server_function_tests, test_http1_static_fs_compression)
 	"Content-Length: 30\r\n"                                                                   \
 	"Content-Type: text/html\r\n"                                                              \
 	"Content-Encoding: %s\r\n"                                                                 \
+	STATIC_FS_ETAG_HEADER                                                                      \
 	"\r\n" TEST_STATIC_FS_PAYLOAD
 
 	static const char mixed_compression_str[] = "gzip, deflate, br";
 	static char http1_request[sizeof(HTTP1_COMPRESSION_REQUEST) +
 				  ARRAY_SIZE(mixed_compression_str)] = {0};
 	static char expected_response[sizeof(HTTP1_COMPRESSION_RESPONSE) +
-				      HTTP_COMPRESSION_MAX_STRING_LEN] = {0};
+				      HTTP_COMPRESSION_MAX_STRING_LEN + HTTP_SERVER_ETAG_LEN] = {0};
 	static const char *const file_ending_map[] = {[HTTP_GZIP] = ".gz",
 						      [HTTP_COMPRESS] = ".lzw",
 						      [HTTP_DEFLATE] = ".zz",
@@ -2747,7 +3044,7 @@ ZTEST(server_function_tests, test_http1_static_fs_compression)
 
 		sprintf(http1_request, HTTP1_COMPRESSION_REQUEST, http_compression_text(i));
 		expected_response_size = sprintf(expected_response, HTTP1_COMPRESSION_RESPONSE,
-						 http_compression_text(i));
+						 http_compression_text(i), static_fs_etag());
 
 		ret = setup_fs(file_ending_map[i]);
 		zassert_equal(ret, TC_PASS, "Failed to mount fs");
@@ -2766,7 +3063,7 @@ ZTEST(server_function_tests, test_http1_static_fs_compression)
 	TC_PRINT("Testing mixed compression...\n");
 	sprintf(http1_request, HTTP1_COMPRESSION_REQUEST, mixed_compression_str);
 	expected_response_size = sprintf(expected_response, HTTP1_COMPRESSION_RESPONSE,
-					 http_compression_text(HTTP_BR));
+					 http_compression_text(HTTP_BR), static_fs_etag());
 	ret = setup_fs(file_ending_map[HTTP_BR]);
 	zassert_equal(ret, TC_PASS, "Failed to mount fs");
 
@@ -2502,6 +2502,69 @@ ZTEST(net_socket_tcp, test_keepalive_timeout)
 	test_context_cleanup();
 }
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZERO_COPY)
+ZTEST(net_socket_tcp, test_v4_recv_zero_copy)
+{
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	static char rx_buf[sizeof(TEST_STR_LONG)];
+	struct net_buf *frags;
+	size_t total = 0;
+	int ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_send(c_sock, TEST_STR_LONG, strlen(TEST_STR_LONG), 0);
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	ret = zsock_recv_zc(new_sock, &frags, ZSOCK_MSG_PEEK);
+	zassert_equal(ret, -1, "MSG_PEEK should not be supported");
+	zassert_equal(errno, EINVAL, "Unexpected errno %d", errno);
+
+	while (total < strlen(TEST_STR_LONG)) {
+		ret = zsock_recv_zc(new_sock, &frags, 0);
+		zassert_true(ret > 0, "recv_zc failed (%d)", errno);
+		zassert_not_null(frags, "No data returned");
+		zassert_equal(net_buf_frags_len(frags), ret, "Length mismatch");
+		zassert_true(total + ret <= strlen(TEST_STR_LONG), "Too much data");
+
+		net_buf_linearize(rx_buf + total, sizeof(rx_buf) - total, frags, 0, ret);
+		total += ret;
+
+		zassert_ok(zsock_recv_zc_release(new_sock, frags), "release failed");
+	}
+
+	zassert_mem_equal(rx_buf, TEST_STR_LONG, strlen(TEST_STR_LONG),
+			  "Invalid data received");
+
+	ret = zsock_recv_zc(new_sock, &frags, ZSOCK_MSG_DONTWAIT);
+	zassert_equal(ret, -1, "No data should be pending");
+	zassert_equal(errno, EAGAIN, "Unexpected errno %d", errno);
+
+	test_close(c_sock);
+
+	ret = zsock_recv_zc(new_sock, &frags, 0);
+	zassert_equal(ret, 0, "EOF not detected");
+	zassert_is_null(frags, "Data returned at EOF");
+
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZERO_COPY */
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
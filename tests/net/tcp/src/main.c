@@ -115,6 +115,8 @@ static enum test_case_no {
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
 	TEST_CLIENT_SEQ_VALIDATION = 19,
+	TEST_SERVER_SACK_TIMESTAMPS = 20,
+	TEST_SERVER_SACK_RECOVERY = 21,
 } test_case_no;
 
 static enum test_state t_state;
@@ -140,6 +142,10 @@ static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *t
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
 static void handle_client_seq_validation_test(sa_family_t af, struct tcphdr *th);
+static void handle_server_sack_timestamps_test(struct net_pkt *pkt,
+					       struct tcphdr *th);
+static void handle_server_sack_recovery_test(struct net_pkt *pkt,
+					     struct tcphdr *th);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -237,6 +243,10 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* Options of every segment sent in the SACK recovery test */
+static uint8_t peer_opts[40];
+static uint8_t peer_opts_len;
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -247,11 +257,17 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
+	const uint8_t *opts = NULL;
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4 ||
+	     test_case_no == TEST_SERVER_SACK_TIMESTAMPS) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if (test_case_no == TEST_SERVER_SACK_RECOVERY) {
+		opts = peer_opts;
+		opts_len = peer_opts_len;
 	}
 
 	/* Allocate buffer */
@@ -286,14 +302,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
-
+	th->th_off = 5U + opts_len / 4U;
 	th->th_flags = flags;
-	th->th_win = NET_IPV6_MTU;
+	th->th_win = htons(NET_IPV6_MTU);
 	th->th_seq = htonl(seq);
 
 	if (ACK & flags) {
@@ -305,9 +316,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len > 0) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -489,6 +500,12 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_SEQ_VALIDATION:
 		handle_client_seq_validation_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_SERVER_SACK_TIMESTAMPS:
+		handle_server_sack_timestamps_test(pkt, &th);
+		break;
+	case TEST_SERVER_SACK_RECOVERY:
+		handle_server_sack_recovery_test(pkt, &th);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -764,6 +781,8 @@ static void test_server_timeout(struct k_work *work)
 {
 	if (test_case_no == TEST_SERVER_IPV4 ||
 	    test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4 ||
+	    test_case_no == TEST_SERVER_SACK_TIMESTAMPS ||
+	    test_case_no == TEST_SERVER_SACK_RECOVERY ||
 	    test_case_no == TEST_SERVER_RST_ON_CLOSED_PORT ||
 	    test_case_no == TEST_SERVER_RST_ON_LISTENING_PORT_NO_ACTIVE_CONNECTION) {
 		handle_server_test(AF_INET, NULL);
@@ -2856,4 +2875,519 @@ ZTEST(net_tcp, test_client_seq_validation)
 	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
 }
 
+static bool syn_ack_sack_perm;
+static bool syn_ack_ts_echo;
+
+/* Parse the options of the SYN ACK and remember whether the SACK permitted
+ * option was present and whether our timestamp was echoed back.
+ */
+static void check_syn_ack_options(struct net_pkt *pkt, struct tcphdr *th)
+{
+	uint8_t opts[40];
+	size_t opts_len = (th_off(th) - 5) * 4;
+	size_t i = 0;
+	int ret;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	ret = net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) +
+			   net_pkt_ip_opts_len(pkt) + sizeof(struct tcphdr));
+	zassert_equal(ret, 0, "Cannot skip to the TCP options");
+
+	ret = net_pkt_read(pkt, opts, opts_len);
+	zassert_equal(ret, 0, "Cannot read the TCP options");
+
+	while (i < opts_len) {
+		if (opts[i] == NET_TCP_END_OPT) {
+			break;
+		}
+
+		if (opts[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		zassert_true(i + 1 < opts_len, "Truncated option");
+
+		if (opts[i] == NET_TCP_SACK_PERM_OPT) {
+			syn_ack_sack_perm = true;
+		} else if (opts[i] == NET_TCP_TIMESTAMP_OPT) {
+			/* Echo of the TSval sent in tcp_options */
+			syn_ack_ts_echo = (sys_get_be32(&opts[i + 6]) == 0xc27bef0f);
+		}
+
+		i += opts[i + 1];
+	}
+
+	net_pkt_cursor_init(pkt);
+}
+
+static void handle_server_sack_timestamps_test(struct net_pkt *pkt,
+					       struct tcphdr *th)
+{
+	if (t_state == T_SYN_ACK) {
+		check_syn_ack_options(pkt, th);
+	}
+
+	handle_server_test(net_pkt_family(pkt), th);
+}
+
+/* Test case scenario IPv4
+ *   Expect SYN with SACK permitted and timestamp options
+ *   send SYN ACK with SACK permitted and echoed timestamp,
+ *   expect ACK,
+ *   expect DATA,
+ *   send ACK,
+ *   expect FIN,
+ *   send FIN ACK,
+ *   expect ACK.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_server_sack_timestamps)
+{
+	struct net_context *ctx;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK) ||
+	    !IS_ENABLED(CONFIG_NET_TCP_TIMESTAMPS)) {
+		ztest_test_skip();
+	}
+
+	t_state = T_SYN;
+	test_case_no = TEST_SERVER_SACK_TIMESTAMPS;
+	seq = ack = 0;
+	syn_ack_sack_perm = false;
+	syn_ack_ts_echo = false;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	if (ret < 0) {
+		zassert_true(false, "Failed to get net_context");
+	}
+
+	net_context_ref(ctx);
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&my_addr_s,
+			       sizeof(struct sockaddr_in));
+	if (ret < 0) {
+		zassert_true(false, "Failed to bind net_context");
+	}
+
+	ret = net_context_listen(ctx, 1);
+	if (ret < 0) {
+		zassert_true(false, "Failed to listen on net_context");
+	}
+
+	/* Trigger the peer to send SYN */
+	k_work_reschedule(&test_server, K_NO_WAIT);
+
+	ret = net_context_accept(ctx, test_tcp_accept_cb, K_FOREVER, NULL);
+	if (ret < 0) {
+		zassert_true(false, "Failed to set accept on net_context");
+	}
+
+	/* test_tcp_accept_cb will release the semaphore after successful
+	 * connection.
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	zassert_true(syn_ack_sack_perm, "SYN ACK without SACK permitted");
+	zassert_true(syn_ack_ts_echo, "SYN ACK without timestamp echo");
+
+	/* Trigger the peer to send DATA  */
+	k_work_reschedule(&test_server, K_NO_WAIT);
+
+	ret = net_context_recv(accepted_ctx, test_tcp_recv_cb, K_MSEC(200), NULL);
+	if (ret < 0) {
+		zassert_true(false, "Failed to recv data from peer");
+	}
+
+	/* Trigger the peer to send FIN after timeout */
+	k_work_reschedule(&test_server, K_NO_WAIT);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+/* Payload of the segments sent by the stack in the SACK recovery test,
+ * which is what the MSS announced by the peer leaves next to the
+ * timestamp option.
+ */
+#define SACK_SEG_LEN 100
+#define SACK_PEER_MSS (SACK_SEG_LEN + 2 * NET_TCP_NOP_SIZE + NET_TCP_TIMESTAMP_SIZE)
+#define SACK_RTT_MS 2000
+
+static uint32_t peer_tsval;
+static uint32_t sack_base;
+
+static struct {
+	uint32_t seq;
+	size_t len;
+} sent_segs[8];
+static int sent_count;
+
+/* Build the options of the next segment sent to the stack, with the SACK
+ * blocks given relative to sack_base.
+ */
+static void set_peer_options(bool syn, uint32_t tsval, uint32_t tsecr,
+			     const struct tcp_sack_block *sack, int sack_count)
+{
+	uint8_t len = 0;
+
+	if (syn) {
+		peer_opts[len++] = NET_TCP_MSS_OPT;
+		peer_opts[len++] = NET_TCP_MSS_SIZE;
+		sys_put_be16(SACK_PEER_MSS, &peer_opts[len]);
+		len += sizeof(uint16_t);
+		peer_opts[len++] = NET_TCP_NOP_OPT;
+		peer_opts[len++] = NET_TCP_NOP_OPT;
+		peer_opts[len++] = NET_TCP_SACK_PERM_OPT;
+		peer_opts[len++] = NET_TCP_SACK_PERM_SIZE;
+	}
+
+	peer_opts[len++] = NET_TCP_NOP_OPT;
+	peer_opts[len++] = NET_TCP_NOP_OPT;
+	peer_opts[len++] = NET_TCP_TIMESTAMP_OPT;
+	peer_opts[len++] = NET_TCP_TIMESTAMP_SIZE;
+	sys_put_be32(tsval, &peer_opts[len]);
+	len += sizeof(uint32_t);
+	sys_put_be32(tsecr, &peer_opts[len]);
+	len += sizeof(uint32_t);
+
+	if (sack_count > 0) {
+		peer_opts[len++] = NET_TCP_NOP_OPT;
+		peer_opts[len++] = NET_TCP_NOP_OPT;
+		peer_opts[len++] = NET_TCP_SACK_OPT;
+		peer_opts[len++] = 2 + sack_count * NET_TCP_SACK_BLOCK_SIZE;
+
+		for (int i = 0; i < sack_count; i++) {
+			sys_put_be32(sack_base + sack[i].start, &peer_opts[len]);
+			len += sizeof(uint32_t);
+			sys_put_be32(sack_base + sack[i].end, &peer_opts[len]);
+			len += sizeof(uint32_t);
+		}
+	}
+
+	peer_opts_len = len;
+}
+
+/* Complete the handshake, then record the data segments sent by the stack */
+static void handle_server_sack_recovery_test(struct net_pkt *pkt,
+					     struct tcphdr *th)
+{
+	size_t len;
+
+	if (t_state == T_SYN_ACK) {
+		set_peer_options(false, ++peer_tsval, 0, NULL, 0);
+		handle_server_test(net_pkt_family(pkt), th);
+		return;
+	}
+
+	len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+	      net_pkt_ip_opts_len(pkt) - th_off(th) * 4;
+
+	if (len > 0 && sent_count < ARRAY_SIZE(sent_segs)) {
+		sent_segs[sent_count].seq = ntohl(th->th_seq);
+		sent_segs[sent_count].len = len;
+		sent_count++;
+	}
+}
+
+#if defined(CONFIG_NET_TCP_SACK) && defined(CONFIG_NET_TCP_TIMESTAMPS) && \
+	defined(CONFIG_NET_TCP_FAST_RETRANSMIT) && \
+	!defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+/* Acknowledge the data up to sack_base + acked */
+static void send_sack_ack(uint32_t acked, uint32_t tsecr,
+			  const struct tcp_sack_block *sack, int sack_count)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	ack = sack_base + acked;
+	set_peer_options(false, ++peer_tsval, tsecr, sack, sack_count);
+
+	pkt = prepare_ack_packet(AF_INET, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(10);
+}
+
+static void send_sack_data(uint32_t tsval)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	set_peer_options(false, tsval, 0, NULL, 0);
+
+	pkt = prepare_data_packet(AF_INET, htons(MY_PORT), htons(PEER_PORT),
+				  "B", 1U);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(10);
+}
+
+static void check_sent_seg(int i, uint32_t offset, size_t len)
+{
+	zassert_true(i < sent_count, "Segment %d not sent", i);
+	zassert_equal(sent_segs[i].seq, sack_base + offset,
+		      "Segment %d sent at offset %d instead of %u", i,
+		      (int)(sent_segs[i].seq - sack_base), offset);
+	zassert_equal(sent_segs[i].len, len,
+		      "Segment %d has %zu bytes instead of %zu", i,
+		      sent_segs[i].len, len);
+}
+
+static void check_sacked(int i, uint32_t start, uint32_t end)
+{
+	struct tcp *conn = accepted_ctx->tcp;
+
+	zassert_true(i < conn->sacked_count, "SACK range %d missing", i);
+	zassert_equal(conn->sacked[i].start, sack_base + start,
+		      "SACK range %d starts at %d instead of %u", i,
+		      (int)(conn->sacked[i].start - sack_base), start);
+	zassert_equal(conn->sacked[i].end, sack_base + end,
+		      "SACK range %d ends at %d instead of %u", i,
+		      (int)(conn->sacked[i].end - sack_base), end);
+}
+
+static void run_sack_recovery(void)
+{
+	static const struct tcp_sack_block seg1[] = {
+		{ SACK_SEG_LEN, 2 * SACK_SEG_LEN },
+	};
+	static const struct tcp_sack_block seg2[] = {
+		{ 2 * SACK_SEG_LEN, 3 * SACK_SEG_LEN },
+	};
+	static const struct tcp_sack_block seg3_seg1[] = {
+		{ 3 * SACK_SEG_LEN, 4 * SACK_SEG_LEN },
+		{ SACK_SEG_LEN, 2 * SACK_SEG_LEN },
+	};
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	struct tcp *conn;
+	uint32_t rcv_nxt;
+	int drop_before;
+	int rst_before;
+	int ret;
+
+	t_state = T_SYN;
+	test_case_no = TEST_SERVER_SACK_RECOVERY;
+	seq = ack = 0;
+	sent_count = 0;
+	set_peer_options(true, ++peer_tsval, 0, NULL, 0);
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	if (ret < 0) {
+		zassert_true(false, "Failed to get net_context");
+	}
+
+	net_context_ref(ctx);
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&my_addr_s,
+			       sizeof(struct sockaddr_in));
+	if (ret < 0) {
+		zassert_true(false, "Failed to bind net_context");
+	}
+
+	ret = net_context_listen(ctx, 1);
+	if (ret < 0) {
+		zassert_true(false, "Failed to listen on net_context");
+	}
+
+	/* Trigger the peer to send SYN */
+	k_work_reschedule(&test_server, K_NO_WAIT);
+
+	ret = net_context_accept(ctx, test_tcp_accept_cb, K_FOREVER, NULL);
+	if (ret < 0) {
+		zassert_true(false, "Failed to set accept on net_context");
+	}
+
+	/* test_tcp_accept_cb will release the semaphore after successful
+	 * connection.
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	conn = accepted_ctx->tcp;
+	zassert_true(conn->sack_ok, "SACK not negotiated");
+	zassert_true(conn->ts_ok, "Timestamps not negotiated");
+	zassert_equal(conn->srtt, 0U, "RTT measured without data");
+
+	/* The RTT is measured from the timestamp echoed by an ACK of new
+	 * data. The long RTO it gives keeps the data below from being
+	 * resent on timeout.
+	 */
+	sack_base = ack;
+
+	ret = net_context_send(accepted_ctx, "A", 1, NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, 1, "Failed to send data to peer (%d)", ret);
+	k_msleep(10);
+	check_sent_seg(0, 0, 1);
+
+	send_sack_ack(1, k_uptime_get_32() - SACK_RTT_MS, NULL, 0);
+
+	zassert_true((conn->srtt >> 3) >= SACK_RTT_MS, "SRTT not updated");
+	zassert_equal(conn->rttvar, conn->srtt >> 2, "RTTVAR not updated");
+	zassert_equal(conn->rto, (conn->srtt >> 3) + conn->rttvar,
+		      "RTO not derived from the RTT");
+
+	sack_base = ack;
+	sent_count = 0;
+
+	ret = net_context_send(accepted_ctx, lorem_ipsum, 4 * SACK_SEG_LEN,
+			       NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, 4 * SACK_SEG_LEN,
+		      "Failed to send data to peer (%d)", ret);
+	k_msleep(10);
+
+	for (int i = 0; i < 4; i++) {
+		check_sent_seg(i, i * SACK_SEG_LEN, SACK_SEG_LEN);
+	}
+
+	/* The first segment is lost, the duplicate ACKs SACK the second one */
+	send_sack_ack(0, 0, seg1, ARRAY_SIZE(seg1));
+	zassert_equal(conn->sacked_count, 1, "SACK range not added");
+	check_sacked(0, SACK_SEG_LEN, 2 * SACK_SEG_LEN);
+
+	send_sack_ack(0, 0, seg1, ARRAY_SIZE(seg1));
+	zassert_equal(conn->sacked_count, 1, "SACK range added twice");
+	zassert_equal(sent_count, 4, "Data resent before the third duplicate ACK");
+
+	/* Fast retransmit of the hole below the SACKed segment */
+	send_sack_ack(0, 0, seg1, ARRAY_SIZE(seg1));
+	zassert_true(conn->sack_recovery, "SACK recovery not started");
+	check_sent_seg(4, 0, SACK_SEG_LEN);
+	zassert_equal(sent_count, 5, "More than the hole resent");
+
+	/* The third segment is lost too, a further duplicate ACK resends it */
+	send_sack_ack(0, 0, seg3_seg1, ARRAY_SIZE(seg3_seg1));
+	zassert_equal(conn->sacked_count, 2, "SACK range not added");
+	check_sacked(0, SACK_SEG_LEN, 2 * SACK_SEG_LEN);
+	check_sacked(1, 3 * SACK_SEG_LEN, 4 * SACK_SEG_LEN);
+	check_sent_seg(5, 2 * SACK_SEG_LEN, SACK_SEG_LEN);
+	zassert_equal(sent_count, 6, "More than the hole resent");
+
+	/* The resent segment joins the SACKed ranges, nothing is left to resend */
+	send_sack_ack(0, 0, seg2, ARRAY_SIZE(seg2));
+	zassert_equal(conn->sacked_count, 1, "SACK ranges not merged");
+	check_sacked(0, SACK_SEG_LEN, 4 * SACK_SEG_LEN);
+	zassert_equal(sent_count, 6, "Data resent twice");
+
+	/* The cumulative ACK of the resent first segment prunes the range */
+	send_sack_ack(2 * SACK_SEG_LEN, 0, NULL, 0);
+	zassert_equal(conn->sacked_count, 1, "SACK range pruned");
+	check_sacked(0, 2 * SACK_SEG_LEN, 4 * SACK_SEG_LEN);
+	zassert_true(conn->sack_recovery, "SACK recovery ended early");
+
+	/* A block below the cumulative ACK is ignored */
+	send_sack_ack(2 * SACK_SEG_LEN, 0, seg1, ARRAY_SIZE(seg1));
+	zassert_equal(conn->sacked_count, 1, "Acknowledged SACK range added");
+	check_sacked(0, 2 * SACK_SEG_LEN, 4 * SACK_SEG_LEN);
+
+	/* The recovery ends once all the data sent before it is acknowledged */
+	send_sack_ack(4 * SACK_SEG_LEN, 0, NULL, 0);
+	zassert_equal(conn->sacked_count, 0, "SACK range not pruned");
+	zassert_false(conn->sack_recovery, "SACK recovery not ended");
+	zassert_equal(sent_count, 6, "Data resent after the recovery");
+
+	/* PAWS: a segment with an older timestamp than the last one is
+	 * dropped, the same segment with a newer timestamp is received.
+	 */
+	drop_before = GET_STAT(net_iface, tcp.seg_drop);
+	rcv_nxt = conn->ack;
+
+	send_sack_data(peer_tsval - 1);
+	zassert_equal(GET_STAT(net_iface, tcp.seg_drop), drop_before + 1,
+		      "Segment with an old timestamp not dropped");
+	zassert_equal(conn->ack, rcv_nxt, "Data with an old timestamp received");
+
+	send_sack_data(++peer_tsval);
+	zassert_equal(conn->ack, rcv_nxt + 1, "Data with a new timestamp dropped");
+	zassert_equal(conn->ts_recent, peer_tsval, "Timestamp to echo not updated");
+	seq++;
+
+	/* The MSS announced in the SYN still sizes the segments sent after
+	 * all the segments with timestamps but without MSS.
+	 */
+	sack_base = ack;
+	sent_count = 0;
+
+	ret = net_context_send(accepted_ctx, lorem_ipsum, 2 * SACK_SEG_LEN,
+			       NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, 2 * SACK_SEG_LEN,
+		      "Failed to send data to peer (%d)", ret);
+	k_msleep(10);
+
+	check_sent_seg(0, 0, SACK_SEG_LEN);
+	check_sent_seg(1, SACK_SEG_LEN, SACK_SEG_LEN);
+	zassert_equal(sent_count, 2, "Data not sent in MSS sized segments");
+
+	send_sack_ack(2 * SACK_SEG_LEN, 0, NULL, 0);
+
+	/* A RST is not subject to PAWS, so one with an old timestamp
+	 * resets the connection.
+	 */
+	drop_before = GET_STAT(net_iface, tcp.seg_drop);
+	rst_before = GET_STAT(net_iface, tcp.rst);
+	set_peer_options(false, peer_tsval - 1, 0, NULL, 0);
+
+	pkt = prepare_rst_packet(AF_INET, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	zassert_equal(GET_STAT(net_iface, tcp.seg_drop), drop_before,
+		      "RST with an old timestamp dropped");
+	zassert_equal(GET_STAT(net_iface, tcp.rst), rst_before + 1,
+		      "RST with an old timestamp ignored");
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+
+	/* Let other threads run (so the TCP context is actually freed) */
+	k_msleep(10);
+}
+#endif
+
+/* Test case scenario IPv4
+ *   Open a connection with SACK and timestamps,
+ *   measure the RTT from an ACK of new data,
+ *   expect four segments of data,
+ *   send three duplicate ACKs SACKing the second segment,
+ *   expect the first segment to be resent,
+ *   send a duplicate ACK SACKing the fourth segment,
+ *   expect the third segment to be resent,
+ *   send ACKs of the resent data and of all the data,
+ *   send data with an old timestamp, expect it to be dropped,
+ *   send the data again with a new timestamp, expect it to be received,
+ *   expect more data in segments sized by the MSS of the SYN,
+ *   send a RST with an old timestamp, expect it to reset the connection.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_server_sack_recovery)
+{
+	/* Without congestion avoidance, all the segments are sent at once */
+#if defined(CONFIG_NET_TCP_SACK) && defined(CONFIG_NET_TCP_TIMESTAMPS) && \
+	defined(CONFIG_NET_TCP_FAST_RETRANSMIT) && \
+	!defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+	run_sack_recovery();
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
@@ -962,6 +962,88 @@ ZTEST_F(nvs, test_nvs_cache_hash_quality)
 #endif
 }
 
+/*
+ * Test that NVS lookup index finds every ID, including when more IDs are
+ * written than the index can hold, and that it is properly rebuilt on
+ * nvs_mount() and maintained across deletes and gc.
+ */
+ZTEST_F(nvs, test_nvs_index)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	const uint16_t num_ids = CONFIG_NVS_LOOKUP_INDEX_SIZE + 8;
+	int err;
+	ssize_t len;
+	uint16_t data;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	zassert_true(fixture->fs.lookup_index_complete, "empty index not complete");
+
+	/* Write more IDs than fit in the index, delete every other one */
+
+	for (uint16_t id = 0; id < num_ids; id++) {
+		data = id;
+		err = nvs_write(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	}
+	zassert_false(fixture->fs.lookup_index_complete, "overflowed index complete");
+
+	for (uint16_t id = 0; id < num_ids; id += 2) {
+		err = nvs_delete(&fixture->fs, id);
+		zassert_true(err == 0, "nvs_delete call failure: %d", err);
+	}
+
+	for (int pass = 0; pass < 2; pass++) {
+		for (uint16_t id = 0; id < num_ids; id++) {
+			data = 0xffff;
+			len = nvs_read(&fixture->fs, id, &data, sizeof(data));
+			if (id % 2 == 0) {
+				zassert_equal(len, -ENOENT, "deleted id %u found", id);
+			} else {
+				zassert_equal(len, sizeof(data), "nvs_read failure: %d", (int)len);
+				zassert_equal(data, id, "wrong data for id %u", id);
+			}
+		}
+
+		len = nvs_read(&fixture->fs, num_ids, &data, sizeof(data));
+		zassert_equal(len, -ENOENT, "unwritten id found");
+
+		/* Run the same checks on an index rebuilt from flash */
+		memset(fixture->fs.lookup_index_id, 0xAA, sizeof(fixture->fs.lookup_index_id));
+		err = nvs_mount(&fixture->fs);
+		zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	}
+
+	/* Rewrite a single ID until every sector has been gc-ed at least once */
+
+	err = nvs_clear(&fixture->fs);
+	zassert_true(err == 0, "nvs_clear call failure: %d", err);
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	data = 1;
+	err = nvs_write(&fixture->fs, 1, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	err = nvs_delete(&fixture->fs, 1);
+	zassert_true(err == 0, "nvs_delete call failure: %d", err);
+
+	for (uint32_t i = 0; i < 3 * fixture->fs.sector_size / sizeof(struct nvs_ate); i++) {
+		data = i;
+		err = nvs_write(&fixture->fs, 2, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	}
+
+	zassert_true(fixture->fs.lookup_index_complete, "index not complete");
+	len = nvs_read(&fixture->fs, 1, &data, sizeof(data));
+	zassert_equal(len, -ENOENT, "gc-ed deleted id found");
+	len = nvs_read(&fixture->fs, 2, &data, sizeof(data));
+	zassert_equal(len, sizeof(data), "nvs_read failure: %d", (int)len);
+#else
+	ztest_test_skip();
+#endif
+}
+
 #ifdef CONFIG_TEST_NVS_SIMULATOR
 /*
  * Test NVS bad region initialization recovery.
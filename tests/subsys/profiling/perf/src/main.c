@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/shell/shell_dummy.h>
+#include <zephyr/ztest.h>
+
+#define THREAD_NAME "perf_busy"
+
+/* perf record <duration ms> <frequency Hz> */
+#define RECORD_MS 300
+#define RECORD_HZ 99
+
+#define RECURSE_DEPTH 4
+
+static const char *perf_cmd(const char *cmd)
+{
+	const struct shell *sh = shell_backend_dummy_get_ptr();
+	size_t size;
+
+	shell_backend_dummy_clear_output(sh);
+	zassert_ok(shell_execute_cmd(sh, cmd), "%s failed", cmd);
+
+	return shell_backend_dummy_get_output(sh, &size);
+}
+
+static void __noinline perf_busy_loop(void)
+{
+	k_busy_wait(USEC_PER_MSEC);
+}
+
+static volatile int perf_recurse_calls;
+
+static void __noinline perf_recurse(int depth)
+{
+	if (depth == 0) {
+		perf_busy_loop();
+	} else {
+		perf_recurse(depth - 1);
+	}
+
+	/* Keep the recursive call from becoming a tail call */
+	perf_recurse_calls++;
+}
+
+static void perf_record_loop(void (*busy)(void))
+{
+	int64_t end;
+
+	perf_cmd("perf clear");
+	perf_cmd("perf record " STRINGIFY(RECORD_MS) " " STRINGIFY(RECORD_HZ));
+
+	end = k_uptime_get() + RECORD_MS;
+	while (k_uptime_get() < end) {
+		busy();
+	}
+
+	/* Let the work item stop the timer */
+	k_msleep(50);
+}
+
+static void perf_record(void)
+{
+	perf_record_loop(perf_busy_loop);
+}
+
+static void perf_recurse_busy(void)
+{
+	perf_recurse(RECURSE_DEPTH);
+}
+
+/* Return the first frame repeated RECURSE_DEPTH times in a row */
+static const char *perf_repeated_frame(const char *out, char *frame, size_t size)
+{
+	const char *prev = NULL;
+	size_t prev_len = 0;
+	int repeats = 0;
+
+	for (const char *p = out; *p != '\0'; p++) {
+		size_t len;
+
+		if (*p == '\n') {
+			prev = NULL;
+			continue;
+		}
+
+		if (*p != ';') {
+			continue;
+		}
+
+		len = strcspn(p + 1, "; \r\n");
+		if (prev != NULL && prev_len == len && strncmp(prev, p + 1, len) == 0) {
+			repeats++;
+		} else {
+			prev = p + 1;
+			prev_len = len;
+			repeats = 1;
+		}
+
+		if (repeats == RECURSE_DEPTH && prev_len < size) {
+			memcpy(frame, prev, prev_len);
+			frame[prev_len] = '\0';
+			return frame;
+		}
+	}
+
+	return NULL;
+}
+
+ZTEST(perf, test_folded)
+{
+	const char *out;
+
+	perf_record();
+
+	out = perf_cmd("perf folded");
+	zassert_not_null(strstr(out, THREAD_NAME ";"), "no stack of " THREAD_NAME ":\n%s", out);
+
+	if (IS_ENABLED(CONFIG_SYMTAB)) {
+		zassert_not_null(strstr(out, ";perf_busy_loop"), "perf_busy_loop not sampled:\n%s",
+				 out);
+	} else {
+		zassert_not_null(strstr(out, ";0x"), "no return addresses:\n%s", out);
+	}
+}
+
+ZTEST(perf, test_folded_recursion)
+{
+	char frame[64];
+	const char *out;
+
+	perf_record_loop(perf_recurse_busy);
+
+	/* The recursive calls return to the same address, every one of them
+	 * is a frame of the stack.
+	 */
+	out = perf_cmd("perf folded");
+	zassert_not_null(perf_repeated_frame(out, frame, sizeof(frame)),
+			 "recursion collapsed:\n%s", out);
+
+	if (IS_ENABLED(CONFIG_SYMTAB)) {
+		zassert_str_equal(frame, "perf_recurse", "%s repeated:\n%s", frame, out);
+	}
+}
+
+ZTEST(perf, test_threads)
+{
+	const char *out;
+	const char *line;
+	unsigned int samples;
+
+	perf_record();
+
+	out = perf_cmd("perf threads");
+	line = strstr(out, THREAD_NAME);
+	zassert_not_null(line, THREAD_NAME " not listed:\n%s", out);
+
+	/* The thread was busy for the whole recording */
+	samples = strtoul(line + strlen(THREAD_NAME), NULL, 10);
+	zassert_true(samples > RECORD_HZ * RECORD_MS / MSEC_PER_SEC / 2, "%u samples:\n%s",
+		     samples, out);
+}
+
+ZTEST(perf, test_info)
+{
+	const char *out;
+
+	perf_record();
+
+	out = perf_cmd("perf info");
+	zassert_not_null(strstr(out, "dropped: 0"), "samples dropped:\n%s", out);
+}
+
+static void perf_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_thread_name_set(k_current_get(), THREAD_NAME);
+}
+
+ZTEST_SUITE(perf, NULL, NULL, perf_before, NULL, NULL);
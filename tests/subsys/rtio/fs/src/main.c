@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <ff.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/fs.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/ztest.h>
+
+#define TEST_FILE "/RAM:/rtio.txt"
+#define BLOCK_SIZE 16
+
+RTIO_DEFINE_WITH_MEMPOOL(r_fs, 4, 4, 4, BLOCK_SIZE, 4);
+
+RTIO_FS_IODEV_DEFINE(file_iodev);
+
+static FATFS fat_fs;
+static struct fs_mount_t fatfs_mnt = {
+	.type = FS_FATFS,
+	.mnt_point = "/RAM:",
+	.fs_data = &fat_fs,
+};
+
+static struct fs_file_t file;
+
+static const char content[] = "The quick brown fox jumps over the lazy dog";
+
+static void *setup(void)
+{
+	zassert_ok(fs_mount(&fatfs_mnt));
+
+	return NULL;
+}
+
+static void before(void *unused)
+{
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, TEST_FILE, FS_O_CREATE | FS_O_RDWR));
+	zassert_ok(fs_truncate(&file, 0));
+	rtio_fs_attach(&file_iodev, &file);
+}
+
+static void after(void *unused)
+{
+	fs_close(&file);
+}
+
+ZTEST_SUITE(rtio_fs, NULL, setup, before, after, NULL);
+
+ZTEST(rtio_fs, test_write_read)
+{
+	uint8_t buf[sizeof(content)];
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	sqe = rtio_sqe_acquire(&r_fs);
+	rtio_sqe_prep_write(sqe, &file_iodev, RTIO_PRIO_NORM, content, sizeof(content), NULL);
+	zassert_ok(rtio_submit(&r_fs, 1));
+
+	cqe = rtio_cqe_consume(&r_fs);
+	zassert_not_null(cqe);
+	zassert_equal(cqe->result, sizeof(content));
+	rtio_cqe_release(&r_fs, cqe);
+
+	zassert_ok(fs_seek(&file, 0, FS_SEEK_SET));
+
+	sqe = rtio_sqe_acquire(&r_fs);
+	rtio_sqe_prep_read(sqe, &file_iodev, RTIO_PRIO_NORM, buf, sizeof(buf), NULL);
+	zassert_ok(rtio_submit(&r_fs, 1));
+
+	cqe = rtio_cqe_consume(&r_fs);
+	zassert_not_null(cqe);
+	zassert_equal(cqe->result, sizeof(content));
+	rtio_cqe_release(&r_fs, cqe);
+	zassert_mem_equal(buf, content, sizeof(content));
+}
+
+ZTEST(rtio_fs, test_chained_mempool_reads)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	uint8_t *buf;
+	uint32_t buf_len;
+
+	zassert_equal(fs_write(&file, content, sizeof(content)), sizeof(content));
+	zassert_ok(fs_seek(&file, 0, FS_SEEK_SET));
+
+	/* Chained reads go through the file in order, one block each */
+	for (int i = 0; i < 3; i++) {
+		sqe = rtio_sqe_acquire(&r_fs);
+		rtio_sqe_prep_read_with_pool(sqe, &file_iodev, RTIO_PRIO_NORM, NULL);
+		if (i < 2) {
+			sqe->flags |= RTIO_SQE_CHAINED;
+		}
+	}
+
+	zassert_ok(rtio_submit(&r_fs, 3));
+
+	for (size_t offset = 0; offset < sizeof(content); offset += BLOCK_SIZE) {
+		cqe = rtio_cqe_consume(&r_fs);
+		zassert_not_null(cqe);
+		zassert_equal(cqe->result, MIN(BLOCK_SIZE, sizeof(content) - offset));
+		zassert_ok(rtio_cqe_get_mempool_buffer(&r_fs, cqe, &buf, &buf_len));
+		zassert_mem_equal(buf, content + offset, cqe->result);
+		rtio_cqe_release(&r_fs, cqe);
+		rtio_release_buffer(&r_fs, buf, buf_len);
+	}
+}
+
+ZTEST(rtio_fs, test_unsupported_op)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	sqe = rtio_sqe_acquire(&r_fs);
+	rtio_sqe_prep_accept(sqe, &file_iodev, RTIO_PRIO_NORM, NULL);
+	zassert_ok(rtio_submit(&r_fs, 1));
+
+	cqe = rtio_cqe_consume(&r_fs);
+	zassert_not_null(cqe);
+	zassert_equal(cqe->result, -ENOTSUP);
+	rtio_cqe_release(&r_fs, cqe);
+}
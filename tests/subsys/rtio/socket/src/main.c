@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/socket.h>
+#include <zephyr/zvfs/epoll.h>
+#include <zephyr/zvfs/eventfd.h>
+#include <zephyr/ztest.h>
+
+#define TEST_PORT 4242
+#define BLOCK_SIZE 32
+
+RTIO_DEFINE_WITH_MEMPOOL(r_sock, 4, 4, 8, BLOCK_SIZE, 4);
+
+RTIO_SOCK_IODEV_DEFINE(listen_iodev);
+RTIO_SOCK_IODEV_DEFINE(conn_iodev);
+
+static int listen_fd;
+static int client_fd;
+static int conn_fd;
+
+static struct rtio_cqe *wait_cqe(void)
+{
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&r_sock);
+
+	zassert_not_null(cqe);
+
+	return cqe;
+}
+
+static void *setup(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(TEST_PORT),
+	};
+
+	zsock_inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+
+	listen_fd = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(listen_fd >= 0);
+	zassert_ok(zsock_bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)));
+	zassert_ok(zsock_listen(listen_fd, 2));
+	zassert_ok(rtio_sock_attach(&listen_iodev, listen_fd));
+
+	return NULL;
+}
+
+static void teardown(void *unused)
+{
+	rtio_sock_detach(&listen_iodev);
+	zsock_close(listen_fd);
+}
+
+/* Connect a client and accept it through the listening iodev */
+static void before(void *unused)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(TEST_PORT),
+	};
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	zsock_inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+
+	sqe = rtio_sqe_acquire(&r_sock);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_accept(sqe, &listen_iodev, RTIO_PRIO_NORM, NULL);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	/* Nothing to accept yet */
+	k_msleep(10);
+	zassert_is_null(rtio_cqe_consume(&r_sock));
+
+	client_fd = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(client_fd >= 0);
+	zassert_ok(zsock_connect(client_fd, (struct sockaddr *)&addr, sizeof(addr)));
+
+	cqe = wait_cqe();
+	zassert_true(cqe->result >= 0, "accept failed (%d)", cqe->result);
+	conn_fd = cqe->result;
+	rtio_cqe_release(&r_sock, cqe);
+
+	zassert_ok(rtio_sock_attach(&conn_iodev, conn_fd));
+}
+
+static void after(void *unused)
+{
+	rtio_sock_detach(&conn_iodev);
+	zsock_close(conn_fd);
+	zsock_close(client_fd);
+}
+
+ZTEST_SUITE(rtio_socket, NULL, setup, before, after, teardown);
+
+ZTEST(rtio_socket, test_recv_send)
+{
+	static const char request[] = "ping";
+	static const char response[] = "pong";
+	uint8_t buf[16];
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read(sqe, &conn_iodev, RTIO_PRIO_NORM, buf, sizeof(buf), NULL);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	k_msleep(10);
+	zassert_is_null(rtio_cqe_consume(&r_sock), "receive completed without data");
+
+	zassert_equal(zsock_send(client_fd, request, sizeof(request), 0), sizeof(request));
+
+	cqe = wait_cqe();
+	zassert_equal(cqe->result, sizeof(request));
+	rtio_cqe_release(&r_sock, cqe);
+	zassert_mem_equal(buf, request, sizeof(request));
+
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_write(sqe, &conn_iodev, RTIO_PRIO_NORM, response, sizeof(response), NULL);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	cqe = wait_cqe();
+	zassert_equal(cqe->result, sizeof(response));
+	rtio_cqe_release(&r_sock, cqe);
+
+	zassert_equal(zsock_recv(client_fd, buf, sizeof(buf), 0), sizeof(response));
+	zassert_mem_equal(buf, response, sizeof(response));
+}
+
+ZTEST(rtio_socket, test_multishot_mempool)
+{
+	static const char *const messages[] = {"one", "two", "three"};
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	uint8_t *buf;
+	uint32_t buf_len;
+
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read_multishot(sqe, &conn_iodev, RTIO_PRIO_NORM, NULL);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	ARRAY_FOR_EACH(messages, i) {
+		zassert_equal(zsock_send(client_fd, messages[i], strlen(messages[i]), 0),
+			      strlen(messages[i]));
+
+		cqe = wait_cqe();
+		zassert_equal(cqe->result, strlen(messages[i]));
+		zassert_ok(rtio_cqe_get_mempool_buffer(&r_sock, cqe, &buf, &buf_len));
+		rtio_cqe_release(&r_sock, cqe);
+
+		/* One block per completion */
+		zassert_equal(buf_len, BLOCK_SIZE);
+		zassert_mem_equal(buf, messages[i], strlen(messages[i]));
+		rtio_release_buffer(&r_sock, buf, buf_len);
+	}
+
+	/* The end of the stream completes once, then the receive stays parked */
+	zsock_shutdown(client_fd, ZSOCK_SHUT_WR);
+
+	cqe = wait_cqe();
+	zassert_equal(cqe->result, 0);
+	zassert_ok(rtio_cqe_get_mempool_buffer(&r_sock, cqe, &buf, &buf_len));
+	rtio_cqe_release(&r_sock, cqe);
+	rtio_release_buffer(&r_sock, buf, buf_len);
+
+	k_msleep(10);
+	zassert_is_null(rtio_cqe_consume(&r_sock));
+}
+
+ZTEST(rtio_socket, test_detach_cancels)
+{
+	uint8_t buf[16];
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read(sqe, &conn_iodev, RTIO_PRIO_NORM, buf, sizeof(buf), NULL);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	rtio_sock_detach(&conn_iodev);
+
+	cqe = wait_cqe();
+	zassert_equal(cqe->result, -ECANCELED);
+	rtio_cqe_release(&r_sock, cqe);
+
+	/* Detaching again in after() must not complete anything */
+}
+
+ZTEST(rtio_socket, test_multishot_detach)
+{
+	struct rtio_sqe *sqe;
+
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read_multishot(sqe, &conn_iodev, RTIO_PRIO_NORM, NULL);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	k_msleep(10);
+	rtio_sock_detach(&conn_iodev);
+
+	/* A canceled multishot receive is released without a completion */
+	k_msleep(10);
+	zassert_is_null(rtio_cqe_consume(&r_sock));
+}
+
+ZTEST(rtio_socket, test_multishot_error)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	/* Receiving fails for good on a listening socket, as on a reset
+	 * connection, which the loopback interface cannot produce.
+	 */
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read_multishot(sqe, &listen_iodev, RTIO_PRIO_NORM, NULL);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	cqe = wait_cqe();
+	zassert_equal(cqe->result, -ENOTCONN);
+	zassert_equal(cqe->flags, 0, "no buffer expected with an error");
+	rtio_cqe_release(&r_sock, cqe);
+
+	/* The failed receive is not submitted again */
+	k_msleep(50);
+	zassert_is_null(rtio_cqe_consume(&r_sock));
+}
+
+ZTEST(rtio_socket, test_multishot_mempool_exhausted)
+{
+	uint8_t *bufs[8];
+	uint32_t buf_lens[8];
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	uint8_t *buf;
+	uint32_t buf_len;
+
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read_multishot(sqe, &conn_iodev, RTIO_PRIO_NORM, NULL);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	/* Hold on to every block of the mempool */
+	ARRAY_FOR_EACH(bufs, i) {
+		zassert_equal(zsock_send(client_fd, "x", 1, 0), 1);
+
+		cqe = wait_cqe();
+		zassert_equal(cqe->result, 1);
+		zassert_ok(rtio_cqe_get_mempool_buffer(&r_sock, cqe, &bufs[i], &buf_lens[i]));
+		rtio_cqe_release(&r_sock, cqe);
+	}
+
+	/* The receive waits for a block rather than failing */
+	zassert_equal(zsock_send(client_fd, "y", 1, 0), 1);
+
+	k_msleep(50);
+	zassert_is_null(rtio_cqe_consume(&r_sock), "completed without a block");
+
+	rtio_release_buffer(&r_sock, bufs[0], buf_lens[0]);
+
+	cqe = wait_cqe();
+	zassert_equal(cqe->result, 1);
+	zassert_ok(rtio_cqe_get_mempool_buffer(&r_sock, cqe, &buf, &buf_len));
+	rtio_cqe_release(&r_sock, cqe);
+	zassert_equal(buf[0], 'y');
+	rtio_release_buffer(&r_sock, buf, buf_len);
+
+	for (size_t i = 1; i < ARRAY_SIZE(bufs); i++) {
+		rtio_release_buffer(&r_sock, bufs[i], buf_lens[i]);
+	}
+}
+
+ZTEST(rtio_socket, test_epoll_exhausted)
+{
+	struct zvfs_epoll_event event = {
+		.events = ZVFS_EPOLLIN,
+	};
+	int efds[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	int count = 0;
+	uint8_t buf[16];
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	int epfd;
+
+	/* The registrations are shared by all epoll instances, take the ones
+	 * left by the reactor.
+	 */
+	epfd = zvfs_epoll_create(0);
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	while (count < ARRAY_SIZE(efds)) {
+		efds[count] = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+		zassert_true(efds[count] >= 0, "eventfd failed (%d)", errno);
+
+		if (zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, efds[count], &event) < 0) {
+			zassert_equal(errno, ENOMEM);
+			zsock_close(efds[count]);
+			break;
+		}
+
+		count++;
+	}
+
+	zassert_true(count < ARRAY_SIZE(efds), "epoll registrations not exhausted");
+
+	/* The receive cannot wait, so it fails instead of hanging */
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read(sqe, &conn_iodev, RTIO_PRIO_NORM, buf, sizeof(buf), NULL);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	cqe = wait_cqe();
+	zassert_equal(cqe->result, -ENOMEM);
+	rtio_cqe_release(&r_sock, cqe);
+
+	/* zsock_close() closes descriptors of any kind */
+	for (int i = 0; i < count; i++) {
+		zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, efds[i], NULL));
+		zsock_close(efds[i]);
+	}
+
+	zsock_close(epfd);
+
+	/* The socket can be watched again */
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read(sqe, &conn_iodev, RTIO_PRIO_NORM, buf, sizeof(buf), NULL);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	k_msleep(10);
+	zassert_is_null(rtio_cqe_consume(&r_sock), "receive completed without data");
+
+	zassert_equal(zsock_send(client_fd, "x", 1, 0), 1);
+
+	cqe = wait_cqe();
+	zassert_equal(cqe->result, 1);
+	rtio_cqe_release(&r_sock, cqe);
+}
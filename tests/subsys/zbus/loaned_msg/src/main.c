@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/net_buf.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+struct msg {
+	int x;
+	int y;
+};
+
+static bool msg_validator(const void *msg, size_t msg_size)
+{
+	return ((const struct msg *)msg)->x >= 0;
+}
+
+ZBUS_MSG_SUBSCRIBER_DEFINE(sub_a);
+ZBUS_MSG_SUBSCRIBER_DEFINE(sub_b);
+
+ZBUS_CHAN_DEFINE(chan, struct msg, msg_validator, NULL, ZBUS_OBSERVERS(sub_a, sub_b),
+		 ZBUS_MSG_INIT(0));
+
+static void publish(int x, int y)
+{
+	struct net_buf *loan;
+	struct msg *msg;
+
+	zassert_equal(0, zbus_chan_loan(&chan, &loan, K_NO_WAIT));
+	zassert_equal(sizeof(struct msg), loan->len);
+
+	msg = (struct msg *)loan->data;
+	msg->x = x;
+	msg->y = y;
+
+	zassert_equal(0, zbus_chan_pub_loan(&chan, loan, K_NO_WAIT));
+}
+
+ZTEST(loaned_msg, test_shared_buffer)
+{
+	const struct zbus_channel *ch_a, *ch_b;
+	struct net_buf *buf_a, *buf_b;
+	struct msg read;
+
+	publish(1, 2);
+
+	zassert_equal(0, zbus_sub_wait_loaned_msg(&sub_a, &ch_a, &buf_a, K_NO_WAIT));
+	zassert_equal(0, zbus_sub_wait_loaned_msg(&sub_b, &ch_b, &buf_b, K_NO_WAIT));
+	zassert_equal_ptr(&chan, ch_a);
+	zassert_equal_ptr(&chan, ch_b);
+
+	/* Both subscribers see the publisher's buffer, not a copy */
+	zassert_not_equal(buf_a, buf_b);
+	zassert_equal_ptr(buf_a->data, buf_b->data);
+	zassert_equal(1, ((const struct msg *)buf_a->data)->x);
+	zassert_equal(2, ((const struct msg *)buf_b->data)->y);
+
+	/* The channel keeps its own copy of the message */
+	zassert_equal(0, zbus_chan_read(&chan, &read, K_NO_WAIT));
+	zassert_equal(1, read.x);
+	zassert_equal(2, read.y);
+
+	net_buf_unref(buf_a);
+	net_buf_unref(buf_b);
+}
+
+ZTEST(loaned_msg, test_buffers_released)
+{
+	const struct zbus_channel *ch;
+	struct net_buf *buf;
+	struct msg msg;
+
+	/* Three buffers are in use per publication, so this only passes if they are all freed */
+	for (int i = 0; i < 10; i++) {
+		publish(i, -i);
+
+		zassert_equal(0, zbus_sub_wait_msg(&sub_a, &ch, &msg, K_NO_WAIT));
+		zassert_equal(i, msg.x);
+
+		zassert_equal(0, zbus_sub_wait_loaned_msg(&sub_b, &ch, &buf, K_NO_WAIT));
+		zassert_equal(-i, ((const struct msg *)buf->data)->y);
+		net_buf_unref(buf);
+	}
+}
+
+ZTEST(loaned_msg, test_loan_consumed_on_error)
+{
+	const struct zbus_channel *ch;
+	struct net_buf *loan;
+	struct net_buf *buf;
+
+	for (int i = 0; i < CONFIG_ZBUS_LOANED_MSG_POOL_SIZE + 1; i++) {
+		zassert_equal(0, zbus_chan_loan(&chan, &loan, K_NO_WAIT));
+		((struct msg *)loan->data)->x = -1;
+
+		zassert_equal(-ENOMSG, zbus_chan_pub_loan(&chan, loan, K_NO_WAIT));
+	}
+
+	zassert_equal(-ENOMSG, zbus_sub_wait_loaned_msg(&sub_a, &ch, &buf, K_NO_WAIT));
+}
+
+ZTEST(loaned_msg, test_copied_msg_as_buffer)
+{
+	const struct zbus_channel *ch;
+	struct msg msg = {.x = 7, .y = 8};
+	struct net_buf *buf;
+
+	/* Regular publications can be received without a copy as well */
+	zassert_equal(0, zbus_chan_pub(&chan, &msg, K_NO_WAIT));
+
+	zassert_equal(0, zbus_sub_wait_loaned_msg(&sub_a, &ch, &buf, K_NO_WAIT));
+	zassert_equal(7, ((const struct msg *)buf->data)->x);
+	net_buf_unref(buf);
+
+	zassert_equal(0, zbus_sub_wait_msg(&sub_b, &ch, &msg, K_NO_WAIT));
+	zassert_equal(8, msg.y);
+}
+
+ZTEST_SUITE(loaned_msg, NULL, NULL, NULL, NULL, NULL);
@@ -74,6 +74,37 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+ZTEST(crc, test_crc32_unaligned_chunks)
+{
+	uint8_t data[256];
+	uint32_t crc;
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)i;
+	}
+
+	zassert_equal(crc32_ieee(data, sizeof(data)), 0x29058C73);
+	zassert_equal(crc32_c(0, data, sizeof(data), true, true), 0x9C44184B);
+
+	/* Odd sized, unaligned chunks must give the same result as one
+	 * pass over the whole buffer, whatever the implementation.
+	 */
+	for (size_t chunk = 1; chunk < 19; chunk++) {
+		crc = 0;
+		for (size_t off = 0; off < sizeof(data); off += chunk) {
+			crc = crc32_ieee_update(crc, &data[off], MIN(chunk, sizeof(data) - off));
+		}
+		zassert_equal(crc, 0x29058C73, "chunk %zu", chunk);
+
+		crc = crc32_c(0, data, 0, true, false);
+		for (size_t off = 0; off < sizeof(data); off += chunk) {
+			crc = crc32_c(crc, &data[off], MIN(chunk, sizeof(data) - off), false,
+				      false);
+		}
+		zassert_equal(crc ^ 0xFFFFFFFF, 0x9C44184B, "chunk %zu", chunk);
+	}
+}
+
 ZTEST(crc, test_crc24_pgp)
 {
 	uint8_t test1[] = { 'A' };